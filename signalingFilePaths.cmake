@@ -7,7 +7,13 @@
 
 # Signaling library source files.
 set( SIGNALING_SOURCES
-     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_api.c" )
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_api.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_bootstrap.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_http.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_ice_cache.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_credentials.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_channel_manager.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/signaling_sigv4.c" )
 
 # Signaling library Public Include directories.
 set( SIGNALING_INCLUDE_PUBLIC_DIRS
@@ -16,4 +22,11 @@ set( SIGNALING_INCLUDE_PUBLIC_DIRS
 # Signaling library public include header files.
 set( SIGNALING_INCLUDE_PUBLIC_FILES
      "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_api.h"
-     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_data_types.h" )
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_bootstrap.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_data_types.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_http.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_ice_cache.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_credentials.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_memory_barrier.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_channel_manager.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/signaling_sigv4.h" )
@@ -12,6 +12,7 @@ extern "C" {
 /* *INDENT-ON* */
 
 #include "signaling_data_types.h"
+#include "signaling_sigv4.h"
 
 /*-----------------------------------------------------------*/
 
@@ -20,12 +21,12 @@ extern "C" {
  *
  * @param[in] pAwsRegion The AWS region.
  * @param[in] pChannelName The channel name set in AWS account.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams/latest/dg/API_DescribeSignalingChannel.html for details.
@@ -61,12 +62,12 @@ SignalingResult_t Signaling_ParseDescribeSignalingChannelResponse( const char *
  *
  * @param[in] pAwsRegion The AWS region.
  * @param[in] pChannelArn The channel ARN which gets from Signaling_ConstructDescribeSignalingChannelRequest.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams/latest/dg/API_DescribeMediaStorageConfiguration.html for details.
@@ -81,12 +82,12 @@ SignalingResult_t Signaling_ConstructDescribeMediaStorageConfigRequest( Signalin
  *
  * @param[in] pAwsIotEndpoint The AWS IoT Endpoint.
  * @param[in] pRoleAlias The Role Alias associated with the Role that is used for authorization.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams/latest/dg/how-iot.html for details.
@@ -144,12 +145,12 @@ SignalingResult_t Signaling_ParseDescribeMediaStorageConfigResponse( const char
  *
  * @param[in] pAwsRegion The AWS region.
  * @param[in] pCreateSignalingChannelRequestInfo The parameters that needed to construct request to create signaling channel.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  * - #SIGNALING_RESULT_ACCESS_KEY_LENGTH_TOO_LARGE, if accessKey overflows.
  * - #SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE, if secret acessKey overflows.
@@ -187,12 +188,12 @@ SignalingResult_t Signaling_ParseCreateSignalingChannelResponse( const char * pM
  *
  * @param[in] pAwsRegion The AWS region.
  * @param[in] pGetSignalingChannelEndpointRequestInfo The parameters that needed to construct request to query signaling channel endpoints.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams/latest/dg/API_GetSignalingChannelEndpoint.html for details.
@@ -226,12 +227,12 @@ SignalingResult_t Signaling_ParseGetSignalingChannelEndpointResponse( const char
  *
  * @param[in] pHttpsEndpoint The HTTPS endpoint get from Signaling_ConstructGetSignalingChannelEndpointRequest.
  * @param[in] pGetIceServerConfigRequestInfo The parameters that needed to construct request to get ICE server configs.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams/latest/dg/API_signaling_GetIceServerConfig.html for details.
@@ -267,12 +268,12 @@ SignalingResult_t Signaling_ParseGetIceServerConfigResponse( const char * pMessa
  *
  * @param[in] pWebrtcEndpoint The webrtc endpoint get from Signaling_ConstructGetSignalingChannelEndpointRequest.
  * @param[in] pJoinStorageSessionRequestInfo The parameters that needed to construct request to join storage session.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams/latest/dg/API_webrtc_JoinStorageSession.html for details.
@@ -286,12 +287,12 @@ SignalingResult_t Signaling_ConstructJoinStorageSessionRequest( SignalingChannel
  *
  * @param[in] pAwsRegion The AWS region.
  * @param[in] pDeleteSignalingChannelRequestInfo The parameters that needed to construct request to delete signaling channel.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams-webrtc-dg/latest/devguide/kvswebrtc-websocket-apis-7.html for details.
@@ -305,12 +306,12 @@ SignalingResult_t Signaling_ConstructDeleteSignalingChannelRequest( SignalingAws
  *
  * @param[in] pWssEndpoint The Websocket endpoint get from Signaling_ConstructGetSignalingChannelEndpointRequest.
  * @param[in] pConnectWssEndpointRequestInfo The parameters that needed to construct request.
- * @param[out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams-webrtc-dg/latest/devguide/kvswebrtc-websocket-apis.html for details.
@@ -319,17 +320,193 @@ SignalingResult_t Signaling_ConstructConnectWssEndpointRequest( SignalingChannel
                                                                 ConnectWssEndpointRequestInfo_t * pConnectWssEndpointRequestInfo,
                                                                 SignalingRequest_t * pRequestBuffer );
 
+/**
+ * @brief This function is used to construct a presigned URL to connect with websocket secure
+ *        endpoint. The query is URI encoded, in canonical order, and signed with SigV4 for the
+ *        "kinesisvideo" service, so the URL can be opened without any other authentication.
+ *
+ * @param[in] pWssEndpoint The Websocket endpoint get from Signaling_ConstructGetSignalingChannelEndpointRequest.
+ * @param[in] pConnectWssEndpointRequestInfo The parameters that needed to construct request.
+ * @param[in, out] pPresignInfo The signer, credential, region, date and lifetime to presign with.
+ *                              The signer caches its signing key across calls.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, the date is malformed or
+ *   the lifetime is not between 1 and #SIGNALING_SIGV4_MAX_EXPIRES_SECONDS.
+ * - #SIGNALING_RESULT_REGION_LENGTH_TOO_LARGE, if the region is longer than #SIGNALING_SIGV4_MAX_REGION_LENGTH.
+ * - #SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE, if the secret access key is longer
+ *   than #SECRET_ACCESS_KEY_MAX_LEN.
+ * - #SIGNALING_RESULT_INVALID_URL, if the endpoint has no scheme or host, or has a query.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
+ *
+ * @note Refer to https://docs.aws.amazon.com/IAM/latest/UserGuide/create-signed-request.html for details.
+ */
+SignalingResult_t Signaling_ConstructPresignedConnectWssEndpointRequest( SignalingChannelEndpoint_t * pWssEndpoint,
+                                                                         ConnectWssEndpointRequestInfo_t * pConnectWssEndpointRequestInfo,
+                                                                         SignalingSigV4PresignInfo_t * pPresignInfo,
+                                                                         SignalingRequest_t * pRequestBuffer );
+
+/**
+ * @brief This function is used to serialize a constructed request into one complete HTTP/1.1
+ *        request: request line, headers and body, ready to be sent with one write. The headers
+ *        are Host, taken from the URL, Content-Type and Content-Length, User-Agent if given,
+ *        X-Amz-Date, X-Amz-Security-Token if given, and Authorization.
+ *
+ * @param[in] pRequest The constructed request, as output by a Signaling_Construct* API.
+ * @param[in] pHttpRequestInfo The method and the signing outputs.
+ * @param[out] pBuffer The buffer to store the HTTP request. If NULL, only the buffer size
+ *                     needed is returned in pBufferLength, including the null terminator.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the HTTP request as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_URL, if the URL of the request has no scheme or host.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store the HTTP request.
+ */
+SignalingResult_t Signaling_SerializeHttpRequest( const SignalingRequest_t * pRequest,
+                                                 const SignalingHttpRequestInfo_t * pHttpRequestInfo,
+                                                 char * pBuffer,
+                                                 size_t * pBufferLength );
+
+/**
+ * @brief This function is used to serialize a constructed request into HTTP/1.1 as
+ *        scatter-gather segments: the request line and headers, written to pHeaderBuffer,
+ *        and the body, referenced where it was constructed. The concatenated segments are the
+ *        same bytes Signaling_SerializeHttpRequest writes, without the null terminator.
+ *
+ * @param[in] pRequest The constructed request. Its body must stay valid as long as the
+ *                     segments are used.
+ * @param[in] pHttpRequestInfo The method and the signing outputs.
+ * @param[out] pHeaderBuffer The buffer to store the request line and headers.
+ * @param[in, out] pHeaderBufferLength The size of pHeaderBuffer as input, the length of the
+ *                                     request line and headers as output.
+ * @param[out] pSegments The array to store the segments.
+ * @param[in, out] pSegmentCount The number of entries in pSegments as input, the number of
+ *                               segments used as output. #SIGNALING_HTTP_REQUEST_MAX_SEGMENTS
+ *                               entries are always enough.
+ * @param[out] pTotalLength The total length of the HTTP request.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_URL, if the URL of the request has no scheme or host.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pHeaderBuffer is not enough to store the headers, or if
+ *   pSegments has less than #SIGNALING_HTTP_REQUEST_MAX_SEGMENTS entries.
+ */
+SignalingResult_t Signaling_SerializeHttpRequestSegments( const SignalingRequest_t * pRequest,
+                                                         const SignalingHttpRequestInfo_t * pHttpRequestInfo,
+                                                         char * pHeaderBuffer,
+                                                         size_t * pHeaderBufferLength,
+                                                         SignalingIoVec_t * pSegments,
+                                                         size_t * pSegmentCount,
+                                                         size_t * pTotalLength );
+
+/**
+ * @brief This function is used to prepare the request fragments that stay the same for
+ *        one channel, so that GetIceServerConfig, ConnectWssEndpoint and JoinStorageSession
+ *        requests can be constructed from the context afterwards, only filling in the parts
+ *        that change.
+ *
+ * @param[in] pChannelArn The channel ARN.
+ * @param[in] pEndpoints The channel endpoints, as parsed from the GetSignalingChannelEndpoint
+ *                       response. Endpoints with a NULL pEndpoint are skipped, and requests
+ *                       that need them can't be constructed from the context.
+ * @param[out] pBuffer The buffer to store the fragments. It must stay valid as long as the
+ *                     context is used. If NULL, only the buffer size needed is returned in
+ *                     pBufferLength and pContext is left untouched.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length used as output.
+ * @param[out] pContext The context to initialize.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store the fragments.
+ */
+SignalingResult_t Signaling_InitChannelContext( SignalingChannelArn_t * pChannelArn,
+                                                SignalingChannelEndpoints_t * pEndpoints,
+                                                char * pBuffer,
+                                                size_t * pBufferLength,
+                                                SignalingChannelContext_t * pContext );
+
+/**
+ * @brief This function is used to construct GetIceServerConfig request from a channel context.
+ *        The result is the same as Signaling_ConstructGetIceServerConfigRequest.
+ *
+ * @param[in] pContext The channel context, with the HTTPS endpoint.
+ * @param[in] pClientId The client ID.
+ * @param[in] clientIdLength Length of the client ID.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL or the context has no HTTPS endpoint.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
+ */
+SignalingResult_t Signaling_ConstructGetIceServerConfigRequestFromContext( const SignalingChannelContext_t * pContext,
+                                                                          const char * pClientId,
+                                                                          size_t clientIdLength,
+                                                                          SignalingRequest_t * pRequestBuffer );
+
+/**
+ * @brief This function is used to construct JoinStorageSession request from a channel context.
+ *        The result is the same as Signaling_ConstructJoinStorageSessionRequest.
+ *
+ * @param[in] pContext The channel context, with the WebRTC endpoint.
+ * @param[in] role The role of the caller. The client ID is only sent if it is not master.
+ * @param[in] pClientId The client ID, can be NULL for master.
+ * @param[in] clientIdLength Length of the client ID.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL or the context has no WebRTC endpoint.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
+ */
+SignalingResult_t Signaling_ConstructJoinStorageSessionRequestFromContext( const SignalingChannelContext_t * pContext,
+                                                                          SignalingRole_t role,
+                                                                          const char * pClientId,
+                                                                          size_t clientIdLength,
+                                                                          SignalingRequest_t * pRequestBuffer );
+
+/**
+ * @brief This function is used to construct ConnectWssEndpoint request from a channel context.
+ *        The result is the same as Signaling_ConstructConnectWssEndpointRequest.
+ *
+ * @param[in] pContext The channel context, with the WSS endpoint.
+ * @param[in] role The role of the caller, master or viewer.
+ * @param[in] pClientId The client ID, can be NULL for master.
+ * @param[in] clientIdLength Length of the client ID.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see #SignalingRequest_t.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL or the context has no WSS endpoint.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
+ */
+SignalingResult_t Signaling_ConstructConnectWssEndpointRequestFromContext( const SignalingChannelContext_t * pContext,
+                                                                          SignalingRole_t role,
+                                                                          const char * pClientId,
+                                                                          size_t clientIdLength,
+                                                                          SignalingRequest_t * pRequestBuffer );
+
 /**
  * @brief This function is used to construct event message to websocket secure endpoint.
  *
  * @param[in] pWssSendMessage The event structure to construct message.
- * @param[out] pBuffer The buffer to store constructed message.
- * @param[out] pBufferLength The length of the buffer that stores the constructed message.
+ * @param[out] pBuffer The buffer to store constructed message. If NULL, only the buffer
+ *                     size needed is returned in pBufferLength, including the null terminator.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the constructed message as output.
  *
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_SNPRINTF_ERROR, if snprintf returns negative value.
  * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
  *
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams-webrtc-dg/latest/devguide/kvswebrtc-websocket-apis.html for details.
@@ -338,6 +515,210 @@ SignalingResult_t Signaling_ConstructWssMessage( WssSendMessage_t * pWssSendMess
                                                  char * pBuffer,
                                                  size_t * pBufferLength );
 
+/**
+ * @brief This function is used to construct event message to websocket secure endpoint from
+ *        a raw payload. The payload is base64 encoded straight into pBuffer, so no separate
+ *        buffer for the encoded payload is needed.
+ *
+ * @param[in] pWssSendMessage The event structure to construct message. pBase64EncodedMessage
+ *                            and base64EncodedMessageLength are ignored.
+ * @param[in] pPayload The raw payload, for example the SDP offer or answer JSON.
+ * @param[in] payloadLength Length of the raw payload.
+ * @param[out] pBuffer The buffer to store constructed message. If NULL, only the buffer
+ *                     size needed is returned in pBufferLength, including the null terminator.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the constructed message as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
+ *
+ * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams-webrtc-dg/latest/devguide/kvswebrtc-websocket-apis.html for details.
+ */
+SignalingResult_t Signaling_ConstructWssMessageFromRawPayload( WssSendMessage_t * pWssSendMessage,
+                                                               const char * pPayload,
+                                                               size_t payloadLength,
+                                                               char * pBuffer,
+                                                               size_t * pBufferLength );
+
+/**
+ * @brief This function is used to construct a batch of event messages to websocket secure
+ *        endpoint, for example trickle ICE candidates, back to back in one buffer. The messages
+ *        are not separated, so the buffer can be sent in one write, or split with pOffsets.
+ *
+ * @param[in] pWssSendMessages The array of event structures to construct messages.
+ * @param[in] messageCount The number of messages.
+ * @param[out] pBuffer The buffer to store constructed messages. If NULL, only the buffer
+ *                     size needed is returned in pBufferLength, including the null terminator
+ *                     written after the last message.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the total length of the constructed
+ *                               messages as output.
+ * @param[out] pOffsets The array of messageCount + 1 entries to store the offset of every message
+ *                      in pBuffer, followed by the total length. Message i spans from pOffsets[ i ]
+ *                      to pOffsets[ i + 1 ]. Can be NULL if pBuffer is NULL.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, in any of the messages.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed messages.
+ */
+SignalingResult_t Signaling_ConstructWssMessageBatch( WssSendMessage_t * pWssSendMessages,
+                                                      size_t messageCount,
+                                                      char * pBuffer,
+                                                      size_t * pBufferLength,
+                                                      size_t * pOffsets );
+
+/**
+ * @brief This function is used to construct event message to websocket secure endpoint,
+ *        leaving #SIGNALING_WSS_FRAME_HEADROOM bytes in front of it for the websocket frame
+ *        header. Signaling_FinalizeWssFrame can then turn the buffer into a frame in place.
+ *
+ * @param[in] pWssSendMessage The event structure to construct message.
+ * @param[out] pBuffer The buffer to store the headroom and the constructed message, which
+ *                     starts at pBuffer + #SIGNALING_WSS_FRAME_HEADROOM. If NULL, only the buffer
+ *                     size needed is returned in pBufferLength, including the headroom and the
+ *                     null terminator.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the constructed message,
+ *                               without the headroom, as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store the headroom and constructed message.
+ */
+SignalingResult_t Signaling_ConstructWssMessageWithHeadroom( WssSendMessage_t * pWssSendMessage,
+                                                             char * pBuffer,
+                                                             size_t * pBufferLength );
+
+/**
+ * @brief This function is used to write the RFC 6455 frame header of a single text frame
+ *        into the headroom of a message constructed by Signaling_ConstructWssMessageWithHeadroom
+ *        and, for a client, mask the message in place.
+ *
+ * @param[in, out] pBuffer The buffer passed to Signaling_ConstructWssMessageWithHeadroom.
+ * @param[in] messageLength The length of the constructed message.
+ * @param[in] pMaskingKey The 4 byte masking key. Clients must mask every frame, servers
+ *                        pass NULL to send the frame unmasked.
+ * @param[out] pFrameOffset The offset of the frame in pBuffer.
+ * @param[out] pFrameLength The length of the frame, header included.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the frame was finalized without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if the frame length does not fit in size_t.
+ *
+ * @note Refer to https://www.rfc-editor.org/rfc/rfc6455#section-5.2 for the frame format.
+ */
+SignalingResult_t Signaling_FinalizeWssFrame( char * pBuffer,
+                                              size_t messageLength,
+                                              const uint8_t * pMaskingKey,
+                                              size_t * pFrameOffset,
+                                              size_t * pFrameLength );
+
+/**
+ * @brief This function is used to construct event message to websocket secure endpoint
+ *        as scatter-gather segments, without copying anything. The segments reference
+ *        constant envelope strings and the fields of pWssSendMessage, so they can be passed
+ *        to writev or to a framing layer as is. The concatenated segments are the same bytes
+ *        Signaling_ConstructWssMessage writes, without the null terminator. Since nothing is
+ *        copied, the recipient client ID and the correlation ID can't be escaped and must not
+ *        contain characters that JSON strings escape.
+ *
+ * @param[in] pWssSendMessage The event structure to construct message. It must stay valid
+ *                            as long as the segments are used.
+ * @param[out] pSegments The array to store the segments.
+ * @param[in, out] pSegmentCount The number of entries in pSegments as input, the number of
+ *                               segments used as output. #SIGNALING_WSS_MESSAGE_MAX_SEGMENTS
+ *                               entries are always enough.
+ * @param[out] pTotalLength The total length of the message, for framing.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, or if the recipient client ID
+ *   or the correlation ID would need escaping.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pSegments has less than #SIGNALING_WSS_MESSAGE_MAX_SEGMENTS entries.
+ *
+ * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams-webrtc-dg/latest/devguide/kvswebrtc-websocket-apis.html for details.
+ */
+SignalingResult_t Signaling_ConstructWssMessageSegments( WssSendMessage_t * pWssSendMessage,
+                                                         SignalingIoVec_t * pSegments,
+                                                         size_t * pSegmentCount,
+                                                         size_t * pTotalLength );
+
+/**
+ * @brief This function is used to serialize an event message to websocket secure endpoint
+ *        once for many recipients. Signaling_ConstructBroadcastMessage and
+ *        Signaling_ConstructBroadcastSegments then produce the message of each recipient.
+ *
+ * @param[in] pWssSendMessage The event structure to construct message. pRecipientClientId
+ *                            and recipientClientIdLength are ignored.
+ * @param[out] pBuffer The buffer to store the serialized message. It must stay valid as long
+ *                     as the broadcast is used. If NULL, only the buffer size needed is
+ *                     returned in pBufferLength and pBroadcast is left untouched.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length used as output.
+ * @param[out] pBroadcast The broadcast to initialize.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store the serialized message.
+ */
+SignalingResult_t Signaling_InitBroadcast( WssSendMessage_t * pWssSendMessage,
+                                          char * pBuffer,
+                                          size_t * pBufferLength,
+                                          SignalingBroadcast_t * pBroadcast );
+
+/**
+ * @brief This function is used to construct the message of one recipient of a broadcast.
+ *        The result is the same as Signaling_ConstructWssMessage with that recipient.
+ *
+ * @param[in] pBroadcast The broadcast initialized by Signaling_InitBroadcast.
+ * @param[in] pRecipientClientId The recipient client ID.
+ * @param[in] recipientClientIdLength Length of the recipient client ID.
+ * @param[out] pBuffer The buffer to store constructed message. If NULL, only the buffer
+ *                     size needed is returned in pBufferLength, including the null terminator.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the constructed message as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if buffer is not enough to store constructed message.
+ */
+SignalingResult_t Signaling_ConstructBroadcastMessage( const SignalingBroadcast_t * pBroadcast,
+                                                       const char * pRecipientClientId,
+                                                       size_t recipientClientIdLength,
+                                                       char * pBuffer,
+                                                       size_t * pBufferLength );
+
+/**
+ * @brief This function is used to describe the message of one recipient of a broadcast as
+ *        scatter-gather segments, without copying anything. All recipients share the segment
+ *        holding the payload. The recipient client ID can't be escaped and must not contain
+ *        characters that JSON strings escape.
+ *
+ * @param[in] pBroadcast The broadcast initialized by Signaling_InitBroadcast.
+ * @param[in] pRecipientClientId The recipient client ID. It must stay valid as long as the
+ *                               segments are used.
+ * @param[in] recipientClientIdLength Length of the recipient client ID.
+ * @param[out] pSegments The array to store the segments.
+ * @param[in, out] pSegmentCount The number of entries in pSegments as input, the number of
+ *                               segments used as output. #SIGNALING_BROADCAST_MAX_SEGMENTS
+ *                               entries are always enough.
+ * @param[out] pTotalLength The total length of the message, for framing.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, or if the recipient client ID
+ *   would need escaping.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pSegments has less than #SIGNALING_BROADCAST_MAX_SEGMENTS entries.
+ */
+SignalingResult_t Signaling_ConstructBroadcastSegments( const SignalingBroadcast_t * pBroadcast,
+                                                        const char * pRecipientClientId,
+                                                        size_t recipientClientIdLength,
+                                                        SignalingIoVec_t * pSegments,
+                                                        size_t * pSegmentCount,
+                                                        size_t * pTotalLength );
+
 /**
  * @brief This function is used to parse event message from websocket secure endpoint.
  *
@@ -349,17 +730,241 @@ SignalingResult_t Signaling_ConstructWssMessage( WssSendMessage_t * pWssSendMess
  * @return Returns one of the following:
  * - #SIGNALING_RESULT_OK, if initialization was performed without error.
  * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
- * - #SIGNALING_RESULT_INVALID_JSON, if raw message is not a valid JSON message.
+ * - #SIGNALING_RESULT_INVALID_JSON, if raw message is not a valid JSON object.
  * - #SIGNALING_RESULT_UNEXPECTED_RESPONSE, if the message isn't the expected one.
  * - #SIGNALING_RESULT_INVALID_STATUS_RESPONSE, if statusResponse doesn't contain correct formatted message.
  * - #SIGNALING_RESULT_INVALID_TTL, if the TTL of ICE server config is invalid.
  *
+ * @note The message is validated and parsed in a single pass, so malformed
+ *       input is rejected without a separate JSON_Validate scan.
  * @note Refer to https://docs.aws.amazon.com/kinesisvideostreams-webrtc-dg/latest/devguide/kvswebrtc-websocket-apis-7.html for details.
  */
 SignalingResult_t Signaling_ParseWssRecvMessage( const char * pMessage,
                                                  size_t messageLength,
                                                  WssRecvMessage_t * pWssRecvMessage );
 
+/**
+ * @brief This function is used to parse a batch of event messages from websocket secure endpoint,
+ *        for example all frames received in one read.
+ *
+ * @param[in] pFrames Array of received frames. The frames may point into one shared buffer.
+ * @param[in] frameCount Number of frames in pFrames.
+ * @param[out] pWssRecvMessages Array of at least frameCount structures, one per frame, filled in
+ *                              the same way as Signaling_ParseWssRecvMessage does.
+ * @param[out] pResults Array of at least frameCount results, one per frame, with the values
+ *                      Signaling_ParseWssRecvMessage would return for that frame.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if all frames were processed. Check pResults for the outcome of each frame.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ */
+SignalingResult_t Signaling_ParseWssRecvMessageBatch( const WssRecvFrame_t * pFrames,
+                                                      size_t frameCount,
+                                                      WssRecvMessage_t * pWssRecvMessages,
+                                                      SignalingResult_t * pResults );
+
+/**
+ * @brief This function is used to classify an event message from websocket secure endpoint
+ *        without parsing all of it, for example to pick the worker that runs the full parse.
+ *
+ * @param[in] pMessage Raw event message from websocket secure endpoint.
+ * @param[in] messageLength Length of raw event message.
+ * @param[out] pWssRecvMessage Only messageType and the sender client ID are filled, the other
+ *                             fields are cleared.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the message was classified without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_JSON, if the part of the message read is not valid JSON.
+ *
+ * @note The scan stops as soon as both the message type and the sender client ID have been
+ *       found, so the rest of the message, usually the payload, is neither read nor validated.
+ *       Run Signaling_ParseWssRecvMessage before using the payload.
+ */
+SignalingResult_t Signaling_PeekWssMessage( const char * pMessage,
+                                            size_t messageLength,
+                                            WssRecvMessage_t * pWssRecvMessage );
+
+/**
+ * @brief This function is used to initialize a resumable parser for an event message from
+ *        websocket secure endpoint that arrives in several chunks, for example websocket
+ *        continuation frames or partial TCP reads.
+ *
+ * @param[out] pStream The parser state to initialize. Initialize it again before parsing the next message.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ */
+SignalingResult_t Signaling_InitWssRecvStream( WssRecvStream_t * pStream );
+
+/**
+ * @brief This function is used to feed the next chunk of an event message from websocket secure
+ *        endpoint to a resumable parser.
+ *
+ * @param[in, out] pStream The parser state initialized by Signaling_InitWssRecvStream.
+ * @param[in] pChunk The next chunk of the raw event message.
+ * @param[in] chunkLength Length of the chunk.
+ * @param[out] pUpdate The fields found in this chunk. String values are reported as fragments
+ *                     pointing into pChunk, so they must be consumed before the chunk is released.
+ *                     The message type is reported as soon as it has been parsed, which is
+ *                     usually before the payload has arrived.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the chunk was parsed without error. Check isMessageComplete in pUpdate
+ *   to know if the whole message has arrived.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_JSON, if the message so far is not the beginning of a valid JSON object.
+ * - #SIGNALING_RESULT_UNEXPECTED_RESPONSE, if statusResponse is not a JSON object.
+ * - #SIGNALING_RESULT_INVALID_STATUS_RESPONSE, if the last statusResponse is an empty object. This
+ *   is reported with the closing brace of the message.
+ *
+ * @note Once an error is returned, every following call returns the same error until the parser
+ *       is initialized again.
+ * @note As for Signaling_ParseWssRecvMessage, the message may be followed by whitespace and then by
+ *       one null terminator, and nothing else.
+ * @note Only string values are reported, a known member with a value of another type is skipped.
+ * @note If a member appears more than once, its value is reported again with isFirstFragment set,
+ *       so that the last value wins as in Signaling_ParseWssRecvMessage.
+ */
+SignalingResult_t Signaling_FeedWssRecvStream( WssRecvStream_t * pStream,
+                                               const char * pChunk,
+                                               size_t chunkLength,
+                                               WssRecvStreamUpdate_t * pUpdate );
+
+/**
+ * @brief This function is used to decode base64 text, for example pBase64EncodedPayload of
+ *        a parsed event message.
+ *
+ * @param[in] pInput The base64 text, with or without padding.
+ * @param[in] inputLength Length of the base64 text.
+ * @param[out] pOutput The buffer to store the decoded bytes. It may be the same as pInput to
+ *                     decode in place, for example inside the receive buffer.
+ * @param[in, out] pOutputLength The size of pOutput as input, the number of decoded bytes as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the text was decoded without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pOutput is too small for the decoded bytes.
+ * - #SIGNALING_RESULT_INVALID_BASE64, if the text is not valid base64.
+ */
+SignalingResult_t Signaling_DecodeBase64( const char * pInput,
+                                          size_t inputLength,
+                                          char * pOutput,
+                                          size_t * pOutputLength );
+
+/**
+ * @brief This function is used to base64 encode bytes with padding.
+ *
+ * @param[in] pInput The bytes to encode.
+ * @param[in] inputLength Number of bytes to encode.
+ * @param[out] pOutput The buffer to store the base64 text, which must not overlap pInput.
+ *                     No null terminator is written.
+ * @param[in, out] pOutputLength The size of pOutput as input, the length of the base64 text as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the bytes were encoded without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pOutput is too small for the base64 text.
+ */
+SignalingResult_t Signaling_EncodeBase64( const char * pInput,
+                                          size_t inputLength,
+                                          char * pOutput,
+                                          size_t * pOutputLength );
+
+/**
+ * @brief This function is used to parse the decoded payload of a SDP offer or answer event message.
+ *
+ * @param[in, out] pMessage The decoded payload. Escape sequences in the values are replaced in
+ *                          place, for example "\r\n" becomes CR LF.
+ * @param[in] messageLength Length of the decoded payload.
+ * @param[out] pSdpMessage The parsed message, using pointers into pMessage and size fields.
+ *                         Members that are not in the message are NULL.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the message was parsed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_JSON, if the message is not a valid JSON object.
+ * - #SIGNALING_RESULT_UNEXPECTED_RESPONSE, if type or sdp is not a string.
+ *
+ * @note pMessage is only modified if the message is valid.
+ */
+SignalingResult_t Signaling_ParseSdpMessage( char * pMessage,
+                                             size_t messageLength,
+                                             SignalingSdpMessage_t * pSdpMessage );
+
+/**
+ * @brief This function is used to parse the decoded payload of an ICE candidate event message.
+ *
+ * @param[in, out] pMessage The decoded payload. Escape sequences in the values are replaced in place.
+ * @param[in] messageLength Length of the decoded payload.
+ * @param[out] pIceCandidateMessage The parsed message, using pointers into pMessage and size fields.
+ *                                  Members that are not in the message or are null are NULL.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the message was parsed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_JSON, if the message is not a valid JSON object.
+ * - #SIGNALING_RESULT_UNEXPECTED_RESPONSE, if candidate or sdpMid is not a string, or sdpMLineIndex
+ *   is not a number.
+ *
+ * @note pMessage is only modified if the message is valid.
+ */
+SignalingResult_t Signaling_ParseIceCandidateMessage( char * pMessage,
+                                                      size_t messageLength,
+                                                      SignalingIceCandidateMessage_t * pIceCandidateMessage );
+
+/**
+ * @brief This function is used to base64 decode the payload of a SDP offer or answer event message
+ *        and parse it in one call.
+ *
+ * @param[in] pBase64EncodedPayload pBase64EncodedPayload of the parsed event message.
+ * @param[in] base64EncodedPayloadLength Length of the base64 encoded payload.
+ * @param[out] pBuffer The buffer to decode into. It may be the same as pBase64EncodedPayload to
+ *                     decode in place inside the receive buffer, so no other copy is made.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the decoded payload as output.
+ * @param[out] pSdpMessage The parsed message, using pointers into pBuffer and size fields.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the payload was decoded and parsed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pBuffer is too small for the decoded payload.
+ * - #SIGNALING_RESULT_INVALID_BASE64, if the payload is not valid base64.
+ * - #SIGNALING_RESULT_INVALID_JSON, if the decoded payload is not a valid JSON object.
+ * - #SIGNALING_RESULT_UNEXPECTED_RESPONSE, if type or sdp is not a string.
+ */
+SignalingResult_t Signaling_DecodeAndParseSdpMessage( const char * pBase64EncodedPayload,
+                                                      size_t base64EncodedPayloadLength,
+                                                      char * pBuffer,
+                                                      size_t * pBufferLength,
+                                                      SignalingSdpMessage_t * pSdpMessage );
+
+/**
+ * @brief This function is used to base64 decode the payload of an ICE candidate event message
+ *        and parse it in one call.
+ *
+ * @param[in] pBase64EncodedPayload pBase64EncodedPayload of the parsed event message.
+ * @param[in] base64EncodedPayloadLength Length of the base64 encoded payload.
+ * @param[out] pBuffer The buffer to decode into. It may be the same as pBase64EncodedPayload to
+ *                     decode in place inside the receive buffer, so no other copy is made.
+ * @param[in, out] pBufferLength The size of pBuffer as input, the length of the decoded payload as output.
+ * @param[out] pIceCandidateMessage The parsed message, using pointers into pBuffer and size fields.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the payload was decoded and parsed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pBuffer is too small for the decoded payload.
+ * - #SIGNALING_RESULT_INVALID_BASE64, if the payload is not valid base64.
+ * - #SIGNALING_RESULT_INVALID_JSON, if the decoded payload is not a valid JSON object.
+ * - #SIGNALING_RESULT_UNEXPECTED_RESPONSE, if candidate or sdpMid is not a string, or sdpMLineIndex
+ *   is not a number.
+ */
+SignalingResult_t Signaling_DecodeAndParseIceCandidateMessage( const char * pBase64EncodedPayload,
+                                                               size_t base64EncodedPayloadLength,
+                                                               char * pBuffer,
+                                                               size_t * pBufferLength,
+                                                               SignalingIceCandidateMessage_t * pIceCandidateMessage );
+
 /*-----------------------------------------------------------*/
 
 /* *INDENT-OFF* */
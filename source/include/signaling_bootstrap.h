@@ -0,0 +1,188 @@
+/**
+ * @file signaling_bootstrap.h
+ * @brief Sequencing of the control plane calls that bootstrap a signaling channel.
+ */
+#ifndef SIGNALING_BOOTSTRAP_H
+#define SIGNALING_BOOTSTRAP_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_api.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * Maximum number of ICE servers kept from the GetIceServerConfig response.
+ */
+#define SIGNALING_BOOTSTRAP_MAX_ICE_SERVERS ( 5 )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The calls of a bootstrap, in the order they are returned when several are ready.
+ */
+typedef enum SignalingBootstrapStep
+{
+    SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL = 0,
+    SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL,
+    SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT,
+    SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS,
+    SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG,
+    SIGNALING_BOOTSTRAP_STEP_MAX,
+    SIGNALING_BOOTSTRAP_STEP_NONE = SIGNALING_BOOTSTRAP_STEP_MAX,
+} SignalingBootstrapStep_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief State of one call of a bootstrap.
+ */
+typedef enum SignalingBootstrapStepState
+{
+    SIGNALING_BOOTSTRAP_STEP_STATE_WAITING = 0, /* Its inputs are not known yet. */
+    SIGNALING_BOOTSTRAP_STEP_STATE_READY,       /* It can be sent. */
+    SIGNALING_BOOTSTRAP_STEP_STATE_IN_FLIGHT,   /* It was sent, its response is awaited. */
+    SIGNALING_BOOTSTRAP_STEP_STATE_DONE,
+    SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED,
+} SignalingBootstrapStepState_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief What to bootstrap. The pointers must stay valid as long as the bootstrap is used.
+ *
+ *        If channelArn.pChannelArn is not NULL, the channel is not described. Otherwise, it is
+ *        created with messageTtlSeconds if it does not exist and createChannel is set. The
+ *        client ID is sent with GetIceServerConfig, and with ConnectWssEndpoint for a viewer.
+ *        If pPresignInfo is not NULL, the ConnectWssEndpoint URL is presigned with it.
+ */
+typedef struct SignalingBootstrapInfo
+{
+    SignalingAwsRegion_t awsRegion;
+    SignalingChannelName_t channelName;
+    SignalingChannelArn_t channelArn;
+    SignalingRole_t role;
+    char * pClientId;
+    size_t clientIdLength;
+    uint8_t createChannel;
+    uint32_t messageTtlSeconds;
+    uint8_t getIceServerConfig;
+    SignalingSigV4PresignInfo_t * pPresignInfo;
+} SignalingBootstrapInfo_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A bootstrap in progress. Initialize it with Signaling_BootstrapInit.
+ *
+ *        channelArn, endpoints, iceServers and iceServerCount are set as the responses are
+ *        fed, the other members are internal. The channel ARN, the endpoints and the strings
+ *        of the ICE servers are copied into the buffer given to Signaling_BootstrapInit, so
+ *        the response bodies can be reused once fed.
+ */
+typedef struct SignalingBootstrap
+{
+    SignalingBootstrapInfo_t info;
+    uint8_t stepStates[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+    uint8_t isComplete;
+    SignalingChannelArn_t channelArn;
+    SignalingChannelEndpoints_t endpoints;
+    SignalingIceServer_t iceServers[ SIGNALING_BOOTSTRAP_MAX_ICE_SERVERS ];
+    size_t iceServerCount;
+    char * pBuffer;
+    size_t bufferLength;
+    size_t bufferUsed;
+} SignalingBootstrap_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief This function is used to start a bootstrap.
+ *
+ * @param[out] pBootstrap The bootstrap to initialize.
+ * @param[in] pBootstrapInfo What to bootstrap.
+ * @param[in] pBuffer The buffer to copy the channel ARN, the endpoints and the ICE servers
+ *                    to. It must stay valid as long as the bootstrap is used.
+ * @param[in] bufferLength The size of pBuffer.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, or the role is neither
+ *   master nor viewer.
+ */
+SignalingResult_t Signaling_BootstrapInit( SignalingBootstrap_t * pBootstrap,
+                                           const SignalingBootstrapInfo_t * pBootstrapInfo,
+                                           char * pBuffer,
+                                           size_t bufferLength );
+
+/**
+ * @brief This function is used to construct the next request to send.
+ *
+ *        Calls are ready as soon as their inputs are known, so that independent ones are sent
+ *        without waiting for each other: once the endpoints are known, ConnectWssEndpoint and
+ *        GetIceServerConfig are both ready. Call this function until it returns
+ *        #SIGNALING_BOOTSTRAP_STEP_NONE to send all the ready calls, and again after feeding
+ *        each response.
+ *
+ * @param[in, out] pBootstrap The bootstrap.
+ * @param[out] pStep The call the request is for, #SIGNALING_BOOTSTRAP_STEP_NONE if no call is
+ *                   ready, in which case pRequestBuffer is left untouched.
+ * @param[in, out] pRequestBuffer The output structure includes URI, body buffers, and their sizes.
+ *                                If pUrl is NULL, only the buffer sizes needed are returned, see
+ *                                #SignalingRequest_t, and the call stays ready.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the request was constructed without error. The call is then in
+ *   flight until its response is fed.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - The result of the request constructor otherwise, the call stays ready.
+ */
+SignalingResult_t Signaling_BootstrapNextRequest( SignalingBootstrap_t * pBootstrap,
+                                                  SignalingBootstrapStep_t * pStep,
+                                                  SignalingRequest_t * pRequestBuffer );
+
+/**
+ * @brief This function is used to feed the response of a call in flight.
+ *
+ *        A DescribeSignalingChannel response with status 404 makes CreateSignalingChannel ready
+ *        if createChannel is set. Once created, the channel is described again, and
+ *        GetSignalingChannelEndpoint is only ready once its status is ACTIVE. For
+ *        ConnectWssEndpoint, feed the status of the websocket handshake, 101, with no body.
+ *
+ * @param[in, out] pBootstrap The bootstrap.
+ * @param[in] step The call the response is for.
+ * @param[in] statusCode The HTTP status code of the response.
+ * @param[in] pBody The response body, can be NULL if bodyLength is 0.
+ * @param[in] bodyLength Length of the response body.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the response was fed without error. Check isComplete to know if
+ *   the bootstrap is complete.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, or the call is not in flight.
+ * - #SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS, if the status code is not a success.
+ * - #SIGNALING_RESULT_CHANNEL_NOT_ACTIVE, if the channel is not ACTIVE yet, for example while it
+ *   is CREATING, or was just created and is not found yet. Describe it again after a delay.
+ * - #SIGNALING_RESULT_INVALID_ENDPOINT, if an endpoint the next calls need is missing.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if the buffer is not enough to copy the channel ARN, the
+ *   endpoints or the ICE servers.
+ * - The result of the response parser otherwise.
+ *
+ * When the result is not #SIGNALING_RESULT_OK, the call is ready again, to be retried.
+ */
+SignalingResult_t Signaling_BootstrapFeedResponse( SignalingBootstrap_t * pBootstrap,
+                                                   SignalingBootstrapStep_t step,
+                                                   uint16_t statusCode,
+                                                   const char * pBody,
+                                                   size_t bodyLength );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_BOOTSTRAP_H */
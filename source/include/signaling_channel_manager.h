@@ -0,0 +1,209 @@
+/**
+ * @file signaling_channel_manager.h
+ * @brief Per-channel signaling state of many channels, sharded so that each shard is owned by
+ *        one thread.
+ */
+#ifndef SIGNALING_CHANNEL_MANAGER_H
+#define SIGNALING_CHANNEL_MANAGER_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * Maximum number of shards of a channel manager.
+ */
+#define SIGNALING_CHANNEL_MANAGER_MAX_SHARDS ( 64 )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The state of one managed channel, and a slot of the hash table of a shard.
+ *
+ *        channelArn points to the ARN given to Signaling_ChannelManagerAdd, which must stay
+ *        valid until the channel is removed, and channelName points into it. pUserData is
+ *        left to the application, for its endpoints, ICE servers, credentials or WSS URL.
+ *
+ *        Removing a channel moves other channels of its shard to other slots, so a pointer to
+ *        a managed channel is valid until the next removal from its shard.
+ */
+typedef struct SignalingManagedChannel
+{
+    uint32_t nameHash;
+    uint8_t slotState;
+    uint8_t isIceServerConfigStale; /* Set on a reconnect ICE server message. */
+    SignalingChannelArn_t channelArn;
+    SignalingChannelName_t channelName;
+    void * pUserData;
+} SignalingManagedChannel_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief One shard, an open addressing hash table keyed by the channel name, with linear
+ *        probing and backward shift deletion.
+ */
+typedef struct SignalingChannelShard
+{
+    SignalingManagedChannel_t * pSlots;
+    size_t slotCount; /* A power of 2. */
+    size_t channelCount;
+} SignalingChannelShard_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A channel manager. Initialize it with Signaling_ChannelManagerInit, the members are
+ *        internal.
+ *
+ *        A channel belongs to the shard picked by the hash of its name, which is part of its
+ *        ARN, so that a channel is found in the same shard by ARN or by name. The shards share
+ *        nothing: usually there is one shard per core, and only the thread that owns a shard
+ *        adds, removes, looks up or routes messages to its channels, without taking a lock.
+ *        Other threads use Signaling_ChannelManagerShardOf to hand work to that thread.
+ */
+typedef struct SignalingChannelManager
+{
+    SignalingChannelShard_t shards[ SIGNALING_CHANNEL_MANAGER_MAX_SHARDS ];
+    size_t shardCount;
+} SignalingChannelManager_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief This function is used to initialize an empty channel manager.
+ *
+ *        pSlots is split evenly between the shards, each one getting the largest power of
+ *        2 slots that fits. A shard holds up to 3/4 of its slots, and always keeps one
+ *        free: a shard of 1 slot holds no channel, one of 2 slots holds 1. About
+ *        channelCount * 4 / 3 slots, rounded up per shard, are needed for channelCount
+ *        channels.
+ *
+ * @param[out] pManager The channel manager to initialize.
+ * @param[in] pSlots The slots of the hash tables. It must stay valid as long as pManager is used.
+ * @param[in] slotCount The number of slots.
+ * @param[in] shardCount The number of shards, from 1 to #SIGNALING_CHANNEL_MANAGER_MAX_SHARDS.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, or shardCount is out
+ *   of range.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if there is less than one slot per shard.
+ */
+SignalingResult_t Signaling_ChannelManagerInit( SignalingChannelManager_t * pManager,
+                                                SignalingManagedChannel_t * pSlots,
+                                                size_t slotCount,
+                                                size_t shardCount );
+
+/**
+ * @brief This function is used to get the shard that owns a channel, from any thread. It
+ *        does not access the shards.
+ *
+ * @param[in] pManager The channel manager.
+ * @param[in] pChannelArn The channel ARN, or NULL to use pChannelName.
+ * @param[in] pChannelName The channel name, used when pChannelArn is NULL.
+ * @param[out] pShardIndex The index of the shard.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the shard was found.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_CHANNEL_NAME, if the ARN does not contain a channel name.
+ */
+SignalingResult_t Signaling_ChannelManagerShardOf( const SignalingChannelManager_t * pManager,
+                                                   const SignalingChannelArn_t * pChannelArn,
+                                                   const SignalingChannelName_t * pChannelName,
+                                                   size_t * pShardIndex );
+
+/**
+ * @brief This function is used to add a channel. If the channel is already managed, it is
+ *        returned unchanged.
+ *
+ * @param[in, out] pManager The channel manager.
+ * @param[in] pChannelArn The channel ARN. The string must stay valid until the channel is removed.
+ * @param[in] pUserData The application state of the channel.
+ * @param[out] ppChannel The managed channel.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the channel was added or is already managed.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_CHANNEL_NAME, if the ARN does not contain a channel name.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if the shard of the channel is full.
+ */
+SignalingResult_t Signaling_ChannelManagerAdd( SignalingChannelManager_t * pManager,
+                                               const SignalingChannelArn_t * pChannelArn,
+                                               void * pUserData,
+                                               SignalingManagedChannel_t ** ppChannel );
+
+/**
+ * @brief This function is used to remove a channel. Pointers to the other channels of its
+ *        shard are no longer valid afterwards, look them up again.
+ *
+ * @param[in, out] pManager The channel manager.
+ * @param[in] pChannelArn The channel ARN.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the channel was removed.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_CHANNEL_NAME, if the ARN does not contain a channel name.
+ * - #SIGNALING_RESULT_CHANNEL_NOT_FOUND, if the channel is not managed.
+ */
+SignalingResult_t Signaling_ChannelManagerRemove( SignalingChannelManager_t * pManager,
+                                                  const SignalingChannelArn_t * pChannelArn );
+
+/**
+ * @brief This function is used to look up a channel by ARN or by name. Channel names are
+ *        unique within an account and region only, a lookup by name returns the first
+ *        channel found with that name.
+ *
+ * @param[in] pManager The channel manager.
+ * @param[in] pChannelArn The channel ARN, or NULL to look up pChannelName.
+ * @param[in] pChannelName The channel name, used when pChannelArn is NULL.
+ * @param[out] ppChannel The managed channel.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the channel was found.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_CHANNEL_NAME, if the ARN does not contain a channel name.
+ * - #SIGNALING_RESULT_CHANNEL_NOT_FOUND, if the channel is not managed.
+ */
+SignalingResult_t Signaling_ChannelManagerFind( const SignalingChannelManager_t * pManager,
+                                                const SignalingChannelArn_t * pChannelArn,
+                                                const SignalingChannelName_t * pChannelName,
+                                                SignalingManagedChannel_t ** ppChannel );
+
+/**
+ * @brief This function is used to route a message parsed by Signaling_ParseWssRecvMessage,
+ *        received on the websocket connection of a channel, to the state of that channel.
+ *        A #SIGNALING_TYPE_MESSAGE_RECONNECT_ICE_SERVER message marks its ICE server
+ *        configuration stale. The application handles the message with the returned channel.
+ *
+ * @param[in, out] pManager The channel manager.
+ * @param[in] pChannelArn The ARN of the channel the message was received for.
+ * @param[in] pWssRecvMessage The parsed message.
+ * @param[out] ppChannel The managed channel.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the message was routed.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_CHANNEL_NAME, if the ARN does not contain a channel name.
+ * - #SIGNALING_RESULT_CHANNEL_NOT_FOUND, if the channel is not managed.
+ */
+SignalingResult_t Signaling_ChannelManagerRouteMessage( SignalingChannelManager_t * pManager,
+                                                        const SignalingChannelArn_t * pChannelArn,
+                                                        const WssRecvMessage_t * pWssRecvMessage,
+                                                        SignalingManagedChannel_t ** ppChannel );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_CHANNEL_MANAGER_H */
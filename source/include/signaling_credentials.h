@@ -0,0 +1,140 @@
+/**
+ * @file signaling_credentials.h
+ * @brief Holder of temporary credentials, refreshed before they expire.
+ */
+#ifndef SIGNALING_CREDENTIALS_H
+#define SIGNALING_CREDENTIALS_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_data_types.h"
+#include "signaling_memory_barrier.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A copy of temporary credentials, with the expiration parsed.
+ */
+typedef struct SignalingCredentialCopy
+{
+    char accessKeyId[ ACCESS_KEY_MAX_LEN ];
+    size_t accessKeyIdLength;
+    char secretAccessKey[ SECRET_ACCESS_KEY_MAX_LEN ];
+    size_t secretAccessKeyLength;
+    char sessionToken[ SESSION_TOKEN_MAX_LEN ];
+    size_t sessionTokenLength;
+    uint64_t expirationSeconds;
+} SignalingCredentialCopy_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A holder of temporary credentials. Initialize it with Signaling_CredentialHolderInit,
+ *        the members are internal.
+ *
+ *        It is a sequence lock: one thread updates the credentials, and any number of threads
+ *        read a consistent copy of them without taking a lock, retrying if an update
+ *        happened meanwhile.
+ */
+typedef struct SignalingCredentialHolder
+{
+    volatile uint32_t sequence;
+    uint32_t refreshMarginSeconds;
+    SignalingCredentialCopy_t credential;
+} SignalingCredentialHolder_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief This function is used to parse an ISO-8601 UTC time, such as the expiration
+ *        returned by Signaling_ParseFetchTempCredsResponseFromAwsIot.
+ *
+ *        The accepted format is YYYY-MM-DDThh:mm:ss, optionally followed by fractional
+ *        seconds, which are ignored, and then by either Z or a +hh:mm or -hh:mm offset.
+ *
+ * @param[in] pTime The time.
+ * @param[in] timeLength Length of the time.
+ * @param[out] pEpochSeconds The time in seconds since 1970-01-01T00:00:00Z.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the time was parsed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_TIMESTAMP, if the time is malformed, out of range, or
+ *   before 1970.
+ */
+SignalingResult_t Signaling_ParseIso8601Time( const char * pTime,
+                                              size_t timeLength,
+                                              uint64_t * pEpochSeconds );
+
+/**
+ * @brief This function is used to initialize a holder without credentials.
+ *
+ * @param[out] pHolder The holder to initialize.
+ * @param[in] refreshMarginSeconds How long before the credentials expire a refresh is asked for.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if pHolder is NULL.
+ */
+SignalingResult_t Signaling_CredentialHolderInit( SignalingCredentialHolder_t * pHolder,
+                                                  uint32_t refreshMarginSeconds );
+
+/**
+ * @brief This function is used to store new credentials, usually parsed by
+ *        Signaling_ParseFetchTempCredsResponseFromAwsIot. They are copied, so the response can
+ *        be freed afterwards. Only one thread may update a holder at a time.
+ *
+ * @param[in, out] pHolder The holder.
+ * @param[in] pCredential The credentials. pExpiration must be an ISO-8601 time.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the credentials were stored without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_ACCESS_KEY_LENGTH_TOO_LARGE, if the access key is too large.
+ * - #SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE, if the secret access key is too large.
+ * - #SIGNALING_RESULT_SESSION_TOKEN_LENGTH_TOO_LARGE, if the session token is too large.
+ * - #SIGNALING_RESULT_INVALID_TIMESTAMP, if the expiration can't be parsed.
+ *
+ * On error, the previous credentials are kept.
+ */
+SignalingResult_t Signaling_CredentialHolderUpdate( SignalingCredentialHolder_t * pHolder,
+                                                    const SignalingCredential_t * pCredential );
+
+/**
+ * @brief This function is used to get a consistent copy of the credentials, from any thread.
+ *
+ * @param[in] pHolder The holder.
+ * @param[in] currentTimeSeconds The current time, in seconds since 1970-01-01T00:00:00Z.
+ * @param[out] pCopy The copy of the credentials.
+ * @param[out] pCredential The credentials, pointing into pCopy, to sign requests with.
+ *                         pExpiration is NULL.
+ * @param[out] pSecondsToExpiry The time left before the credentials expire, 0 if they have.
+ * @param[out] pShouldRefresh Set to 1 if the credentials expire within the refresh margin,
+ *                            else 0.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the credentials have not expired.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_CREDENTIAL_EXPIRED, if there are no credentials or they have expired.
+ *   The outputs are still set.
+ */
+SignalingResult_t Signaling_CredentialHolderGet( const SignalingCredentialHolder_t * pHolder,
+                                                 uint64_t currentTimeSeconds,
+                                                 SignalingCredentialCopy_t * pCopy,
+                                                 SignalingCredential_t * pCredential,
+                                                 uint64_t * pSecondsToExpiry,
+                                                 uint8_t * pShouldRefresh );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_CREDENTIALS_H */
@@ -82,6 +82,15 @@ typedef enum SignalingResult
     SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE,
     SIGNALING_RESULT_SESSION_TOKEN_LENGTH_TOO_LARGE,
     SIGNALING_RESULT_EXPIRATION_LENGTH_TOO_LARGE,
+    SIGNALING_RESULT_INVALID_BASE64,
+    SIGNALING_RESULT_INVALID_URL,
+    SIGNALING_RESULT_INVALID_HTTP_RESPONSE,
+    SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS,
+    SIGNALING_RESULT_CACHE_MISS,
+    SIGNALING_RESULT_INVALID_TIMESTAMP,
+    SIGNALING_RESULT_CREDENTIAL_EXPIRED,
+    SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+    SIGNALING_RESULT_CHANNEL_NOT_ACTIVE,
 } SignalingResult_t;
 
 /**
@@ -146,6 +155,11 @@ typedef enum SignalingTypeMessage
 /**
  * @ingroup signaling_enum_types
  * @brief Basic format of the signaling request.
+ *
+ *        The lengths are the sizes of pUrl and pBody as input, and the lengths of the
+ *        constructed URL and body as output. If pUrl is NULL, the request constructors
+ *        only compute the buffer sizes needed, including the null terminators, without
+ *        formatting anything. A length of zero means that the request has no such part.
  */
 typedef struct SignalingRequest
 {
@@ -155,6 +169,31 @@ typedef struct SignalingRequest
     size_t bodyLength;
 } SignalingRequest_t;
 
+/**
+ * Number of segments of a serialized HTTP request, see Signaling_SerializeHttpRequestSegments.
+ */
+#define SIGNALING_HTTP_REQUEST_MAX_SEGMENTS ( 2 )
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The parts of a serialized HTTP request that don't come from the constructed
+ *        request, usually the outputs of signing it. The session token and the user
+ *        agent are optional, their headers are left out when their length is zero.
+ */
+typedef struct SignalingHttpRequestInfo
+{
+    const char * pMethod;
+    size_t methodLength;
+    const char * pDate;
+    size_t dateLength;
+    const char * pAuthorization;
+    size_t authorizationLength;
+    const char * pSessionToken;
+    size_t sessionTokenLength;
+    const char * pUserAgent;
+    size_t userAgentLength;
+} SignalingHttpRequestInfo_t;
+
 /**
  * @ingroup signaling_enum_types
  * @brief Basic format of the AWS region name.
@@ -364,6 +403,27 @@ typedef struct ConnectWssEndpointRequestInfo
     size_t clientIdLength;
 } ConnectWssEndpointRequestInfo_t;
 
+/**
+ * @ingroup signaling_enum_types
+ * @brief Request fragments of one channel, prepared once by Signaling_InitChannelContext
+ *        and reused by the request constructors that take a context. The fragments point
+ *        into the buffer given to Signaling_InitChannelContext and are not null terminated.
+ *        Fragments of an endpoint that was not given are NULL.
+ */
+typedef struct SignalingChannelContext
+{
+    const char * pIceServerConfigUrl;
+    size_t iceServerConfigUrlLength;
+    const char * pIceServerConfigBodyPrefix;
+    size_t iceServerConfigBodyPrefixLength;
+    const char * pConnectWssUrlPrefix;
+    size_t connectWssUrlPrefixLength;
+    const char * pJoinStorageSessionUrl;
+    size_t joinStorageSessionUrlLength;
+    const char * pJoinStorageSessionBodyPrefix;
+    size_t joinStorageSessionBodyPrefixLength;
+} SignalingChannelContext_t;
+
 /**
  * @ingroup signaling_enum_types
  * @brief The structure to send message to websocket secure endpoint.
@@ -383,6 +443,52 @@ typedef struct WssSendMessage
     size_t correlationIdLength;
 } WssSendMessage_t;
 
+/**
+ * Maximum number of segments of a websocket secure message, see
+ * Signaling_ConstructWssMessageSegments.
+ */
+#define SIGNALING_WSS_MESSAGE_MAX_SEGMENTS ( 9 )
+
+/**
+ * Headroom reserved in front of a websocket secure message for the RFC 6455
+ * frame header, see Signaling_ConstructWssMessageWithHeadroom. It fits the
+ * longest header: 2 bytes, an 8 byte extended payload length and a 4 byte
+ * masking key.
+ */
+#define SIGNALING_WSS_FRAME_HEADROOM ( 14 )
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief One segment of a message in scatter-gather form, laid out like
+ *        struct iovec. The segments point into constant envelope strings and
+ *        into the caller's message fields, they are never null terminated.
+ */
+typedef struct SignalingIoVec
+{
+    const char * pBase;
+    size_t length;
+} SignalingIoVec_t;
+
+/**
+ * Maximum number of segments of a broadcast message, see
+ * Signaling_ConstructBroadcastSegments.
+ */
+#define SIGNALING_BROADCAST_MAX_SEGMENTS ( 3 )
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A websocket secure message serialized once for many recipients by
+ *        Signaling_InitBroadcast. The message of one recipient is the prefix, the
+ *        escaped recipient client ID and the suffix, which holds the payload.
+ */
+typedef struct SignalingBroadcast
+{
+    const char * pPrefix;
+    size_t prefixLength;
+    const char * pSuffix;
+    size_t suffixLength;
+} SignalingBroadcast_t;
+
 /**
  * @ingroup signaling_enum_types
  * @brief The status response structure in receive event message from websocket secure endpoint.
@@ -416,6 +522,115 @@ typedef struct WssRecvMessage
     WssStatusResponse_t statusResponse;
 } WssRecvMessage_t;
 
+/**
+ * @ingroup signaling_enum_types
+ * @brief A raw event message received from websocket secure endpoint, used to parse several
+ *        messages with one call.
+ */
+typedef struct WssRecvFrame
+{
+    const char * pMessage;
+    size_t messageLength;
+} WssRecvFrame_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief Maximum number of bytes a resumable event message parser keeps for a member name
+ *        or message type that is split across chunks. Longer names are treated as unknown.
+ */
+#define SIGNALING_WSS_RECV_STREAM_TOKEN_MAX_LEN ( 32 )
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The part of a string value that is inside the chunk passed to Signaling_FeedWssRecvStream.
+ *        A value that spans several chunks is reported as one fragment per chunk, pointing into
+ *        each chunk, instead of being copied.
+ */
+typedef struct WssRecvStreamFragment
+{
+    const char * pData;      /* NULL if no part of the value is inside the chunk. */
+    size_t length;
+    uint8_t isFirstFragment; /* The value starts inside the chunk. */
+    uint8_t isLastFragment;  /* The value ends inside the chunk. */
+} WssRecvStreamFragment_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The fields found by Signaling_FeedWssRecvStream in one chunk of an event message.
+ */
+typedef struct WssRecvStreamUpdate
+{
+    WssRecvStreamFragment_t senderClientId;
+    SignalingTypeMessage_t messageType; /* SIGNALING_TYPE_MESSAGE_UNKNOWN until the message type has been parsed. */
+    WssRecvStreamFragment_t base64EncodedPayload;
+    WssRecvStreamFragment_t correlationId;
+    WssRecvStreamFragment_t errorType;
+    WssRecvStreamFragment_t statusCode;
+    WssRecvStreamFragment_t description;
+    uint8_t isMessageComplete;          /* The closing brace of the message has been parsed. */
+} WssRecvStreamUpdate_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief State of a resumable parser for an event message from websocket secure endpoint that
+ *        arrives in several chunks. Initialize it with Signaling_InitWssRecvStream, the members
+ *        are internal to the parser.
+ */
+typedef struct WssRecvStream
+{
+    SignalingResult_t result;
+    SignalingTypeMessage_t messageType;
+    uint32_t arrayMask; /* Bit (depth - 1) is set if that nesting level is an array. */
+    uint8_t depth;
+    uint8_t state;
+    uint8_t field;
+    uint8_t isKey;
+    uint8_t inStatusResponse;
+    uint8_t hasStatusResponse;         /* A statusResponse object has been parsed. */
+    uint8_t statusResponseMemberCount; /* Members of the last statusResponse object, up to 1. */
+    uint8_t escapeState;
+    uint8_t hexRemaining;
+    uint16_t hexValue;
+    uint8_t utf8Remaining;
+    uint8_t utf8Min;
+    uint8_t utf8Max;
+    uint8_t numberState;
+    uint8_t literal;
+    uint8_t literalIndex;
+    size_t tokenLength;
+    char token[ SIGNALING_WSS_RECV_STREAM_TOKEN_MAX_LEN ];
+} WssRecvStream_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The SDP offer or answer in the decoded payload of an event message, for example
+ *        {"type":"offer","sdp":"v=0\r\n..."}. Escape sequences in the values are replaced
+ *        in place, so pSdp contains real CR LF line endings.
+ */
+typedef struct SignalingSdpMessage
+{
+    const char * pType;
+    size_t typeLength;
+    const char * pSdp;
+    size_t sdpLength;
+} SignalingSdpMessage_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The ICE candidate in the decoded payload of an event message, for example
+ *        {"candidate":"candidate:1 1 udp ...","sdpMid":"0","sdpMLineIndex":0}. Escape
+ *        sequences in the string values are replaced in place.
+ */
+typedef struct SignalingIceCandidateMessage
+{
+    const char * pCandidate;
+    size_t candidateLength;
+    const char * pSdpMid;
+    size_t sdpMidLength;
+    const char * pSdpMLineIndex; /* The number as it appears in the message. */
+    size_t sdpMLineIndexLength;
+} SignalingIceCandidateMessage_t;
+
 /*-----------------------------------------------------------*/
 
 #endif /* SIGNALING_DATA_TYPES_H */
@@ -0,0 +1,120 @@
+/**
+ * @file signaling_http.h
+ * @brief Incremental parsing of the HTTP/1.1 responses to the requests constructed by the Signaling component.
+ */
+#ifndef SIGNALING_HTTP_H
+#define SIGNALING_HTTP_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * Maximum length of the error type kept from the x-amzn-ErrorType header.
+ * Longer error types are truncated.
+ */
+#define SIGNALING_HTTP_MAX_ERROR_TYPE_LENGTH ( 64 )
+
+/**
+ * Maximum length of a header name the parser needs to recognize.
+ */
+#define SIGNALING_HTTP_MAX_HEADER_NAME_LENGTH ( 20 )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief An HTTP/1.1 response being parsed.
+ *
+ *        The response is parsed in the buffer it is received in. The status line, the headers
+ *        and the chunked framing are dropped as they are parsed and the body is moved to the
+ *        start of the buffer, so that once isComplete is set the first bodyLength bytes of the
+ *        buffer can be passed as is to the matching Signaling_Parse* API.
+ *
+ *        Only statusCode, errorType, errorTypeLength, bodyLength and isComplete are meant to be
+ *        read by the caller, the other members are the state of the parser.
+ */
+typedef struct SignalingHttpResponse
+{
+    uint16_t statusCode;
+    char errorType[ SIGNALING_HTTP_MAX_ERROR_TYPE_LENGTH ];
+    size_t errorTypeLength;
+    size_t bodyLength;
+    uint8_t isComplete;
+
+    uint8_t state;
+    uint8_t header;
+    uint8_t hasContentLength;
+    uint8_t isChunked;
+    uint8_t isValueTrimmed;
+    size_t index;
+    size_t remainingLength;
+    char headerName[ SIGNALING_HTTP_MAX_HEADER_NAME_LENGTH ];
+    size_t headerNameLength;
+} SignalingHttpResponse_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief This function is used to start parsing a response.
+ *
+ * @param[out] pResponse The response to initialize.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if pResponse is NULL.
+ */
+SignalingResult_t Signaling_HttpResponseInit( SignalingHttpResponse_t * pResponse );
+
+/**
+ * @brief This function is used to parse the next bytes of a response.
+ *
+ *        The bytes must have been received at pBuffer + pResponse->bodyLength, that is right
+ *        after the body parsed so far. When this function returns, all of them have been
+ *        parsed and the buffer holds the body parsed so far only, so the next bytes are
+ *        received at pBuffer + pResponse->bodyLength again. Bytes after the end of the
+ *        response are ignored.
+ *
+ * @param[in, out] pResponse The response.
+ * @param[in, out] pBuffer The buffer the response is received in.
+ * @param[in] dataLength The number of bytes received at pBuffer + pResponse->bodyLength.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the bytes were parsed without error. Check isComplete to know if
+ *   the response is complete.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_INVALID_HTTP_RESPONSE, if the response is malformed. The response must
+ *   be initialized again before reuse.
+ */
+SignalingResult_t Signaling_HttpResponseParse( SignalingHttpResponse_t * pResponse,
+                                               char * pBuffer,
+                                               size_t dataLength );
+
+/**
+ * @brief This function is used to tell the parser that the connection was closed. A response
+ *        without Content-Length and not chunked is complete only then.
+ *
+ * @param[in, out] pResponse The response.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the response is complete.
+ * - #SIGNALING_RESULT_BAD_PARAM, if pResponse is NULL.
+ * - #SIGNALING_RESULT_INVALID_HTTP_RESPONSE, if the response is truncated.
+ */
+SignalingResult_t Signaling_HttpResponseFinish( SignalingHttpResponse_t * pResponse );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_HTTP_H */
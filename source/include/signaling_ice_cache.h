@@ -0,0 +1,242 @@
+/**
+ * @file signaling_ice_cache.h
+ * @brief Cache of the ICE server configuration of signaling channels.
+ */
+#ifndef SIGNALING_ICE_CACHE_H
+#define SIGNALING_ICE_CACHE_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_data_types.h"
+#include "signaling_memory_barrier.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * Maximum number of ICE servers kept per channel.
+ */
+#ifndef SIGNALING_ICE_CACHE_MAX_SERVERS
+    #define SIGNALING_ICE_CACHE_MAX_SERVERS ( 5 )
+#endif
+
+/**
+ * Size of the storage of one channel, for its ARN and the strings of its ICE servers.
+ */
+#ifndef SIGNALING_ICE_CACHE_STORAGE_LENGTH
+    #define SIGNALING_ICE_CACHE_STORAGE_LENGTH ( 2048 )
+#endif
+
+/**
+ * Time after which a refresh that was handed out and never completed is handed out again.
+ */
+#ifndef SIGNALING_ICE_CACHE_REFRESH_TIMEOUT_SECONDS
+    #define SIGNALING_ICE_CACHE_REFRESH_TIMEOUT_SECONDS ( 10U )
+#endif
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A cached ICE server. The strings are given as offsets into the storage of the entry.
+ */
+typedef struct SignalingIceCacheServer
+{
+    size_t userNameOffset;
+    size_t userNameLength;
+    size_t passwordOffset;
+    size_t passwordLength;
+    size_t uriOffsets[ SIGNALING_ICE_SERVER_MAX_URIS ];
+    size_t urisLength[ SIGNALING_ICE_SERVER_MAX_URIS ];
+    uint32_t urisNum;
+    uint32_t messageTtlSeconds;
+} SignalingIceCacheServer_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief What is known about the ICE servers of one channel. The ARN is at the start of the
+ *        storage of the entry.
+ */
+typedef struct SignalingIceCacheEntryInfo
+{
+    uint8_t isUsed;
+    uint8_t hasIceServers;
+    uint8_t isRefreshing;
+    uint8_t isStale;
+    uint64_t refreshStartTimeSeconds;
+    uint64_t refreshTimeSeconds;
+    uint64_t expiryTimeSeconds;
+    size_t channelArnLength;
+    SignalingIceCacheServer_t iceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS ];
+    size_t iceServerCount;
+    size_t storageUsed;
+} SignalingIceCacheEntryInfo_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The ICE servers of one channel, with their own copy of the strings. Each entry is a
+ *        sequence lock, like SignalingCredentialHolder_t.
+ */
+typedef struct SignalingIceCacheEntry
+{
+    volatile uint32_t sequence;
+    SignalingIceCacheEntryInfo_t info;
+    char storage[ SIGNALING_ICE_CACHE_STORAGE_LENGTH ];
+} SignalingIceCacheEntry_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A cache of ICE server configurations keyed by channel ARN. Initialize it with
+ *        Signaling_IceCacheInit, the members are internal.
+ *
+ *        The ICE servers of a channel expire with the shortest TTL among them. From
+ *        refreshPercent of that TTL on, lookups ask for a refresh, while the cached servers
+ *        are still returned until they expire.
+ *
+ *        Any number of threads look up the cache without taking a lock, each getting its own
+ *        copy of the ICE servers. Signaling_IceCacheBeginRefresh, Signaling_IceCacheUpdate
+ *        and Signaling_IceCacheInvalidate change the cache, and must be called by one thread
+ *        at a time, usually the one that fetches the ICE servers.
+ */
+typedef struct SignalingIceCache
+{
+    uint32_t refreshPercent;
+    SignalingIceCacheEntry_t * pEntries;
+    size_t entryCount;
+} SignalingIceCache_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief This function is used to initialize an empty cache.
+ *
+ * @param[out] pCache The cache to initialize.
+ * @param[in] pEntries The entries of the cache, one per channel. It must stay valid as long as
+ *                     pCache is used.
+ * @param[in] entryCount The number of entries.
+ * @param[in] refreshPercent The percentage of the TTL after which the ICE servers are
+ *                           refreshed, from 1 to 100.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, entryCount is 0 or
+ *   refreshPercent is out of range.
+ */
+SignalingResult_t Signaling_IceCacheInit( SignalingIceCache_t * pCache,
+                                          SignalingIceCacheEntry_t * pEntries,
+                                          size_t entryCount,
+                                          uint32_t refreshPercent );
+
+/**
+ * @brief This function is used to look up the ICE servers of a channel, from any thread.
+ *
+ *        pShouldRefresh is set when the ICE servers are missing, stale or due for a refresh
+ *        and no refresh is in progress. The caller then hands the refresh to the thread that
+ *        changes the cache, which calls Signaling_IceCacheBeginRefresh so that only one fetch
+ *        is made.
+ *
+ * @param[in] pCache The cache.
+ * @param[in] pChannelArn The channel ARN.
+ * @param[in] currentTimeSeconds The current time, in seconds, on the clock given to
+ *                               Signaling_IceCacheUpdate.
+ * @param[out] pIceServers The ICE servers. Their strings point into pStorage.
+ * @param[in, out] pIceServerCount The size of pIceServers as input, the number of ICE
+ *                                 servers as output.
+ * @param[out] pStorage The buffer the strings of the ICE servers are copied to.
+ * @param[in] storageLength The size of pStorage. #SIGNALING_ICE_CACHE_STORAGE_LENGTH is
+ *                          always enough.
+ * @param[out] pShouldRefresh Set to 1 if the ICE servers should be refreshed, else 0.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the ICE servers were found and have not expired.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_CACHE_MISS, if the ICE servers are not cached or have expired.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pIceServers or pStorage is not enough to store the
+ *   ICE servers.
+ */
+SignalingResult_t Signaling_IceCacheGet( const SignalingIceCache_t * pCache,
+                                         const SignalingChannelArn_t * pChannelArn,
+                                         uint64_t currentTimeSeconds,
+                                         SignalingIceServer_t * pIceServers,
+                                         size_t * pIceServerCount,
+                                         char * pStorage,
+                                         size_t storageLength,
+                                         uint8_t * pShouldRefresh );
+
+/**
+ * @brief This function is used to claim the refresh of the ICE servers of a channel. At most
+ *        one refresh per channel is claimed at a time: pShouldFetch is set for the first call,
+ *        and then not until Signaling_IceCacheUpdate is called or
+ *        #SIGNALING_ICE_CACHE_REFRESH_TIMEOUT_SECONDS have passed.
+ *
+ *        A channel that is not cached is remembered in a free or expired entry. If there is
+ *        none, no entry is evicted and every call asks for a fetch.
+ *
+ * @param[in, out] pCache The cache.
+ * @param[in] pChannelArn The channel ARN.
+ * @param[in] currentTimeSeconds The current time, in seconds.
+ * @param[out] pShouldFetch Set to 1 if the caller must send GetIceServerConfig and give the
+ *                          result to Signaling_IceCacheUpdate, else 0.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the refresh was claimed or is already in progress.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ */
+SignalingResult_t Signaling_IceCacheBeginRefresh( SignalingIceCache_t * pCache,
+                                                  const SignalingChannelArn_t * pChannelArn,
+                                                  uint64_t currentTimeSeconds,
+                                                  uint8_t * pShouldFetch );
+
+/**
+ * @brief This function is used to store the ICE servers of a channel, usually parsed by
+ *        Signaling_ParseGetIceServerConfigResponse. Their strings are copied, so the response
+ *        can be freed afterwards. A channel that is not cached takes a free or expired entry,
+ *        else the entry of the channel whose ICE servers expire first.
+ *
+ * @param[in, out] pCache The cache.
+ * @param[in] pChannelArn The channel ARN.
+ * @param[in] pIceServers The ICE servers.
+ * @param[in] iceServerCount The number of ICE servers.
+ * @param[in] currentTimeSeconds The current time, in seconds.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the ICE servers were stored without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if there are more than #SIGNALING_ICE_CACHE_MAX_SERVERS
+ *   ICE servers, or the ARN and their strings don't fit in
+ *   #SIGNALING_ICE_CACHE_STORAGE_LENGTH. The cache is then left unchanged.
+ */
+SignalingResult_t Signaling_IceCacheUpdate( SignalingIceCache_t * pCache,
+                                            const SignalingChannelArn_t * pChannelArn,
+                                            const SignalingIceServer_t * pIceServers,
+                                            size_t iceServerCount,
+                                            uint64_t currentTimeSeconds );
+
+/**
+ * @brief This function is used to ask for the ICE servers of a channel to be refreshed, for
+ *        example on a #SIGNALING_TYPE_MESSAGE_RECONNECT_ICE_SERVER message. The next lookups
+ *        ask for a refresh until one is claimed, and invalidating again before it completes
+ *        does not cause another one.
+ *
+ * @param[in, out] pCache The cache.
+ * @param[in] pChannelArn The channel ARN.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the ICE servers were marked for refresh, or are not cached.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL.
+ */
+SignalingResult_t Signaling_IceCacheInvalidate( SignalingIceCache_t * pCache,
+                                                const SignalingChannelArn_t * pChannelArn );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_ICE_CACHE_H */
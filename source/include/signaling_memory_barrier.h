@@ -0,0 +1,24 @@
+/**
+ * @file signaling_memory_barrier.h
+ * @brief Memory barrier of the structures that are read by many threads without a lock.
+ */
+#ifndef SIGNALING_MEMORY_BARRIER_H
+#define SIGNALING_MEMORY_BARRIER_H
+
+/**
+ * Full memory barrier. It defaults to the GCC and Clang builtin, or to the C11 fence, and
+ * must be defined to the barrier of the compiler otherwise. There is no empty default, as
+ * the readers would then accept torn copies.
+ */
+#ifndef SIGNALING_MEMORY_BARRIER
+    #if defined( __GNUC__ )
+        #define SIGNALING_MEMORY_BARRIER()    __sync_synchronize()
+    #elif defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L ) && !defined( __STDC_NO_ATOMICS__ )
+        #include <stdatomic.h>
+        #define SIGNALING_MEMORY_BARRIER()    atomic_thread_fence( memory_order_seq_cst )
+    #else
+        #error "Define SIGNALING_MEMORY_BARRIER() to a full memory barrier of the compiler."
+    #endif
+#endif
+
+#endif /* SIGNALING_MEMORY_BARRIER_H */
@@ -0,0 +1,272 @@
+/**
+ * @file signaling_sigv4.h
+ * @brief SigV4 signing of the requests constructed by the Signaling component.
+ */
+#ifndef SIGNALING_SIGV4_H
+#define SIGNALING_SIGV4_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * Length of a SHA-256 digest.
+ */
+#define SIGNALING_SHA256_DIGEST_LENGTH ( 32 )
+
+/**
+ * Length of a SHA-256 block.
+ */
+#define SIGNALING_SHA256_BLOCK_LENGTH ( 64 )
+
+/**
+ * Length of the request date, in the ISO 8601 basic format YYYYMMDD'T'HHMMSS'Z'.
+ */
+#define SIGNALING_SIGV4_DATE_LENGTH ( 16 )
+
+/**
+ * Length of a signature, in lowercase hex.
+ */
+#define SIGNALING_SIGV4_SIGNATURE_LENGTH ( 2 * SIGNALING_SHA256_DIGEST_LENGTH )
+
+/**
+ * Maximum lifetime of a presigned URL, in seconds.
+ */
+#define SIGNALING_SIGV4_MAX_EXPIRES_SECONDS ( 604800U )
+
+/**
+ * Maximum length of the region and of the service that a signer caches a key for.
+ */
+#define SIGNALING_SIGV4_MAX_REGION_LENGTH ( 32 )
+#define SIGNALING_SIGV4_MAX_SERVICE_LENGTH ( 32 )
+
+/**
+ * Maximum number of extra headers of a request, and of query parameters in its URL.
+ */
+#define SIGNALING_SIGV4_MAX_HEADERS ( 8 )
+#define SIGNALING_SIGV4_MAX_QUERY_PARAMETERS ( 16 )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief Incremental SHA-256 state.
+ */
+typedef struct SignalingSha256
+{
+    uint32_t state[ 8 ];
+    uint64_t length;
+    uint8_t block[ SIGNALING_SHA256_BLOCK_LENGTH ];
+} SignalingSha256_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief An extra header to sign. The name must be lowercase and the value must not
+ *        have leading, trailing or repeated spaces.
+ */
+typedef struct SignalingSigV4Header
+{
+    const char * pName;
+    size_t nameLength;
+    const char * pValue;
+    size_t valueLength;
+} SignalingSigV4Header_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief The request to sign.
+ *
+ *        pUrl and pBody are usually the outputs of the Signaling_Construct* APIs. The path and
+ *        query parameters of pUrl must not be URI encoded, they are encoded while signing: a
+ *        '%' in pUrl is signed as %25. The URL of
+ *        Signaling_ConstructPresignedConnectWssEndpointRequest is already encoded and signed,
+ *        and must not be signed again. If pPayloadHash is not NULL, it is used instead of
+ *        hashing pBody, so that a body can be hashed incrementally with Signaling_Sha256Update
+ *        as it is produced.
+ *
+ *        The host and x-amz-date headers are always signed, the host being taken from pUrl.
+ */
+typedef struct SignalingSigV4Request
+{
+    const char * pMethod;
+    size_t methodLength;
+    const char * pUrl;
+    size_t urlLength;
+    const char * pBody;
+    size_t bodyLength;
+    const uint8_t * pPayloadHash;
+    const SignalingSigV4Header_t * pHeaders;
+    size_t headerCount;
+} SignalingSigV4Request_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief A signer, caching the signing key of the last date, region, service and secret
+ *        access key it signed for. The secret access key is only kept as a digest.
+ */
+typedef struct SignalingSigV4Signer
+{
+    uint8_t isKeyCached;
+    char date[ 8 ];
+    char region[ SIGNALING_SIGV4_MAX_REGION_LENGTH ];
+    size_t regionLength;
+    char service[ SIGNALING_SIGV4_MAX_SERVICE_LENGTH ];
+    size_t serviceLength;
+    uint8_t secretAccessKeyDigest[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    uint8_t signingKey[ SIGNALING_SHA256_DIGEST_LENGTH ];
+} SignalingSigV4Signer_t;
+
+/**
+ * @ingroup signaling_enum_types
+ * @brief What a presigned URL is signed with.
+ */
+typedef struct SignalingSigV4PresignInfo
+{
+    SignalingSigV4Signer_t * pSigner;
+    const SignalingCredential_t * pCredential;
+    const SignalingAwsRegion_t * pAwsRegion;
+    const char * pDate;
+    uint32_t expiresSeconds;
+} SignalingSigV4PresignInfo_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief This function is used to start a SHA-256 digest.
+ *
+ * @param[out] pSha256 The state to initialize.
+ */
+void Signaling_Sha256Init( SignalingSha256_t * pSha256 );
+
+/**
+ * @brief This function is used to add data to a SHA-256 digest.
+ *
+ * @param[in, out] pSha256 The state.
+ * @param[in] pData The data.
+ * @param[in] dataLength Length of the data.
+ */
+void Signaling_Sha256Update( SignalingSha256_t * pSha256,
+                             const void * pData,
+                             size_t dataLength );
+
+/**
+ * @brief This function is used to finish a SHA-256 digest.
+ *
+ * @param[in, out] pSha256 The state. It must be initialized again before reuse.
+ * @param[out] pDigest The digest, #SIGNALING_SHA256_DIGEST_LENGTH bytes.
+ */
+void Signaling_Sha256Final( SignalingSha256_t * pSha256,
+                            uint8_t * pDigest );
+
+/**
+ * @brief This function is used to compute HMAC-SHA256.
+ *
+ * @param[in] pKey The key.
+ * @param[in] keyLength Length of the key.
+ * @param[in] pData The data.
+ * @param[in] dataLength Length of the data.
+ * @param[out] pMac The MAC, #SIGNALING_SHA256_DIGEST_LENGTH bytes.
+ */
+void Signaling_HmacSha256( const uint8_t * pKey,
+                           size_t keyLength,
+                           const void * pData,
+                           size_t dataLength,
+                           uint8_t * pMac );
+
+/**
+ * @brief This function is used to initialize a signer, with nothing cached.
+ *
+ * @param[out] pSigner The signer to initialize.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if initialization was performed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if pSigner is NULL.
+ */
+SignalingResult_t Signaling_SigV4Init( SignalingSigV4Signer_t * pSigner );
+
+/**
+ * @brief This function is used to sign a request with SigV4 and construct the value of its
+ *        Authorization header. The request must be sent with the same x-amz-date header, and
+ *        with the x-amz-security-token header if the credential has a session token.
+ *
+ * @param[in, out] pSigner The signer. Its signing key is derived again only when the date,
+ *                         region, service or secret access key changes.
+ * @param[in] pCredential The credential. Only the access key ID and the secret access key are used.
+ * @param[in] pAwsRegion The AWS region.
+ * @param[in] pService The service, for example "kinesisvideo".
+ * @param[in] serviceLength Length of the service.
+ * @param[in] pDate The request date, #SIGNALING_SIGV4_DATE_LENGTH characters in the ISO 8601 basic format.
+ * @param[in] pRequest The request to sign.
+ * @param[out] pAuthorization The buffer to store the Authorization header value.
+ * @param[in, out] pAuthorizationLength The size of pAuthorization as input, the length of the
+ *                                      constructed value as output.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the request was signed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, the date is malformed, the
+ *   service is too long, or the request has too many headers or query parameters.
+ * - #SIGNALING_RESULT_REGION_LENGTH_TOO_LARGE, if the region is longer than #SIGNALING_SIGV4_MAX_REGION_LENGTH.
+ * - #SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE, if the secret access key is longer
+ *   than #SECRET_ACCESS_KEY_MAX_LEN.
+ * - #SIGNALING_RESULT_INVALID_URL, if the URL has no scheme or host.
+ * - #SIGNALING_RESULT_OUT_OF_MEMORY, if pAuthorization is not enough to store the value.
+ *
+ * @note Refer to https://docs.aws.amazon.com/IAM/latest/UserGuide/create-signed-request.html for details.
+ */
+SignalingResult_t Signaling_SigV4SignRequest( SignalingSigV4Signer_t * pSigner,
+                                              const SignalingCredential_t * pCredential,
+                                              const SignalingAwsRegion_t * pAwsRegion,
+                                              const char * pService,
+                                              size_t serviceLength,
+                                              const char * pDate,
+                                              const SignalingSigV4Request_t * pRequest,
+                                              char * pAuthorization,
+                                              size_t * pAuthorizationLength );
+
+/**
+ * @brief This function is used to sign a canonical request that the caller hashed itself,
+ *        for example the canonical request of a presigned URL.
+ *
+ * @param[in, out] pSigner The signer. Its signing key is derived again only when the date,
+ *                         region, service or secret access key changes.
+ * @param[in] pCredential The credential. Only the secret access key is used.
+ * @param[in] pAwsRegion The AWS region.
+ * @param[in] pService The service, for example "kinesisvideo".
+ * @param[in] serviceLength Length of the service.
+ * @param[in] pDate The request date, #SIGNALING_SIGV4_DATE_LENGTH characters in the ISO 8601 basic format.
+ * @param[in] pCanonicalRequestHash The SHA-256 digest of the canonical request.
+ * @param[out] pSignature The signature, #SIGNALING_SIGV4_SIGNATURE_LENGTH lowercase hex
+ *                        characters, not null terminated.
+ *
+ * @return Returns one of the following:
+ * - #SIGNALING_RESULT_OK, if the canonical request was signed without error.
+ * - #SIGNALING_RESULT_BAD_PARAM, if any mandatory parameters is NULL, the date is malformed or
+ *   the service is too long.
+ * - #SIGNALING_RESULT_REGION_LENGTH_TOO_LARGE, if the region is longer than #SIGNALING_SIGV4_MAX_REGION_LENGTH.
+ * - #SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE, if the secret access key is longer
+ *   than #SECRET_ACCESS_KEY_MAX_LEN.
+ */
+SignalingResult_t Signaling_SigV4Sign( SignalingSigV4Signer_t * pSigner,
+                                       const SignalingCredential_t * pCredential,
+                                       const SignalingAwsRegion_t * pAwsRegion,
+                                       const char * pService,
+                                       size_t serviceLength,
+                                       const char * pDate,
+                                       const uint8_t * pCanonicalRequestHash,
+                                       char * pSignature );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_SIGV4_H */
@@ -1,14 +1,48 @@
 /* Standard includes. */
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 /* API includes. */
 #include "signaling_api.h"
+#include "signaling_internal.h"
 
 /* CoreJSON includes. */
 #include "core_json.h"
 
+/*
+ * Select the backend used to skip over the contents of JSON strings. The
+ * vector backends are picked from the target the compiler builds for and can
+ * be turned off by defining SIGNALING_DISABLE_SIMD, in which case the scalar
+ * loop is used. All backends produce identical results.
+ */
+#if !defined( SIGNALING_DISABLE_SIMD ) && defined( __AVX2__ )
+    #include <immintrin.h>
+    #define SIGNALING_JSON_SCAN_AVX2
+#elif !defined( SIGNALING_DISABLE_SIMD ) && defined( __SSE2__ )
+    #include <emmintrin.h>
+    #define SIGNALING_JSON_SCAN_SSE2
+#elif !defined( SIGNALING_DISABLE_SIMD ) && defined( __aarch64__ ) && defined( __ARM_NEON )
+    #include <arm_neon.h>
+    #define SIGNALING_JSON_SCAN_NEON
+#endif
+
+/* Select the backend of the base64 codec. SSE2 has no byte shuffle, so only
+ * AVX2 and NEON have a vector path. */
+#if defined( SIGNALING_JSON_SCAN_AVX2 )
+    #define SIGNALING_BASE64_AVX2
+#elif defined( SIGNALING_JSON_SCAN_NEON )
+    #define SIGNALING_BASE64_NEON
+#endif
+
+/*
+ * The responses of DescribeSignalingChannel, GetSignalingChannelEndpoint and
+ * GetIceServerConfig come from the service over TLS. Defining
+ * SIGNALING_TRUST_CONTROL_PLANE_RESPONSES skips validating the whole response
+ * before extracting from it. Extraction stays bounded by messageLength, so a
+ * malformed response can only yield missing or partial fields, never an
+ * out of bounds read.
+ */
+
 /**
  * Helper macro to check if the AWS region is China region.
  */
@@ -16,16 +50,390 @@
         ( ( ( pAwsRegion )->awsRegionLength >= 3 ) &&   \
           ( strncmp( "cn-", ( pAwsRegion )->pAwsRegion, 3 ) == 0 ) )
 
-/* Longest protocol string is is "WSS","HTTPS","WEBRTC". */
-#define SIGNALING_GET_ENDPOINT_PROTOCOL_MAX_STRING_LENGTH    ( 23 ) /* Includes NULL terminator. */
+#define SIGNALING_APPEND_LITERAL( pWriter, pLiteral ) \
+    AppendToWriter( ( pWriter ), ( pLiteral ), SIGNALING_LITERAL_LENGTH( pLiteral ) )
+
+/* Service name the connect URL is presigned for. */
+#define SIGNALING_KVS_SERVICE_NAME                           "kinesisvideo"
+
+/* Hex SHA-256 of an empty payload, the payload of a presigned URL. */
+#define SIGNALING_EMPTY_PAYLOAD_HASH                         "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"
+
+/* Maximum nesting depth accepted by the single-pass JSON scanner. It matches
+ * the default JSON_MAX_DEPTH of coreJSON. */
+#define SIGNALING_JSON_MAX_DEPTH                             ( 32 )
+
+#define SIGNALING_IS_JSON_SPACE( c ) \
+        ( ( ( c ) == ' ' ) || ( ( c ) == '\t' ) || ( ( c ) == '\n' ) || ( ( c ) == '\r' ) )
+
+#define SIGNALING_IS_JSON_DIGIT( c ) \
+        ( ( ( c ) >= '0' ) && ( ( c ) <= '9' ) )
+
+/* Number of slots in the JSON token perfect hash table. Must be a power of 2. */
+#define SIGNALING_JSON_TOKEN_HASH_SLOTS                      ( 256U )
+
+/* Shortest and longest strings in the JSON token table. */
+#define SIGNALING_JSON_TOKEN_MIN_LENGTH                      ( 3U )
+#define SIGNALING_JSON_TOKEN_MAX_LENGTH                      ( 25U )
+
+/*
+ * Perfect hash over every key and enumerated value the parsers look for. The
+ * length together with the first and the second to last character is unique
+ * across the token set, and the multipliers were chosen so that no two
+ * tokens share a slot. Adding a token requires checking that its slot in
+ * gJsonTokenSlots is still free, and picking new multipliers otherwise.
+ */
+#define SIGNALING_JSON_TOKEN_HASH( pString, length )                                 \
+        ( ( ( length ) +                                                             \
+            ( ( ( uint32_t ) ( uint8_t ) ( pString )[ 0 ] ) * 8U ) +                 \
+            ( ( ( uint32_t ) ( uint8_t ) ( pString )[ ( length ) - 2U ] ) * 7U ) ) & \
+          ( SIGNALING_JSON_TOKEN_HASH_SLOTS - 1U ) )
+
+/*-----------------------------------------------------------*/
+
+/* Keys and enumerated values recognized by the parsers. */
+typedef enum SignalingJsonToken
+{
+    SIGNALING_JSON_TOKEN_UNKNOWN = 0,
+    SIGNALING_JSON_TOKEN_CHANNEL_INFO,
+    SIGNALING_JSON_TOKEN_CHANNEL_ARN,
+    SIGNALING_JSON_TOKEN_CHANNEL_NAME,
+    SIGNALING_JSON_TOKEN_CHANNEL_STATUS,
+    SIGNALING_JSON_TOKEN_CHANNEL_TYPE,
+    SIGNALING_JSON_TOKEN_CREATION_TIME,
+    SIGNALING_JSON_TOKEN_SINGLE_MASTER_CONFIGURATION,
+    SIGNALING_JSON_TOKEN_MESSAGE_TTL_SECONDS,
+    SIGNALING_JSON_TOKEN_VERSION,
+    SIGNALING_JSON_TOKEN_CREDENTIALS,
+    SIGNALING_JSON_TOKEN_ACCESS_KEY_ID,
+    SIGNALING_JSON_TOKEN_SECRET_ACCESS_KEY,
+    SIGNALING_JSON_TOKEN_SESSION_TOKEN,
+    SIGNALING_JSON_TOKEN_EXPIRATION,
+    SIGNALING_JSON_TOKEN_MEDIA_STORAGE_CONFIGURATION,
+    SIGNALING_JSON_TOKEN_STATUS,
+    SIGNALING_JSON_TOKEN_STREAM_ARN,
+    SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT_LIST,
+    SIGNALING_JSON_TOKEN_PROTOCOL,
+    SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT,
+    SIGNALING_JSON_TOKEN_ICE_SERVER_LIST,
+    SIGNALING_JSON_TOKEN_PASSWORD,
+    SIGNALING_JSON_TOKEN_TTL,
+    SIGNALING_JSON_TOKEN_URIS,
+    SIGNALING_JSON_TOKEN_USERNAME,
+    SIGNALING_JSON_TOKEN_SENDER_CLIENT_ID,
+    SIGNALING_JSON_TOKEN_MESSAGE_TYPE,
+    SIGNALING_JSON_TOKEN_MESSAGE_PAYLOAD,
+    SIGNALING_JSON_TOKEN_STATUS_RESPONSE,
+    SIGNALING_JSON_TOKEN_CORRELATION_ID,
+    SIGNALING_JSON_TOKEN_ERROR_TYPE,
+    SIGNALING_JSON_TOKEN_STATUS_CODE,
+    SIGNALING_JSON_TOKEN_DESCRIPTION,
+    SIGNALING_JSON_TOKEN_TYPE,
+    SIGNALING_JSON_TOKEN_SDP,
+    SIGNALING_JSON_TOKEN_CANDIDATE,
+    SIGNALING_JSON_TOKEN_SDP_MID,
+    SIGNALING_JSON_TOKEN_SDP_M_LINE_INDEX,
+    SIGNALING_JSON_TOKEN_VALUE_SINGLE_MASTER,
+    SIGNALING_JSON_TOKEN_VALUE_SDP_OFFER,
+    SIGNALING_JSON_TOKEN_VALUE_SDP_ANSWER,
+    SIGNALING_JSON_TOKEN_VALUE_ICE_CANDIDATE,
+    SIGNALING_JSON_TOKEN_VALUE_GO_AWAY,
+    SIGNALING_JSON_TOKEN_VALUE_RECONNECT_ICE_SERVER,
+    SIGNALING_JSON_TOKEN_VALUE_STATUS_RESPONSE,
+    SIGNALING_JSON_TOKEN_VALUE_WSS,
+    SIGNALING_JSON_TOKEN_VALUE_WSS_LOWER,
+    SIGNALING_JSON_TOKEN_VALUE_HTTPS,
+    SIGNALING_JSON_TOKEN_VALUE_HTTPS_LOWER,
+    SIGNALING_JSON_TOKEN_VALUE_WEBRTC,
+    SIGNALING_JSON_TOKEN_VALUE_WEBRTC_LOWER,
+    SIGNALING_JSON_TOKEN_MAX,
+} SignalingJsonToken_t;
+
+typedef struct SignalingJsonTokenString
+{
+    const char * pString;
+    size_t length;
+} SignalingJsonTokenString_t;
+
+static const SignalingJsonTokenString_t gJsonTokenStrings[ SIGNALING_JSON_TOKEN_MAX ] =
+{
+    [ SIGNALING_JSON_TOKEN_UNKNOWN ]                     = { NULL, 0 },
+    [ SIGNALING_JSON_TOKEN_CHANNEL_INFO ]                = { "ChannelInfo", 11 },
+    [ SIGNALING_JSON_TOKEN_CHANNEL_ARN ]                 = { "ChannelARN", 10 },
+    [ SIGNALING_JSON_TOKEN_CHANNEL_NAME ]                = { "ChannelName", 11 },
+    [ SIGNALING_JSON_TOKEN_CHANNEL_STATUS ]              = { "ChannelStatus", 13 },
+    [ SIGNALING_JSON_TOKEN_CHANNEL_TYPE ]                = { "ChannelType", 11 },
+    [ SIGNALING_JSON_TOKEN_CREATION_TIME ]               = { "CreationTime", 12 },
+    [ SIGNALING_JSON_TOKEN_SINGLE_MASTER_CONFIGURATION ] = { "SingleMasterConfiguration", 25 },
+    [ SIGNALING_JSON_TOKEN_MESSAGE_TTL_SECONDS ]         = { "MessageTtlSeconds", 17 },
+    [ SIGNALING_JSON_TOKEN_VERSION ]                     = { "Version", 7 },
+    [ SIGNALING_JSON_TOKEN_CREDENTIALS ]                 = { "credentials", 11 },
+    [ SIGNALING_JSON_TOKEN_ACCESS_KEY_ID ]               = { "accessKeyId", 11 },
+    [ SIGNALING_JSON_TOKEN_SECRET_ACCESS_KEY ]           = { "secretAccessKey", 15 },
+    [ SIGNALING_JSON_TOKEN_SESSION_TOKEN ]               = { "sessionToken", 12 },
+    [ SIGNALING_JSON_TOKEN_EXPIRATION ]                  = { "expiration", 10 },
+    [ SIGNALING_JSON_TOKEN_MEDIA_STORAGE_CONFIGURATION ] = { "MediaStorageConfiguration", 25 },
+    [ SIGNALING_JSON_TOKEN_STATUS ]                      = { "Status", 6 },
+    [ SIGNALING_JSON_TOKEN_STREAM_ARN ]                  = { "StreamARN", 9 },
+    [ SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT_LIST ]      = { "ResourceEndpointList", 20 },
+    [ SIGNALING_JSON_TOKEN_PROTOCOL ]                    = { "Protocol", 8 },
+    [ SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT ]           = { "ResourceEndpoint", 16 },
+    [ SIGNALING_JSON_TOKEN_ICE_SERVER_LIST ]             = { "IceServerList", 13 },
+    [ SIGNALING_JSON_TOKEN_PASSWORD ]                    = { "Password", 8 },
+    [ SIGNALING_JSON_TOKEN_TTL ]                         = { "Ttl", 3 },
+    [ SIGNALING_JSON_TOKEN_URIS ]                        = { "Uris", 4 },
+    [ SIGNALING_JSON_TOKEN_USERNAME ]                    = { "Username", 8 },
+    [ SIGNALING_JSON_TOKEN_SENDER_CLIENT_ID ]            = { "senderClientId", 14 },
+    [ SIGNALING_JSON_TOKEN_MESSAGE_TYPE ]                = { "messageType", 11 },
+    [ SIGNALING_JSON_TOKEN_MESSAGE_PAYLOAD ]             = { "messagePayload", 14 },
+    [ SIGNALING_JSON_TOKEN_STATUS_RESPONSE ]             = { "statusResponse", 14 },
+    [ SIGNALING_JSON_TOKEN_CORRELATION_ID ]              = { "correlationId", 13 },
+    [ SIGNALING_JSON_TOKEN_ERROR_TYPE ]                  = { "errorType", 9 },
+    [ SIGNALING_JSON_TOKEN_STATUS_CODE ]                 = { "statusCode", 10 },
+    [ SIGNALING_JSON_TOKEN_DESCRIPTION ]                 = { "description", 11 },
+    [ SIGNALING_JSON_TOKEN_TYPE ]                        = { "type", 4 },
+    [ SIGNALING_JSON_TOKEN_SDP ]                         = { "sdp", 3 },
+    [ SIGNALING_JSON_TOKEN_CANDIDATE ]                   = { "candidate", 9 },
+    [ SIGNALING_JSON_TOKEN_SDP_MID ]                     = { "sdpMid", 6 },
+    [ SIGNALING_JSON_TOKEN_SDP_M_LINE_INDEX ]            = { "sdpMLineIndex", 13 },
+    [ SIGNALING_JSON_TOKEN_VALUE_SINGLE_MASTER ]         = { "SINGLE_MASTER", 13 },
+    [ SIGNALING_JSON_TOKEN_VALUE_SDP_OFFER ]             = { "SDP_OFFER", 9 },
+    [ SIGNALING_JSON_TOKEN_VALUE_SDP_ANSWER ]            = { "SDP_ANSWER", 10 },
+    [ SIGNALING_JSON_TOKEN_VALUE_ICE_CANDIDATE ]         = { "ICE_CANDIDATE", 13 },
+    [ SIGNALING_JSON_TOKEN_VALUE_GO_AWAY ]               = { "GO_AWAY", 7 },
+    [ SIGNALING_JSON_TOKEN_VALUE_RECONNECT_ICE_SERVER ]  = { "RECONNECT_ICE_SERVER", 20 },
+    [ SIGNALING_JSON_TOKEN_VALUE_STATUS_RESPONSE ]       = { "STATUS_RESPONSE", 15 },
+    [ SIGNALING_JSON_TOKEN_VALUE_WSS ]                   = { "WSS", 3 },
+    [ SIGNALING_JSON_TOKEN_VALUE_WSS_LOWER ]             = { "wss", 3 },
+    [ SIGNALING_JSON_TOKEN_VALUE_HTTPS ]                 = { "HTTPS", 5 },
+    [ SIGNALING_JSON_TOKEN_VALUE_HTTPS_LOWER ]           = { "https", 5 },
+    [ SIGNALING_JSON_TOKEN_VALUE_WEBRTC ]                = { "WEBRTC", 6 },
+    [ SIGNALING_JSON_TOKEN_VALUE_WEBRTC_LOWER ]          = { "webrtc", 6 },
+};
+
+/* Maps a hash slot to the only token that can live in it. Unused slots are
+ * SIGNALING_JSON_TOKEN_UNKNOWN. */
+static const uint8_t gJsonTokenSlots[ SIGNALING_JSON_TOKEN_HASH_SLOTS ] =
+{
+    [   0 ] = SIGNALING_JSON_TOKEN_VALUE_WSS,
+    [   6 ] = SIGNALING_JSON_TOKEN_VALUE_GO_AWAY,
+    [  10 ] = SIGNALING_JSON_TOKEN_VALUE_WEBRTC,
+    [  18 ] = SIGNALING_JSON_TOKEN_ACCESS_KEY_ID,
+    [  23 ] = SIGNALING_JSON_TOKEN_CREDENTIALS,
+    [  29 ] = SIGNALING_JSON_TOKEN_MESSAGE_PAYLOAD,
+    [  30 ] = SIGNALING_JSON_TOKEN_CHANNEL_NAME,
+    [  31 ] = SIGNALING_JSON_TOKEN_CREATION_TIME,
+    [  36 ] = SIGNALING_JSON_TOKEN_CORRELATION_ID,
+    [  51 ] = SIGNALING_JSON_TOKEN_CHANNEL_TYPE,
+    [  52 ] = SIGNALING_JSON_TOKEN_DESCRIPTION,
+    [  53 ] = SIGNALING_JSON_TOKEN_MESSAGE_TTL_SECONDS,
+    [  59 ] = SIGNALING_JSON_TOKEN_EXPIRATION,
+    [  65 ] = SIGNALING_JSON_TOKEN_ERROR_TYPE,
+    [  77 ] = SIGNALING_JSON_TOKEN_CANDIDATE,
+    [  85 ] = SIGNALING_JSON_TOKEN_VALUE_HTTPS_LOWER,
+    [  87 ] = SIGNALING_JSON_TOKEN_SDP,
+    [  88 ] = SIGNALING_JSON_TOKEN_CHANNEL_STATUS,
+    [  94 ] = SIGNALING_JSON_TOKEN_STATUS_CODE,
+    [  96 ] = SIGNALING_JSON_TOKEN_CHANNEL_ARN,
+    [ 103 ] = SIGNALING_JSON_TOKEN_SESSION_TOKEN,
+    [ 104 ] = SIGNALING_JSON_TOKEN_SDP_M_LINE_INDEX,
+    [ 106 ] = SIGNALING_JSON_TOKEN_SECRET_ACCESS_KEY,
+    [ 117 ] = SIGNALING_JSON_TOKEN_VALUE_HTTPS,
+    [ 122 ] = SIGNALING_JSON_TOKEN_ICE_SERVER_LIST,
+    [ 125 ] = SIGNALING_JSON_TOKEN_SDP_MID,
+    [ 131 ] = SIGNALING_JSON_TOKEN_MESSAGE_TYPE,
+    [ 132 ] = SIGNALING_JSON_TOKEN_VALUE_SDP_OFFER,
+    [ 133 ] = SIGNALING_JSON_TOKEN_VALUE_SDP_ANSWER,
+    [ 135 ] = SIGNALING_JSON_TOKEN_VALUE_RECONNECT_ICE_SERVER,
+    [ 136 ] = SIGNALING_JSON_TOKEN_VALUE_SINGLE_MASTER,
+    [ 138 ] = SIGNALING_JSON_TOKEN_MEDIA_STORAGE_CONFIGURATION,
+    [ 139 ] = SIGNALING_JSON_TOKEN_URIS,
+    [ 145 ] = SIGNALING_JSON_TOKEN_PROTOCOL,
+    [ 161 ] = SIGNALING_JSON_TOKEN_VALUE_ICE_CANDIDATE,
+    [ 162 ] = SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT,
+    [ 165 ] = SIGNALING_JSON_TOKEN_SENDER_CLIENT_ID,
+    [ 166 ] = SIGNALING_JSON_TOKEN_PASSWORD,
+    [ 171 ] = SIGNALING_JSON_TOKEN_USERNAME,
+    [ 180 ] = SIGNALING_JSON_TOKEN_TYPE,
+    [ 186 ] = SIGNALING_JSON_TOKEN_SINGLE_MASTER_CONFIGURATION,
+    [ 192 ] = SIGNALING_JSON_TOKEN_VERSION,
+    [ 201 ] = SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT_LIST,
+    [ 203 ] = SIGNALING_JSON_TOKEN_STATUS_RESPONSE,
+    [ 207 ] = SIGNALING_JSON_TOKEN_TTL,
+    [ 209 ] = SIGNALING_JSON_TOKEN_STATUS,
+    [ 223 ] = SIGNALING_JSON_TOKEN_STREAM_ARN,
+    [ 224 ] = SIGNALING_JSON_TOKEN_VALUE_WSS_LOWER,
+    [ 234 ] = SIGNALING_JSON_TOKEN_VALUE_WEBRTC_LOWER,
+    [ 236 ] = SIGNALING_JSON_TOKEN_VALUE_STATUS_RESPONSE,
+    [ 237 ] = SIGNALING_JSON_TOKEN_CHANNEL_INFO,
+};
+
+/*-----------------------------------------------------------*/
+
+/* Base64 alphabet of RFC 4648, section 4. */
+static const char gBase64Alphabet[ 64 ] =
+{
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/',
+};
+
+/* Value of every base64 character, 0xFF for bytes outside the alphabet. */
+static const uint8_t gBase64DecodeTable[ 256 ] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
 
 /*-----------------------------------------------------------*/
 
-static SignalingResult_t InterpretSnprintfReturnValue( int snprintfRetVal,
-                                                       size_t bufferLength );
+/* Grammar states of the resumable event message parser. */
+typedef enum WssRecvStreamState
+{
+    WSS_RECV_STREAM_STATE_BEGIN = 0,    /* Expect the opening brace of the message. */
+    WSS_RECV_STREAM_STATE_KEY_OR_END,   /* After an opening brace. */
+    WSS_RECV_STREAM_STATE_KEY,          /* After a comma in an object. */
+    WSS_RECV_STREAM_STATE_COLON,        /* After a key. */
+    WSS_RECV_STREAM_STATE_VALUE_OR_END, /* After an opening bracket. */
+    WSS_RECV_STREAM_STATE_VALUE,        /* After a colon, or a comma in an array. */
+    WSS_RECV_STREAM_STATE_COMMA_OR_END, /* After a value. */
+    WSS_RECV_STREAM_STATE_STRING,
+    WSS_RECV_STREAM_STATE_NUMBER,
+    WSS_RECV_STREAM_STATE_LITERAL,
+    WSS_RECV_STREAM_STATE_DONE,         /* After the closing brace of the message. */
+    WSS_RECV_STREAM_STATE_TERMINATED,   /* After the null terminator of the message. */
+} WssRecvStreamState_t;
+
+/* Position inside an escape sequence of a string. */
+typedef enum WssRecvStreamEscape
+{
+    WSS_RECV_STREAM_ESCAPE_NONE = 0,
+    WSS_RECV_STREAM_ESCAPE_BACKSLASH,     /* After a backslash. */
+    WSS_RECV_STREAM_ESCAPE_HEX,           /* Inside the digits of \uXXXX. */
+    WSS_RECV_STREAM_ESCAPE_LOW_BACKSLASH, /* After a high surrogate, expect a backslash. */
+    WSS_RECV_STREAM_ESCAPE_LOW_U,         /* After a high surrogate, expect 'u'. */
+    WSS_RECV_STREAM_ESCAPE_LOW_HEX,       /* Inside the digits of the low surrogate. */
+} WssRecvStreamEscape_t;
+
+/* Position inside a number, named after the last part read. */
+typedef enum WssRecvStreamNumber
+{
+    WSS_RECV_STREAM_NUMBER_MINUS = 0,
+    WSS_RECV_STREAM_NUMBER_ZERO,
+    WSS_RECV_STREAM_NUMBER_INTEGER,
+    WSS_RECV_STREAM_NUMBER_DOT,
+    WSS_RECV_STREAM_NUMBER_FRACTION,
+    WSS_RECV_STREAM_NUMBER_EXPONENT,
+    WSS_RECV_STREAM_NUMBER_EXPONENT_SIGN,
+    WSS_RECV_STREAM_NUMBER_EXPONENT_DIGITS,
+} WssRecvStreamNumber_t;
+
+/* Members of the event message the resumable parser reports. */
+typedef enum WssRecvStreamField
+{
+    WSS_RECV_STREAM_FIELD_NONE = 0,
+    WSS_RECV_STREAM_FIELD_SENDER_CLIENT_ID,
+    WSS_RECV_STREAM_FIELD_MESSAGE_TYPE,
+    WSS_RECV_STREAM_FIELD_MESSAGE_PAYLOAD,
+    WSS_RECV_STREAM_FIELD_STATUS_RESPONSE,
+    WSS_RECV_STREAM_FIELD_CORRELATION_ID,
+    WSS_RECV_STREAM_FIELD_ERROR_TYPE,
+    WSS_RECV_STREAM_FIELD_STATUS_CODE,
+    WSS_RECV_STREAM_FIELD_DESCRIPTION,
+} WssRecvStreamField_t;
+
+/* Bounded append writer used to construct requests and messages. Appends are
+ * copied while they fit and always counted, so running out of space is
+ * checked once, when the writer is finished. A writer without a buffer only
+ * counts, which is how a size query gets its sizes. */
+typedef struct SignalingWriter
+{
+    char * pBuffer;
+    size_t bufferLength;
+    size_t length;
+} SignalingWriter_t;
+
+/*-----------------------------------------------------------*/
 
 static char * GetStringFromMessageType( SignalingTypeMessage_t messageType );
 
+static void InitWriter( SignalingWriter_t * pWriter,
+                        char * pBuffer,
+                        size_t bufferLength );
+
+static void AppendToWriter( SignalingWriter_t * pWriter,
+                            const char * pData,
+                            size_t dataLength );
+
+static size_t FindJsonEscape( const char * pData,
+                              size_t index,
+                              size_t dataLength );
+
+static void AppendEscapedToWriter( SignalingWriter_t * pWriter,
+                                   const char * pData,
+                                   size_t dataLength );
+
+static void AppendToWriterSink( void * pContext,
+                                const char * pData,
+                                size_t dataLength );
+
+static void AppendUriEncodedToWriter( SignalingWriter_t * pWriter,
+                                      const char * pData,
+                                      size_t dataLength );
+
+static void AppendDecimalToWriter( SignalingWriter_t * pWriter,
+                                   uint32_t value );
+
+static void AppendBase64ToWriter( SignalingWriter_t * pWriter,
+                                  const char * pInput,
+                                  size_t inputLength );
+
+static SignalingResult_t FinishWriter( SignalingWriter_t * pWriter,
+                                       size_t * pLength );
+
+static void MaskWssPayload( uint8_t * pPayload,
+                            size_t payloadLength,
+                            const uint8_t * pMaskingKey );
+
+static void AppendControlPlaneUrl( SignalingWriter_t * pWriter,
+                                   const SignalingAwsRegion_t * pAwsRegion );
+
+static SignalingResult_t ValidateHttpRequest( const SignalingRequest_t * pRequest,
+                                              const SignalingHttpRequestInfo_t * pHttpRequestInfo );
+
+static void AppendHttpHeadersToWriter( SignalingWriter_t * pWriter,
+                                       const SignalingRequest_t * pRequest,
+                                       const SignalingHttpRequestInfo_t * pHttpRequestInfo );
+
+static void InitRequestWriters( SignalingRequest_t * pRequestBuffer,
+                                SignalingWriter_t * pUrlWriter,
+                                SignalingWriter_t * pBodyWriter );
+
+static SignalingResult_t FinishRequestWriters( SignalingRequest_t * pRequestBuffer,
+                                               SignalingWriter_t * pUrlWriter,
+                                               SignalingWriter_t * pBodyWriter );
+
+static SignalingJsonToken_t LookupJsonToken( const char * pString,
+                                             size_t length );
+
+static SignalingTypeMessage_t GetMessageTypeFromString( const char * pString,
+                                                        size_t length );
+
 static void ParseUris( const char * pUris,
                        size_t urisLength,
                        SignalingIceServer_t * pIceServer );
@@ -35,30 +443,143 @@ static SignalingResult_t ParseIceServerList( const char * pIceServerListBuffer,
                                              SignalingIceServer_t * pIceServers,
                                              size_t * pNumIceServers );
 
-/*-----------------------------------------------------------*/
+static SignalingResult_t ParseSingleMasterConfiguration( const char * pConfigBuffer,
+                                                         size_t configBufferLength,
+                                                         SignalingChannelInfo_t * pChannelInfo );
 
-static SignalingResult_t InterpretSnprintfReturnValue( int snprintfRetVal,
-                                                       size_t bufferLength )
-{
-    SignalingResult_t result;
+static SignalingResult_t ParseWssRecvMessage( const char * pMessage,
+                                              size_t messageLength,
+                                              WssRecvMessage_t * pWssRecvMessage );
 
-    /* LCOV_EXCL_START */
-    if( snprintfRetVal < 0 )
-    {
-        result = SIGNALING_RESULT_SNPRINTF_ERROR;
-    }
-    /* LCOV_EXCL_STOP  */
-    else if( ( size_t ) snprintfRetVal >= bufferLength )
-    {
-        result = SIGNALING_RESULT_OUT_OF_MEMORY;
-    }
-    else
-    {
-        result = SIGNALING_RESULT_OK;
-    }
+static void SkipJsonSpace( const char * pBuffer,
+                           size_t * pIndex,
+                           size_t bufferLength );
 
-    return result;
-}
+static JSONStatus_t SkipJsonUtf8( const char * pBuffer,
+                                  size_t * pIndex,
+                                  size_t bufferLength );
+
+static JSONStatus_t ReadJsonHexEscape( const char * pBuffer,
+                                       size_t * pIndex,
+                                       size_t bufferLength,
+                                       uint16_t * pValue );
+
+static JSONStatus_t SkipJsonEscape( const char * pBuffer,
+                                    size_t * pIndex,
+                                    size_t bufferLength );
+
+#if defined( SIGNALING_JSON_SCAN_AVX2 ) || defined( SIGNALING_JSON_SCAN_SSE2 ) || defined( SIGNALING_JSON_SCAN_NEON )
+    static size_t CountTrailingZeros( uint64_t value );
+#endif
+
+static size_t ScanJsonStringRun( const char * pBuffer,
+                                 size_t index,
+                                 size_t bufferLength );
+
+static JSONStatus_t SkipJsonString( const char * pBuffer,
+                                    size_t * pIndex,
+                                    size_t bufferLength );
+
+static JSONStatus_t SkipJsonNumber( const char * pBuffer,
+                                    size_t * pIndex,
+                                    size_t bufferLength );
+
+static JSONStatus_t SkipJsonLiteral( const char * pBuffer,
+                                     size_t * pIndex,
+                                     size_t bufferLength,
+                                     const char * pLiteral,
+                                     size_t literalLength );
+
+static JSONStatus_t SkipJsonCollection( const char * pBuffer,
+                                        size_t * pIndex,
+                                        size_t bufferLength,
+                                        size_t depth );
+
+static JSONStatus_t SkipJsonValue( const char * pBuffer,
+                                   size_t * pIndex,
+                                   size_t bufferLength,
+                                   size_t depth,
+                                   JSONTypes_t * pJsonType );
+
+static JSONStatus_t IterateValidatedObject( const char * pBuffer,
+                                            size_t bufferLength,
+                                            size_t * pStart,
+                                            size_t * pNext,
+                                            JSONPair_t * pPair );
+
+static WssRecvStreamFragment_t * GetWssRecvStreamFragment( WssRecvStreamUpdate_t * pUpdate,
+                                                            uint8_t field );
+
+static void AppendWssRecvStreamToken( WssRecvStream_t * pStream,
+                                      const char * pData,
+                                      size_t length );
+
+static SignalingResult_t OpenWssRecvStreamContainer( WssRecvStream_t * pStream,
+                                                     uint8_t isArray );
+
+static SignalingResult_t CloseWssRecvStreamContainer( WssRecvStream_t * pStream,
+                                                      char closingBracket );
+
+static void EndWssRecvStreamValue( WssRecvStream_t * pStream );
+
+static void EndWssRecvStreamString( WssRecvStream_t * pStream );
+
+static SignalingResult_t StartWssRecvStreamValue( WssRecvStream_t * pStream,
+                                                  const char * pChunk,
+                                                  size_t * pIndex,
+                                                  WssRecvStreamUpdate_t * pUpdate );
+
+static SignalingResult_t FeedWssRecvStreamStructure( WssRecvStream_t * pStream,
+                                                     const char * pChunk,
+                                                     size_t * pIndex,
+                                                     WssRecvStreamUpdate_t * pUpdate );
+
+static SignalingResult_t FeedWssRecvStreamEscape( WssRecvStream_t * pStream,
+                                                  char c );
+
+static SignalingResult_t StartWssRecvStreamUtf8( WssRecvStream_t * pStream,
+                                                 uint8_t leadByte );
+
+static SignalingResult_t FeedWssRecvStreamString( WssRecvStream_t * pStream,
+                                                  const char * pChunk,
+                                                  size_t chunkLength,
+                                                  size_t * pIndex,
+                                                  WssRecvStreamUpdate_t * pUpdate );
+
+static SignalingResult_t FeedWssRecvStreamNumber( WssRecvStream_t * pStream,
+                                                  char c,
+                                                  size_t * pIndex );
+
+static SignalingResult_t FeedWssRecvStreamLiteral( WssRecvStream_t * pStream,
+                                                   char c,
+                                                   size_t * pIndex );
+
+static SignalingResult_t DecodeBase64( const char * pInput,
+                                       size_t inputLength,
+                                       char * pOutput,
+                                       size_t * pOutputLength );
+
+static void EncodeBase64( const char * pInput,
+                          size_t inputLength,
+                          char * pOutput );
+
+static size_t UnescapeJsonString( char * pString,
+                                  size_t stringLength );
+
+static void UnescapeJsonValue( char * pMessage,
+                               const char ** ppValue,
+                               size_t * pValueLength );
+
+static void AppendWssMessageToWriter( SignalingWriter_t * pWriter,
+                                      const WssSendMessage_t * pWssSendMessage,
+                                      const char * pRawPayload,
+                                      size_t rawPayloadLength );
+
+static SignalingResult_t ConstructWssMessage( WssSendMessage_t * pWssSendMessage,
+                                              const char * pRawPayload,
+                                              size_t rawPayloadLength,
+                                              char * pBuffer,
+                                              size_t * pBufferLength );
 
 /*-----------------------------------------------------------*/
 
@@ -90,180 +611,216 @@ static char * GetStringFromMessageType( SignalingTypeMessage_t messageType )
 
 /*-----------------------------------------------------------*/
 
-static void ParseUris( const char * pUris,
-                       size_t urisLength,
-                       SignalingIceServer_t * pIceServer )
+static void InitWriter( SignalingWriter_t * pWriter,
+                        char * pBuffer,
+                        size_t bufferLength )
 {
-    JSONStatus_t jsonResult = JSONSuccess;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
+    pWriter->pBuffer = pBuffer;
+    pWriter->bufferLength = ( pBuffer != NULL ) ? bufferLength : 0U;
+    pWriter->length = 0;
+}
 
-    jsonResult = JSON_Iterate( pUris, urisLength, &( start ), &( next ), &( pair ) );
+/*-----------------------------------------------------------*/
 
-    while( jsonResult == JSONSuccess )
+static void AppendToWriter( SignalingWriter_t * pWriter,
+                            const char * pData,
+                            size_t dataLength )
+{
+    if( dataLength > ( SIZE_MAX - pWriter->length ) )
     {
-        pIceServer->pUris[ pIceServer->urisNum ] = pair.value;
-        pIceServer->urisLength[ pIceServer->urisNum ] = pair.valueLength;
-        pIceServer->urisNum++;
+        /* Saturate, the result can't fit anywhere. */
+        pWriter->length = SIZE_MAX;
+    }
+    else
+    {
+        /* Keep room for the null terminator. */
+        if( ( dataLength > 0U ) &&
+            ( ( pWriter->length + dataLength ) < pWriter->bufferLength ) )
+        {
+            memcpy( &( pWriter->pBuffer[ pWriter->length ] ), pData, dataLength );
+        }
 
-        jsonResult = JSON_Iterate( pUris, urisLength, &( start ), &( next ), &( pair ) );
+        pWriter->length += dataLength;
     }
 }
 
 /*-----------------------------------------------------------*/
 
-static SignalingResult_t ParseIceServerList( const char * pIceServerListBuffer,
-                                             size_t iceServerListBufferLength,
-                                             SignalingIceServer_t * pIceServers,
-                                             size_t * pNumIceServers )
+/* Return the index of the first byte at or after index that has to be
+ * escaped in a JSON string, or dataLength if there is none. Non ASCII bytes
+ * stop the vector scan but are kept as they are. */
+static size_t FindJsonEscape( const char * pData,
+                              size_t index,
+                              size_t dataLength )
 {
-    SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult = JSONSuccess;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
-    const char * pIceServerBuffer;
-    size_t iceServerBufferLength;
-    size_t iceServerStart = 0, iceServerNext = 0;
-    char ttlSecondsBuffer[ SIGNALING_ICE_SERVER_TTL_SECONDS_BUFFER_MAX ] = { 0 };
-    size_t iceServerCount = 0;
+    size_t i = ScanJsonStringRun( pData, index, dataLength );
 
-    while( ( result == SIGNALING_RESULT_OK ) &&
-           ( iceServerCount < *pNumIceServers ) )
+    while( ( i < dataLength ) && ( ( ( uint8_t ) pData[ i ] ) >= 0x80U ) )
     {
-        jsonResult = JSON_Iterate( pIceServerListBuffer, iceServerListBufferLength, &( start ), &( next ), &( pair ) );
+        i = ScanJsonStringRun( pData, i + 1U, dataLength );
+    }
 
-        if( jsonResult == JSONSuccess )
-        {
-            pIceServerBuffer = pair.value;
-            iceServerBufferLength = pair.valueLength;
-            iceServerStart = 0;
-            iceServerNext = 0;
+    return i;
+}
 
-            jsonResult = JSON_Iterate( pIceServerBuffer, iceServerBufferLength, &( iceServerStart ), &( iceServerNext ), &( pair ) );
+/*-----------------------------------------------------------*/
 
-            while( jsonResult == JSONSuccess )
+static void AppendEscapedToWriter( SignalingWriter_t * pWriter,
+                                   const char * pData,
+                                   size_t dataLength )
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    char escape[ 6 ] = { '\\', 'u', '0', '0', '0', '0' };
+    size_t i = 0, runStart, escapeLength;
+    uint8_t c;
+
+    /* Values without anything to escape, which is nearly all of them, are
+     * appended as one run after a single scan. */
+    while( i < dataLength )
+    {
+        runStart = i;
+        i = FindJsonEscape( pData, i, dataLength );
+        AppendToWriter( pWriter, &( pData[ runStart ] ), i - runStart );
+
+        if( i < dataLength )
+        {
+            c = ( uint8_t ) pData[ i ];
+            escapeLength = 2;
+
+            switch( c )
             {
-                if( strncmp( pair.key, "Password", pair.keyLength ) == 0 )
-                {
-                    pIceServers[ iceServerCount ].pPassword = pair.value;
-                    pIceServers[ iceServerCount ].passwordLength = pair.valueLength;
-                }
-                else if( strncmp( pair.key, "Ttl", pair.keyLength ) == 0 )
-                {
-                    if( pair.valueLength >= SIGNALING_ICE_SERVER_TTL_SECONDS_BUFFER_MAX )
-                    {
-                        /* Unexpected TTL value from cloud. */
-                        result = SIGNALING_RESULT_INVALID_TTL;
-                        break;
-                    }
+                case '"':
+                case '\\':
+                    escape[ 1 ] = ( char ) c;
+                    break;
 
-                    strncpy( ttlSecondsBuffer, pair.value, pair.valueLength );
-                    pIceServers[ iceServerCount ].messageTtlSeconds = ( uint32_t ) strtoul( ttlSecondsBuffer, NULL, 10 );
+                case '\b':
+                    escape[ 1 ] = 'b';
+                    break;
 
-                    if( ( pIceServers[ iceServerCount ].messageTtlSeconds < SIGNALING_ICE_SERVER_TTL_SECONDS_MIN ) ||
-                        ( pIceServers[ iceServerCount ].messageTtlSeconds > SIGNALING_ICE_SERVER_TTL_SECONDS_MAX ) )
-                    {
-                        /* Unexpected TTL value from cloud. */
-                        result = SIGNALING_RESULT_INVALID_TTL;
-                        break;
-                    }
-                }
-                else if( strncmp( pair.key, "Uris", pair.keyLength ) == 0 )
-                {
-                    ParseUris( pair.value, pair.valueLength, &( pIceServers[ iceServerCount ] ) );
-                }
-                else if( strncmp( pair.key, "Username", pair.keyLength ) == 0 )
-                {
-                    pIceServers[ iceServerCount ].pUserName = pair.value;
-                    pIceServers[ iceServerCount ].userNameLength = pair.valueLength;
-                }
-                else
-                {
-                    /* Skip unknown messages. */
-                }
+                case '\f':
+                    escape[ 1 ] = 'f';
+                    break;
 
-                jsonResult = JSON_Iterate( pIceServerBuffer, iceServerBufferLength, &( iceServerStart ), &( iceServerNext ), &( pair ) );
+                case '\n':
+                    escape[ 1 ] = 'n';
+                    break;
+
+                case '\r':
+                    escape[ 1 ] = 'r';
+                    break;
+
+                case '\t':
+                    escape[ 1 ] = 't';
+                    break;
+
+                default:
+                    /* Any other control character. */
+                    escape[ 1 ] = 'u';
+                    escape[ 4 ] = hexDigits[ c >> 4 ];
+                    escape[ 5 ] = hexDigits[ c & 0x0FU ];
+                    escapeLength = 6;
+                    break;
             }
 
-            iceServerCount++;
-        }
-        else
-        {
-            /* All parsed. */
-            break;
+            AppendToWriter( pWriter, &( escape[ 0 ] ), escapeLength );
+            i++;
         }
     }
+}
 
-    if( result == SIGNALING_RESULT_OK )
+/*-----------------------------------------------------------*/
+
+static void AppendToWriterSink( void * pContext,
+                                const char * pData,
+                                size_t dataLength )
+{
+    AppendToWriter( ( SignalingWriter_t * ) pContext, pData, dataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendUriEncodedToWriter( SignalingWriter_t * pWriter,
+                                      const char * pData,
+                                      size_t dataLength )
+{
+    Signaling_UriEncode( pData, dataLength, 0U, AppendToWriterSink, pWriter );
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendDecimalToWriter( SignalingWriter_t * pWriter,
+                                   uint32_t value )
+{
+    char digits[ 10 ];
+    size_t i = sizeof( digits );
+
+    do
     {
-        *pNumIceServers = iceServerCount;
-    }
+        i--;
+        digits[ i ] = ( char ) ( '0' + ( value % 10U ) );
+        value /= 10U;
+    } while( value > 0U );
 
-    return result;
+    AppendToWriter( pWriter, &( digits[ i ] ), sizeof( digits ) - i );
 }
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructDescribeSignalingChannelRequest( SignalingAwsRegion_t * pAwsRegion,
-                                                                      SignalingChannelName_t * pChannelName,
-                                                                      SignalingRequest_t * pRequestBuffer )
+static void AppendBase64ToWriter( SignalingWriter_t * pWriter,
+                                  const char * pInput,
+                                  size_t inputLength )
 {
-    SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
+    size_t encodedLength;
 
-    if( ( pAwsRegion == NULL ) ||
-        ( pAwsRegion->pAwsRegion == NULL ) ||
-        ( pChannelName == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) )
+    if( inputLength > ( ( SIZE_MAX / 4U ) * 3U ) )
     {
-        result = SIGNALING_RESULT_BAD_PARAM;
+        pWriter->length = SIZE_MAX;
     }
-
-    if( result == SIGNALING_RESULT_OK )
+    else
     {
-        if( SIGNALING_IS_CHINA_REGION( pAwsRegion ) )
+        encodedLength = ( ( inputLength + 2U ) / 3U ) * 4U;
+
+        if( encodedLength > ( SIZE_MAX - pWriter->length ) )
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com.cn/describeSignalingChannel",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
+            pWriter->length = SIZE_MAX;
         }
         else
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com/describeSignalingChannel",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
-        }
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
+            if( ( pWriter->length + encodedLength ) < pWriter->bufferLength )
+            {
+                EncodeBase64( pInput, inputLength, &( pWriter->pBuffer[ pWriter->length ] ) );
+            }
 
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->urlLength = snprintfRetVal;
+            pWriter->length += encodedLength;
         }
     }
+}
 
-    if( result == SIGNALING_RESULT_OK )
-    {
-        snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                   pRequestBuffer->bodyLength,
-                                   "{"
-                                        "\"ChannelName\":\"%.*s\""
-                                   "}",
-                                   ( int ) pChannelName->channelNameLength,
-                                   pChannelName->pChannelName );
+/*-----------------------------------------------------------*/
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->bodyLength );
+static SignalingResult_t FinishWriter( SignalingWriter_t * pWriter,
+                                       size_t * pLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
 
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength = snprintfRetVal;
-        }
+    if( pWriter->length == SIZE_MAX )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+    else if( pWriter->pBuffer == NULL )
+    {
+        /* Size query, the size includes the null terminator. */
+        *pLength = pWriter->length + 1U;
+    }
+    else if( pWriter->length >= pWriter->bufferLength )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+    else
+    {
+        pWriter->pBuffer[ pWriter->length ] = '\0';
+        *pLength = pWriter->length;
     }
 
     return result;
@@ -271,162 +828,4128 @@ SignalingResult_t Signaling_ConstructDescribeSignalingChannelRequest( SignalingA
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseDescribeSignalingChannelResponse( const char * pMessage,
-                                                                   size_t messageLength,
-                                                                   SignalingChannelInfo_t * pChannelInfo )
+static void MaskWssPayload( uint8_t * pPayload,
+                            size_t payloadLength,
+                            const uint8_t * pMaskingKey )
 {
-    SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
-    const char * pChannelInfoBuffer = NULL;
-    size_t channelInfoBufferLength;
-    size_t channelInfoStart = 0, channelInfoNext = 0;
-    char ttlSecondsBuffer[ SIGNALING_CHANNEL_TTL_SECONDS_BUFFER_MAX ] = { 0 };
-
-    if( ( pMessage == NULL ) ||
-        ( pChannelInfo == NULL ) )
-    {
-        result = SIGNALING_RESULT_BAD_PARAM;
-    }
+    size_t i = 0;
+    uint32_t key;
+
+    #if defined( SIGNALING_JSON_SCAN_AVX2 )
+        __m256i keys, chunk;
+    #elif defined( SIGNALING_JSON_SCAN_SSE2 )
+        __m128i keys, chunk;
+    #elif defined( SIGNALING_JSON_SCAN_NEON )
+        uint32x4_t keys;
+        uint8x16_t chunk;
+    #endif
+
+    /* Repeating the key as a native word keeps its byte order in memory, so
+     * every vector of a multiple of 4 bytes is masked with the same value. */
+    memcpy( &( key ), pMaskingKey, sizeof( key ) );
+
+    #if defined( SIGNALING_JSON_SCAN_AVX2 )
+        keys = _mm256_set1_epi32( ( int ) key );
+
+        while( ( payloadLength - i ) >= 32U )
+        {
+            chunk = _mm256_loadu_si256( ( const __m256i * ) &( pPayload[ i ] ) );
+            _mm256_storeu_si256( ( __m256i * ) &( pPayload[ i ] ), _mm256_xor_si256( chunk, keys ) );
+            i += 32U;
+        }
+    #elif defined( SIGNALING_JSON_SCAN_SSE2 )
+        keys = _mm_set1_epi32( ( int ) key );
 
-    if( result == SIGNALING_RESULT_OK )
-    {
-        jsonResult = JSON_Validate( pMessage, messageLength );
+        while( ( payloadLength - i ) >= 16U )
+        {
+            chunk = _mm_loadu_si128( ( const __m128i * ) &( pPayload[ i ] ) );
+            _mm_storeu_si128( ( __m128i * ) &( pPayload[ i ] ), _mm_xor_si128( chunk, keys ) );
+            i += 16U;
+        }
+    #elif defined( SIGNALING_JSON_SCAN_NEON )
+        keys = vdupq_n_u32( key );
 
-        if( jsonResult != JSONSuccess )
+        while( ( payloadLength - i ) >= 16U )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            chunk = vld1q_u8( &( pPayload[ i ] ) );
+            vst1q_u8( &( pPayload[ i ] ), veorq_u8( chunk, vreinterpretq_u8_u32( keys ) ) );
+            i += 16U;
         }
-    }
+    #else
+        ( void ) key;
+    #endif /* if defined( SIGNALING_JSON_SCAN_AVX2 ) */
 
-    if( result == SIGNALING_RESULT_OK )
+    for( ; i < payloadLength; i++ )
+    {
+        pPayload[ i ] ^= pMaskingKey[ i & 3U ];
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendControlPlaneUrl( SignalingWriter_t * pWriter,
+                                   const SignalingAwsRegion_t * pAwsRegion )
+{
+    SIGNALING_APPEND_LITERAL( pWriter, "https://kinesisvideo." );
+    AppendToWriter( pWriter, pAwsRegion->pAwsRegion, pAwsRegion->awsRegionLength );
+
+    if( SIGNALING_IS_CHINA_REGION( pAwsRegion ) )
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, ".amazonaws.com.cn/" );
+    }
+    else
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, ".amazonaws.com/" );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ValidateHttpRequest( const SignalingRequest_t * pRequest,
+                                              const SignalingHttpRequestInfo_t * pHttpRequestInfo )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    const char * pHost, * pPath;
+    size_t hostLength, pathLength;
+
+    if( ( pRequest == NULL ) ||
+        ( pRequest->pUrl == NULL ) ||
+        ( ( pRequest->pBody == NULL ) && ( pRequest->bodyLength != 0U ) ) ||
+        ( ( uint64_t ) pRequest->bodyLength > UINT32_MAX ) ||
+        ( pHttpRequestInfo == NULL ) ||
+        ( pHttpRequestInfo->pMethod == NULL ) ||
+        ( pHttpRequestInfo->pDate == NULL ) ||
+        ( pHttpRequestInfo->pAuthorization == NULL ) ||
+        ( ( pHttpRequestInfo->pSessionToken == NULL ) && ( pHttpRequestInfo->sessionTokenLength != 0U ) ) ||
+        ( ( pHttpRequestInfo->pUserAgent == NULL ) && ( pHttpRequestInfo->userAgentLength != 0U ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = Signaling_SplitUrl( pRequest->pUrl, pRequest->urlLength, &( pHost ), &( hostLength ), &( pPath ), &( pathLength ), NULL, NULL );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendHttpHeadersToWriter( SignalingWriter_t * pWriter,
+                                       const SignalingRequest_t * pRequest,
+                                       const SignalingHttpRequestInfo_t * pHttpRequestInfo )
+{
+    const char * pHost = NULL, * pPath = NULL;
+    size_t hostLength = 0, pathLength = 0;
+
+    /* The URL was validated by the caller. */
+    ( void ) Signaling_SplitUrl( pRequest->pUrl, pRequest->urlLength, &( pHost ), &( hostLength ), &( pPath ), &( pathLength ), NULL, NULL );
+
+    AppendToWriter( pWriter, pHttpRequestInfo->pMethod, pHttpRequestInfo->methodLength );
+    SIGNALING_APPEND_LITERAL( pWriter, " " );
+
+    if( ( pathLength == 0U ) || ( pPath[ 0 ] == '?' ) )
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, "/" );
+    }
+
+    AppendToWriter( pWriter, pPath, pathLength );
+    SIGNALING_APPEND_LITERAL( pWriter, " HTTP/1.1\r\nHost: " );
+    AppendToWriter( pWriter, pHost, hostLength );
+
+    if( pRequest->bodyLength > 0U )
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, "\r\nContent-Type: application/json" );
+    }
+
+    SIGNALING_APPEND_LITERAL( pWriter, "\r\nContent-Length: " );
+    AppendDecimalToWriter( pWriter, ( uint32_t ) pRequest->bodyLength );
+
+    if( pHttpRequestInfo->userAgentLength > 0U )
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, "\r\nUser-Agent: " );
+        AppendToWriter( pWriter, pHttpRequestInfo->pUserAgent, pHttpRequestInfo->userAgentLength );
+    }
+
+    SIGNALING_APPEND_LITERAL( pWriter, "\r\nX-Amz-Date: " );
+    AppendToWriter( pWriter, pHttpRequestInfo->pDate, pHttpRequestInfo->dateLength );
+
+    if( pHttpRequestInfo->sessionTokenLength > 0U )
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, "\r\nX-Amz-Security-Token: " );
+        AppendToWriter( pWriter, pHttpRequestInfo->pSessionToken, pHttpRequestInfo->sessionTokenLength );
+    }
+
+    SIGNALING_APPEND_LITERAL( pWriter, "\r\nAuthorization: " );
+    AppendToWriter( pWriter, pHttpRequestInfo->pAuthorization, pHttpRequestInfo->authorizationLength );
+    SIGNALING_APPEND_LITERAL( pWriter, "\r\n\r\n" );
+}
+
+/*-----------------------------------------------------------*/
+
+static void InitRequestWriters( SignalingRequest_t * pRequestBuffer,
+                                SignalingWriter_t * pUrlWriter,
+                                SignalingWriter_t * pBodyWriter )
+{
+    InitWriter( pUrlWriter, pRequestBuffer->pUrl, pRequestBuffer->urlLength );
+
+    if( pBodyWriter != NULL )
+    {
+        /* Without a URL buffer this is a size query, so the body is only
+         * counted as well. */
+        InitWriter( pBodyWriter,
+                    ( pRequestBuffer->pUrl != NULL ) ? pRequestBuffer->pBody : NULL,
+                    pRequestBuffer->bodyLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t FinishRequestWriters( SignalingRequest_t * pRequestBuffer,
+                                               SignalingWriter_t * pUrlWriter,
+                                               SignalingWriter_t * pBodyWriter )
+{
+    SignalingResult_t result;
+    uint8_t isSizeQuery = ( pUrlWriter->pBuffer == NULL ) ? 1U : 0U;
+
+    result = FinishWriter( pUrlWriter, &( pRequestBuffer->urlLength ) );
+
+    if( ( result == SIGNALING_RESULT_OK ) && ( pBodyWriter != NULL ) )
+    {
+        result = FinishWriter( pBodyWriter, &( pRequestBuffer->bodyLength ) );
+    }
+    else if( ( result == SIGNALING_RESULT_OK ) && ( isSizeQuery != 0U ) )
+    {
+        /* The request has no body. */
+        pRequestBuffer->bodyLength = 0;
+    }
+    else
+    {
+        /* Nothing more to finish. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingJsonToken_t LookupJsonToken( const char * pString,
+                                             size_t length )
+{
+    SignalingJsonToken_t token = SIGNALING_JSON_TOKEN_UNKNOWN;
+    uint8_t candidate;
+
+    if( ( pString != NULL ) &&
+        ( length >= SIGNALING_JSON_TOKEN_MIN_LENGTH ) &&
+        ( length <= SIGNALING_JSON_TOKEN_MAX_LENGTH ) )
+    {
+        candidate = gJsonTokenSlots[ SIGNALING_JSON_TOKEN_HASH( pString, length ) ];
+
+        /* Exact match only, a prefix of a known token is not that token. */
+        if( ( candidate != ( uint8_t ) SIGNALING_JSON_TOKEN_UNKNOWN ) &&
+            ( gJsonTokenStrings[ candidate ].length == length ) &&
+            ( memcmp( gJsonTokenStrings[ candidate ].pString, pString, length ) == 0 ) )
+        {
+            token = ( SignalingJsonToken_t ) candidate;
+        }
+    }
+
+    return token;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingTypeMessage_t GetMessageTypeFromString( const char * pString,
+                                                        size_t length )
+{
+    SignalingTypeMessage_t messageType;
+
+    switch( LookupJsonToken( pString, length ) )
+    {
+        case SIGNALING_JSON_TOKEN_VALUE_SDP_OFFER:
+            messageType = SIGNALING_TYPE_MESSAGE_SDP_OFFER;
+            break;
+
+        case SIGNALING_JSON_TOKEN_VALUE_SDP_ANSWER:
+            messageType = SIGNALING_TYPE_MESSAGE_SDP_ANSWER;
+            break;
+
+        case SIGNALING_JSON_TOKEN_VALUE_ICE_CANDIDATE:
+            messageType = SIGNALING_TYPE_MESSAGE_ICE_CANDIDATE;
+            break;
+
+        case SIGNALING_JSON_TOKEN_VALUE_GO_AWAY:
+            messageType = SIGNALING_TYPE_MESSAGE_GO_AWAY;
+            break;
+
+        case SIGNALING_JSON_TOKEN_VALUE_RECONNECT_ICE_SERVER:
+            messageType = SIGNALING_TYPE_MESSAGE_RECONNECT_ICE_SERVER;
+            break;
+
+        case SIGNALING_JSON_TOKEN_VALUE_STATUS_RESPONSE:
+            messageType = SIGNALING_TYPE_MESSAGE_STATUS_RESPONSE;
+            break;
+
+        default:
+            messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
+            break;
+    }
+
+    return messageType;
+}
+
+/*-----------------------------------------------------------*/
+
+static void ParseUris( const char * pUris,
+                       size_t urisLength,
+                       SignalingIceServer_t * pIceServer )
+{
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+
+    jsonResult = JSON_Iterate( pUris, urisLength, &( start ), &( next ), &( pair ) );
+
+    /* Extra URIs beyond the capacity of the ICE server are dropped. */
+    while( ( jsonResult == JSONSuccess ) &&
+           ( pIceServer->urisNum < SIGNALING_ICE_SERVER_MAX_URIS ) )
+    {
+        pIceServer->pUris[ pIceServer->urisNum ] = pair.value;
+        pIceServer->urisLength[ pIceServer->urisNum ] = pair.valueLength;
+        pIceServer->urisNum++;
+
+        jsonResult = JSON_Iterate( pUris, urisLength, &( start ), &( next ), &( pair ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseIceServerList( const char * pIceServerListBuffer,
+                                             size_t iceServerListBufferLength,
+                                             SignalingIceServer_t * pIceServers,
+                                             size_t * pNumIceServers )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    const char * pIceServerBuffer;
+    size_t iceServerBufferLength;
+    size_t iceServerStart = 0, iceServerNext = 0;
+    char ttlSecondsBuffer[ SIGNALING_ICE_SERVER_TTL_SECONDS_BUFFER_MAX ] = { 0 };
+    size_t iceServerCount = 0;
+
+    while( ( result == SIGNALING_RESULT_OK ) &&
+           ( iceServerCount < *pNumIceServers ) )
+    {
+        jsonResult = JSON_Iterate( pIceServerListBuffer, iceServerListBufferLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            pIceServerBuffer = pair.value;
+            iceServerBufferLength = pair.valueLength;
+            iceServerStart = 0;
+            iceServerNext = 0;
+
+            jsonResult = JSON_Iterate( pIceServerBuffer, iceServerBufferLength, &( iceServerStart ), &( iceServerNext ), &( pair ) );
+
+            while( jsonResult == JSONSuccess )
+            {
+                switch( LookupJsonToken( pair.key, pair.keyLength ) )
+                {
+                    case SIGNALING_JSON_TOKEN_PASSWORD:
+                        pIceServers[ iceServerCount ].pPassword = pair.value;
+                        pIceServers[ iceServerCount ].passwordLength = pair.valueLength;
+                        break;
+
+                    case SIGNALING_JSON_TOKEN_TTL:
+                        if( pair.valueLength >= SIGNALING_ICE_SERVER_TTL_SECONDS_BUFFER_MAX )
+                        {
+                            /* Unexpected TTL value from cloud. */
+                            result = SIGNALING_RESULT_INVALID_TTL;
+                            break;
+                        }
+
+                        strncpy( ttlSecondsBuffer, pair.value, pair.valueLength );
+                        pIceServers[ iceServerCount ].messageTtlSeconds = ( uint32_t ) strtoul( ttlSecondsBuffer, NULL, 10 );
+
+                        if( ( pIceServers[ iceServerCount ].messageTtlSeconds < SIGNALING_ICE_SERVER_TTL_SECONDS_MIN ) ||
+                            ( pIceServers[ iceServerCount ].messageTtlSeconds > SIGNALING_ICE_SERVER_TTL_SECONDS_MAX ) )
+                        {
+                            /* Unexpected TTL value from cloud. */
+                            result = SIGNALING_RESULT_INVALID_TTL;
+                        }
+                        break;
+
+                    case SIGNALING_JSON_TOKEN_URIS:
+                        ParseUris( pair.value, pair.valueLength, &( pIceServers[ iceServerCount ] ) );
+                        break;
+
+                    case SIGNALING_JSON_TOKEN_USERNAME:
+                        pIceServers[ iceServerCount ].pUserName = pair.value;
+                        pIceServers[ iceServerCount ].userNameLength = pair.valueLength;
+                        break;
+
+                    default:
+                        /* Skip unknown messages. */
+                        break;
+                }
+
+                if( result != SIGNALING_RESULT_OK )
+                {
+                    break;
+                }
+
+                jsonResult = JSON_Iterate( pIceServerBuffer, iceServerBufferLength, &( iceServerStart ), &( iceServerNext ), &( pair ) );
+            }
+
+            iceServerCount++;
+        }
+        else
+        {
+            /* All parsed. */
+            break;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *pNumIceServers = iceServerCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseSingleMasterConfiguration( const char * pConfigBuffer,
+                                                         size_t configBufferLength,
+                                                         SignalingChannelInfo_t * pChannelInfo )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t configStart = 0, configNext = 0;
+    JSONPair_t pair = { 0 };
+    char ttlSecondsBuffer[ SIGNALING_CHANNEL_TTL_SECONDS_BUFFER_MAX ] = { 0 };
+
+    jsonResult = JSON_Iterate( pConfigBuffer, configBufferLength, &( configStart ), &( configNext ), &( pair ) );
+
+    if( jsonResult == JSONSuccess )
+    {
+        if( LookupJsonToken( pair.key, pair.keyLength ) == SIGNALING_JSON_TOKEN_MESSAGE_TTL_SECONDS )
+        {
+            if( pair.valueLength >= SIGNALING_CHANNEL_TTL_SECONDS_BUFFER_MAX )
+            {
+                /* Unexpected TTL value from cloud. */
+                result = SIGNALING_RESULT_INVALID_TTL;
+            }
+            else
+            {
+                strncpy( ttlSecondsBuffer, pair.value, pair.valueLength );
+                pChannelInfo->messageTtlSeconds = ( uint32_t ) strtoul( ttlSecondsBuffer, NULL, 10 );
+
+                if( ( pChannelInfo->messageTtlSeconds < SIGNALING_CHANNEL_TTL_SECONDS_MIN ) ||
+                    ( pChannelInfo->messageTtlSeconds > SIGNALING_CHANNEL_TTL_SECONDS_MAX ) )
+                {
+                    /* Unexpected TTL value from cloud. */
+                    result = SIGNALING_RESULT_INVALID_TTL;
+                }
+            }
+        }
+        else
+        {
+            /* Unknown attribute. */
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+    else
+    {
+        /* Invalid single master configuration. */
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseWssRecvMessage( const char * pMessage,
+                                              size_t messageLength,
+                                              WssRecvMessage_t * pWssRecvMessage )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    const char * pStatusResponseBuffer = NULL;
+    size_t statusResponseBufferLength = 0;
+    size_t statusResponseStart = 0, statusResponseNext = 0;
+
+    /* Exclude null terminator in messageLength. */
+    if( messageLength > 0 )
+    {
+        if( pMessage[ messageLength - 1 ] == '\0' )
+        {
+            messageLength--;
+        }
+    }
+
+    pWssRecvMessage->pSenderClientId = NULL;
+    pWssRecvMessage->senderClientIdLength = 0;
+    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
+    pWssRecvMessage->pBase64EncodedPayload = NULL;
+    pWssRecvMessage->base64EncodedPayloadLength = 0;
+    memset( &( pWssRecvMessage->statusResponse ), 0, sizeof( WssStatusResponse_t ) );
+
+    /* Validate and extract in the same walk over the message. Semantic
+     * errors are recorded but the walk continues so that malformed JSON is
+     * still reported as SIGNALING_RESULT_INVALID_JSON. */
+    jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+    while( jsonResult == JSONSuccess )
+    {
+        if( result != SIGNALING_RESULT_OK )
+        {
+            /* Keep validating the rest of the message. */
+        }
+        else
+        {
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_SENDER_CLIENT_ID:
+                    pWssRecvMessage->pSenderClientId = pair.value;
+                    pWssRecvMessage->senderClientIdLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_MESSAGE_TYPE:
+                    pWssRecvMessage->messageType = GetMessageTypeFromString( pair.value, pair.valueLength );
+                    break;
+
+                case SIGNALING_JSON_TOKEN_MESSAGE_PAYLOAD:
+                    pWssRecvMessage->pBase64EncodedPayload = pair.value;
+                    pWssRecvMessage->base64EncodedPayloadLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_STATUS_RESPONSE:
+                    if( pair.jsonType == JSONObject )
+                    {
+                        pStatusResponseBuffer = pair.value;
+                        statusResponseBufferLength = pair.valueLength;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                    }
+                    break;
+
+                default:
+                    /* Do nothing, ignore unknown tags. */
+                    break;
+            }
+        }
+
+        jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+    }
+
+    if( jsonResult != JSONNotFound )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) && ( pStatusResponseBuffer != NULL ) )
+    {
+        jsonResult = IterateValidatedObject( pStatusResponseBuffer, statusResponseBufferLength, &( statusResponseStart ), &( statusResponseNext ), &( pair ) );
+
+        if( jsonResult != JSONSuccess )
+        {
+            result = SIGNALING_RESULT_INVALID_STATUS_RESPONSE;
+        }
+
+        while( jsonResult == JSONSuccess )
+        {
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_CORRELATION_ID:
+                    pWssRecvMessage->statusResponse.pCorrelationId = pair.value;
+                    pWssRecvMessage->statusResponse.correlationIdLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_ERROR_TYPE:
+                    pWssRecvMessage->statusResponse.pErrorType = pair.value;
+                    pWssRecvMessage->statusResponse.errorTypeLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_STATUS_CODE:
+                    pWssRecvMessage->statusResponse.pStatusCode = pair.value;
+                    pWssRecvMessage->statusResponse.statusCodeLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_DESCRIPTION:
+                    pWssRecvMessage->statusResponse.pDescription = pair.value;
+                    pWssRecvMessage->statusResponse.descriptionLength = pair.valueLength;
+                    break;
+
+                default:
+                    /* Do nothing, ignore unknown tags. */
+                    break;
+            }
+
+            jsonResult = IterateValidatedObject( pStatusResponseBuffer, statusResponseBufferLength, &( statusResponseStart ), &( statusResponseNext ), &( pair ) );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void SkipJsonSpace( const char * pBuffer,
+                           size_t * pIndex,
+                           size_t bufferLength )
+{
+    size_t i = *pIndex;
+
+    while( ( i < bufferLength ) && SIGNALING_IS_JSON_SPACE( pBuffer[ i ] ) )
+    {
+        i++;
+    }
+
+    *pIndex = i;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonUtf8( const char * pBuffer,
+                                  size_t * pIndex,
+                                  size_t bufferLength )
+{
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t i = *pIndex, continuationCount = 0, k;
+    uint8_t leadByte = ( uint8_t ) pBuffer[ i ];
+    uint32_t codePoint = 0, minCodePoint = 0;
+
+    if( ( leadByte >= 0xC2U ) && ( leadByte <= 0xDFU ) )
+    {
+        continuationCount = 1;
+        codePoint = leadByte & 0x1FU;
+        minCodePoint = 0x80U;
+    }
+    else if( ( leadByte >= 0xE0U ) && ( leadByte <= 0xEFU ) )
+    {
+        continuationCount = 2;
+        codePoint = leadByte & 0x0FU;
+        minCodePoint = 0x800U;
+    }
+    else if( ( leadByte >= 0xF0U ) && ( leadByte <= 0xF4U ) )
+    {
+        continuationCount = 3;
+        codePoint = leadByte & 0x07U;
+        minCodePoint = 0x10000U;
+    }
+    else
+    {
+        /* Stray continuation byte or invalid lead byte. */
+        jsonResult = JSONIllegalDocument;
+    }
+
+    for( k = 1; ( jsonResult == JSONSuccess ) && ( k <= continuationCount ); k++ )
+    {
+        if( ( ( i + k ) >= bufferLength ) ||
+            ( ( ( ( uint8_t ) pBuffer[ i + k ] ) & 0xC0U ) != 0x80U ) )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+        else
+        {
+            codePoint = ( codePoint << 6 ) | ( ( ( uint8_t ) pBuffer[ i + k ] ) & 0x3FU );
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        /* Reject overlong encodings, surrogates and out of range code points. */
+        if( ( codePoint < minCodePoint ) ||
+            ( codePoint > 0x10FFFFU ) ||
+            ( ( codePoint >= 0xD800U ) && ( codePoint <= 0xDFFFU ) ) )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+        else
+        {
+            *pIndex = i + continuationCount + 1;
+        }
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t ReadJsonHexEscape( const char * pBuffer,
+                                       size_t * pIndex,
+                                       size_t bufferLength,
+                                       uint16_t * pValue )
+{
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t i = *pIndex, k;
+    uint16_t value = 0;
+    char c;
+
+    /* Expect "\uXXXX" starting at the backslash. */
+    if( ( ( i + 6 ) > bufferLength ) ||
+        ( pBuffer[ i ] != '\\' ) ||
+        ( pBuffer[ i + 1 ] != 'u' ) )
+    {
+        jsonResult = JSONIllegalDocument;
+    }
+
+    for( k = 2; ( jsonResult == JSONSuccess ) && ( k < 6 ); k++ )
+    {
+        c = pBuffer[ i + k ];
+
+        if( SIGNALING_IS_JSON_DIGIT( c ) )
+        {
+            value = ( uint16_t ) ( ( value << 4 ) | ( uint16_t ) ( c - '0' ) );
+        }
+        else if( ( c >= 'a' ) && ( c <= 'f' ) )
+        {
+            value = ( uint16_t ) ( ( value << 4 ) | ( uint16_t ) ( c - 'a' + 10 ) );
+        }
+        else if( ( c >= 'A' ) && ( c <= 'F' ) )
+        {
+            value = ( uint16_t ) ( ( value << 4 ) | ( uint16_t ) ( c - 'A' + 10 ) );
+        }
+        else
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        *pValue = value;
+        *pIndex = i + 6;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonEscape( const char * pBuffer,
+                                    size_t * pIndex,
+                                    size_t bufferLength )
+{
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t i = *pIndex;
+    uint16_t value = 0, lowSurrogate = 0;
+
+    if( ( i + 1 ) >= bufferLength )
+    {
+        jsonResult = JSONIllegalDocument;
+    }
+    else if( pBuffer[ i + 1 ] == 'u' )
+    {
+        jsonResult = ReadJsonHexEscape( pBuffer, &( i ), bufferLength, &( value ) );
+
+        /* Like coreJSON, NUL and unpaired surrogates are rejected. */
+        if( ( jsonResult == JSONSuccess ) &&
+            ( ( value == 0U ) || ( ( value >= 0xDC00U ) && ( value <= 0xDFFFU ) ) ) )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+
+        if( ( jsonResult == JSONSuccess ) &&
+            ( value >= 0xD800U ) && ( value <= 0xDBFFU ) )
+        {
+            jsonResult = ReadJsonHexEscape( pBuffer, &( i ), bufferLength, &( lowSurrogate ) );
+
+            if( ( jsonResult == JSONSuccess ) &&
+                ( ( lowSurrogate < 0xDC00U ) || ( lowSurrogate > 0xDFFFU ) ) )
+            {
+                jsonResult = JSONIllegalDocument;
+            }
+        }
+    }
+    else
+    {
+        switch( pBuffer[ i + 1 ] )
+        {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                i += 2;
+                break;
+
+            default:
+                jsonResult = JSONIllegalDocument;
+                break;
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        *pIndex = i;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( SIGNALING_JSON_SCAN_AVX2 ) || defined( SIGNALING_JSON_SCAN_SSE2 ) || defined( SIGNALING_JSON_SCAN_NEON )
+
+/*
+ * Return the number of trailing zero bits of a non zero vector comparison
+ * mask. Without a compiler builtin the mask is shifted, which takes at most
+ * one step per bit and runs once per scan.
+ */
+    static size_t CountTrailingZeros( uint64_t value )
+    {
+        size_t count = 0;
+
+        #if defined( __GNUC__ )
+            count = ( size_t ) __builtin_ctzll( value );
+        #else
+            while( ( value & 1U ) == 0U )
+            {
+                value >>= 1;
+                count++;
+            }
+        #endif
+
+        return count;
+    }
+
+/*-----------------------------------------------------------*/
+
+#endif /* if defined( SIGNALING_JSON_SCAN_AVX2 ) || defined( SIGNALING_JSON_SCAN_SSE2 ) || defined( SIGNALING_JSON_SCAN_NEON ) */
+
+/*
+ * Return the index of the first byte at or after index that needs attention
+ * inside a JSON string: a quote, a backslash, a control character or a non
+ * ASCII byte. Returns bufferLength if there is none. Base64 payloads consist
+ * entirely of bytes that need no attention, so the vector backends skip them
+ * 16 or 32 bytes at a time.
+ */
+static size_t ScanJsonStringRun( const char * pBuffer,
+                                 size_t index,
+                                 size_t bufferLength )
+{
+    size_t i = index;
+    uint8_t c;
+
+    #if defined( SIGNALING_JSON_SCAN_AVX2 )
+        const __m256i quotes = _mm256_set1_epi8( '"' );
+        const __m256i backslashes = _mm256_set1_epi8( '\\' );
+        const __m256i spaces = _mm256_set1_epi8( 0x20 );
+        __m256i chunk, special;
+        uint32_t mask;
+
+        while( ( bufferLength - i ) >= 32U )
+        {
+            chunk = _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ i ] ) );
+
+            /* A signed compare against 0x20 flags both control characters
+             * and bytes >= 0x80, which are negative as signed bytes. */
+            special = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( chunk, quotes ),
+                                                        _mm256_cmpeq_epi8( chunk, backslashes ) ),
+                                       _mm256_cmpgt_epi8( spaces, chunk ) );
+            mask = ( uint32_t ) _mm256_movemask_epi8( special );
+
+            if( mask != 0U )
+            {
+                i += CountTrailingZeros( mask );
+                break;
+            }
+
+            i += 32U;
+        }
+    #elif defined( SIGNALING_JSON_SCAN_SSE2 )
+        const __m128i quotes = _mm_set1_epi8( '"' );
+        const __m128i backslashes = _mm_set1_epi8( '\\' );
+        const __m128i spaces = _mm_set1_epi8( 0x20 );
+        __m128i chunk, special;
+        uint32_t mask;
+
+        while( ( bufferLength - i ) >= 16U )
+        {
+            chunk = _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ i ] ) );
+
+            /* A signed compare against 0x20 flags both control characters
+             * and bytes >= 0x80, which are negative as signed bytes. */
+            special = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( chunk, quotes ),
+                                                  _mm_cmpeq_epi8( chunk, backslashes ) ),
+                                    _mm_cmplt_epi8( chunk, spaces ) );
+            mask = ( uint32_t ) _mm_movemask_epi8( special );
+
+            if( mask != 0U )
+            {
+                i += CountTrailingZeros( mask );
+                break;
+            }
+
+            i += 16U;
+        }
+    #elif defined( SIGNALING_JSON_SCAN_NEON )
+        const uint8x16_t quotes = vdupq_n_u8( ( uint8_t ) '"' );
+        const uint8x16_t backslashes = vdupq_n_u8( ( uint8_t ) '\\' );
+        const uint8x16_t spaces = vdupq_n_u8( 0x20U );
+        const uint8x16_t highBit = vdupq_n_u8( 0x80U );
+        uint8x16_t chunk, special;
+        uint64_t mask;
+
+        while( ( bufferLength - i ) >= 16U )
+        {
+            chunk = vld1q_u8( ( const uint8_t * ) &( pBuffer[ i ] ) );
+            special = vorrq_u8( vorrq_u8( vceqq_u8( chunk, quotes ),
+                                          vceqq_u8( chunk, backslashes ) ),
+                                vorrq_u8( vcltq_u8( chunk, spaces ),
+                                          vcgeq_u8( chunk, highBit ) ) );
+
+            /* Narrow every byte of the comparison result to a nibble. */
+            mask = vget_lane_u64( vreinterpret_u64_u8( vshrn_n_u16( vreinterpretq_u16_u8( special ), 4 ) ), 0 );
+
+            if( mask != 0U )
+            {
+                i += ( CountTrailingZeros( mask ) >> 2 );
+                break;
+            }
+
+            i += 16U;
+        }
+    #endif /* if defined( SIGNALING_JSON_SCAN_AVX2 ) */
+
+    /* Scalar tail, or the whole run without a vector backend. When a vector
+     * backend stopped on a byte that needs attention this exits at once. */
+    while( i < bufferLength )
+    {
+        c = ( uint8_t ) pBuffer[ i ];
+
+        if( ( c == ( uint8_t ) '"' ) ||
+            ( c == ( uint8_t ) '\\' ) ||
+            ( c < 0x20U ) ||
+            ( c >= 0x80U ) )
+        {
+            break;
+        }
+
+        i++;
+    }
+
+    return i;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonString( const char * pBuffer,
+                                    size_t * pIndex,
+                                    size_t bufferLength )
+{
+    JSONStatus_t jsonResult = JSONPartial;
+    size_t i = *pIndex;
+    uint8_t c;
+
+    if( ( i >= bufferLength ) || ( pBuffer[ i ] != '"' ) )
+    {
+        jsonResult = JSONIllegalDocument;
+    }
+    else
+    {
+        i++;
+    }
+
+    while( jsonResult == JSONPartial )
+    {
+        i = ScanJsonStringRun( pBuffer, i, bufferLength );
+
+        if( i >= bufferLength )
+        {
+            /* Unterminated string. */
+            jsonResult = JSONIllegalDocument;
+            break;
+        }
+
+        c = ( uint8_t ) pBuffer[ i ];
+
+        if( c == ( uint8_t ) '"' )
+        {
+            i++;
+            jsonResult = JSONSuccess;
+        }
+        else if( c == ( uint8_t ) '\\' )
+        {
+            if( SkipJsonEscape( pBuffer, &( i ), bufferLength ) != JSONSuccess )
+            {
+                jsonResult = JSONIllegalDocument;
+            }
+        }
+        else if( c < 0x20U )
+        {
+            /* Control characters must be escaped. */
+            jsonResult = JSONIllegalDocument;
+        }
+        else if( SkipJsonUtf8( pBuffer, &( i ), bufferLength ) != JSONSuccess )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+        else
+        {
+            /* Valid multi-byte UTF-8 sequence. */
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        *pIndex = i;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonNumber( const char * pBuffer,
+                                    size_t * pIndex,
+                                    size_t bufferLength )
+{
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t i = *pIndex, digitStart;
+
+    if( ( i < bufferLength ) && ( pBuffer[ i ] == '-' ) )
+    {
+        i++;
+    }
+
+    /* Integer part, no leading zeros. */
+    if( ( i < bufferLength ) && ( pBuffer[ i ] == '0' ) )
+    {
+        i++;
+    }
+    else
+    {
+        digitStart = i;
+
+        while( ( i < bufferLength ) && SIGNALING_IS_JSON_DIGIT( pBuffer[ i ] ) )
+        {
+            i++;
+        }
+
+        if( i == digitStart )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+    }
+
+    /* Fraction part. */
+    if( ( jsonResult == JSONSuccess ) && ( i < bufferLength ) && ( pBuffer[ i ] == '.' ) )
+    {
+        i++;
+        digitStart = i;
+
+        while( ( i < bufferLength ) && SIGNALING_IS_JSON_DIGIT( pBuffer[ i ] ) )
+        {
+            i++;
+        }
+
+        if( i == digitStart )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+    }
+
+    /* Exponent part. */
+    if( ( jsonResult == JSONSuccess ) && ( i < bufferLength ) &&
+        ( ( pBuffer[ i ] == 'e' ) || ( pBuffer[ i ] == 'E' ) ) )
+    {
+        i++;
+
+        if( ( i < bufferLength ) && ( ( pBuffer[ i ] == '+' ) || ( pBuffer[ i ] == '-' ) ) )
+        {
+            i++;
+        }
+
+        digitStart = i;
+
+        while( ( i < bufferLength ) && SIGNALING_IS_JSON_DIGIT( pBuffer[ i ] ) )
+        {
+            i++;
+        }
+
+        if( i == digitStart )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        *pIndex = i;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonLiteral( const char * pBuffer,
+                                     size_t * pIndex,
+                                     size_t bufferLength,
+                                     const char * pLiteral,
+                                     size_t literalLength )
+{
+    JSONStatus_t jsonResult = JSONIllegalDocument;
+    size_t i = *pIndex;
+
+    if( ( ( bufferLength - i ) >= literalLength ) &&
+        ( memcmp( &( pBuffer[ i ] ), pLiteral, literalLength ) == 0 ) )
+    {
+        *pIndex = i + literalLength;
+        jsonResult = JSONSuccess;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonCollection( const char * pBuffer,
+                                        size_t * pIndex,
+                                        size_t bufferLength,
+                                        size_t depth )
+{
+    JSONStatus_t jsonResult = JSONPartial;
+    size_t i = *pIndex;
+    char closingBracket = ( pBuffer[ i ] == '{' ) ? '}' : ']';
+    uint8_t isFirstMember = 1;
+    JSONTypes_t jsonType;
+
+    if( depth > SIGNALING_JSON_MAX_DEPTH )
+    {
+        jsonResult = JSONMaxDepthExceeded;
+    }
+    else
+    {
+        i++;
+    }
+
+    while( jsonResult == JSONPartial )
+    {
+        SkipJsonSpace( pBuffer, &( i ), bufferLength );
+
+        if( i >= bufferLength )
+        {
+            jsonResult = JSONIllegalDocument;
+            break;
+        }
+
+        if( ( isFirstMember != 0 ) && ( pBuffer[ i ] == closingBracket ) )
+        {
+            i++;
+            jsonResult = JSONSuccess;
+            break;
+        }
+
+        if( closingBracket == '}' )
+        {
+            /* Every member of an object has a string key. */
+            jsonResult = SkipJsonString( pBuffer, &( i ), bufferLength );
+
+            if( jsonResult == JSONSuccess )
+            {
+                SkipJsonSpace( pBuffer, &( i ), bufferLength );
+
+                if( ( i >= bufferLength ) || ( pBuffer[ i ] != ':' ) )
+                {
+                    jsonResult = JSONIllegalDocument;
+                }
+                else
+                {
+                    i++;
+                    SkipJsonSpace( pBuffer, &( i ), bufferLength );
+                }
+            }
+        }
+        else
+        {
+            jsonResult = JSONSuccess;
+        }
+
+        if( jsonResult == JSONSuccess )
+        {
+            jsonResult = SkipJsonValue( pBuffer, &( i ), bufferLength, depth, &( jsonType ) );
+        }
+
+        if( jsonResult == JSONSuccess )
+        {
+            isFirstMember = 0;
+            SkipJsonSpace( pBuffer, &( i ), bufferLength );
+
+            if( i >= bufferLength )
+            {
+                jsonResult = JSONIllegalDocument;
+            }
+            else if( pBuffer[ i ] == ',' )
+            {
+                i++;
+                jsonResult = JSONPartial;
+            }
+            else if( pBuffer[ i ] == closingBracket )
+            {
+                i++;
+            }
+            else
+            {
+                jsonResult = JSONIllegalDocument;
+            }
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        *pIndex = i;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static JSONStatus_t SkipJsonValue( const char * pBuffer,
+                                   size_t * pIndex,
+                                   size_t bufferLength,
+                                   size_t depth,
+                                   JSONTypes_t * pJsonType )
+{
+    JSONStatus_t jsonResult = JSONIllegalDocument;
+
+    *pJsonType = JSONInvalid;
+
+    if( *pIndex < bufferLength )
+    {
+        switch( pBuffer[ *pIndex ] )
+        {
+            case '"':
+                *pJsonType = JSONString;
+                jsonResult = SkipJsonString( pBuffer, pIndex, bufferLength );
+                break;
+
+            case '{':
+                *pJsonType = JSONObject;
+                jsonResult = SkipJsonCollection( pBuffer, pIndex, bufferLength, depth + 1 );
+                break;
+
+            case '[':
+                *pJsonType = JSONArray;
+                jsonResult = SkipJsonCollection( pBuffer, pIndex, bufferLength, depth + 1 );
+                break;
+
+            case 't':
+                *pJsonType = JSONTrue;
+                jsonResult = SkipJsonLiteral( pBuffer, pIndex, bufferLength, "true", 4 );
+                break;
+
+            case 'f':
+                *pJsonType = JSONFalse;
+                jsonResult = SkipJsonLiteral( pBuffer, pIndex, bufferLength, "false", 5 );
+                break;
+
+            case 'n':
+                *pJsonType = JSONNull;
+                jsonResult = SkipJsonLiteral( pBuffer, pIndex, bufferLength, "null", 4 );
+                break;
+
+            default:
+                *pJsonType = JSONNumber;
+                jsonResult = SkipJsonNumber( pBuffer, pIndex, bufferLength );
+                break;
+        }
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Iterate over the members of the JSON object in pBuffer while validating it,
+ * so that a separate JSON_Validate pass is not needed. The calling convention
+ * follows JSON_Iterate: both *pStart and *pNext must be 0 on the first call.
+ *
+ * Returns JSONSuccess with the next member in pPair, JSONNotFound once the
+ * closing brace is reached and only whitespace follows it, and
+ * JSONIllegalDocument or JSONMaxDepthExceeded for malformed input.
+ */
+static JSONStatus_t IterateValidatedObject( const char * pBuffer,
+                                            size_t bufferLength,
+                                            size_t * pStart,
+                                            size_t * pNext,
+                                            JSONPair_t * pPair )
+{
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t i = *pNext, keyStart, valueStart;
+    JSONTypes_t jsonType;
+
+    if( i == 0 )
+    {
+        SkipJsonSpace( pBuffer, &( i ), bufferLength );
+
+        if( ( i >= bufferLength ) || ( pBuffer[ i ] != '{' ) )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+        else
+        {
+            i++;
+            SkipJsonSpace( pBuffer, &( i ), bufferLength );
+            *pStart = i;
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        if( i >= bufferLength )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+        else if( pBuffer[ i ] == '}' )
+        {
+            i++;
+            SkipJsonSpace( pBuffer, &( i ), bufferLength );
+            jsonResult = ( i == bufferLength ) ? JSONNotFound : JSONIllegalDocument;
+        }
+        else if( i != *pStart )
+        {
+            if( pBuffer[ i ] == ',' )
+            {
+                i++;
+                SkipJsonSpace( pBuffer, &( i ), bufferLength );
+            }
+            else
+            {
+                jsonResult = JSONIllegalDocument;
+            }
+        }
+        else
+        {
+            /* First member, no separator expected. */
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        keyStart = i;
+        jsonResult = SkipJsonString( pBuffer, &( i ), bufferLength );
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        pPair->key = &( pBuffer[ keyStart + 1 ] );
+        pPair->keyLength = i - keyStart - 2;
+
+        SkipJsonSpace( pBuffer, &( i ), bufferLength );
+
+        if( ( i >= bufferLength ) || ( pBuffer[ i ] != ':' ) )
+        {
+            jsonResult = JSONIllegalDocument;
+        }
+        else
+        {
+            i++;
+            SkipJsonSpace( pBuffer, &( i ), bufferLength );
+        }
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        valueStart = i;
+        jsonResult = SkipJsonValue( pBuffer, &( i ), bufferLength, 1, &( jsonType ) );
+    }
+
+    if( jsonResult == JSONSuccess )
+    {
+        pPair->jsonType = jsonType;
+
+        if( jsonType == JSONString )
+        {
+            /* Exclude the quotes, like JSON_Iterate. */
+            pPair->value = &( pBuffer[ valueStart + 1 ] );
+            pPair->valueLength = i - valueStart - 2;
+        }
+        else
+        {
+            pPair->value = &( pBuffer[ valueStart ] );
+            pPair->valueLength = i - valueStart;
+        }
+
+        SkipJsonSpace( pBuffer, &( i ), bufferLength );
+        *pNext = i;
+    }
+
+    return jsonResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static WssRecvStreamFragment_t * GetWssRecvStreamFragment( WssRecvStreamUpdate_t * pUpdate,
+                                                            uint8_t field )
+{
+    WssRecvStreamFragment_t * pFragment;
+
+    switch( field )
+    {
+        case WSS_RECV_STREAM_FIELD_SENDER_CLIENT_ID:
+            pFragment = &( pUpdate->senderClientId );
+            break;
+
+        case WSS_RECV_STREAM_FIELD_MESSAGE_PAYLOAD:
+            pFragment = &( pUpdate->base64EncodedPayload );
+            break;
+
+        case WSS_RECV_STREAM_FIELD_CORRELATION_ID:
+            pFragment = &( pUpdate->correlationId );
+            break;
+
+        case WSS_RECV_STREAM_FIELD_ERROR_TYPE:
+            pFragment = &( pUpdate->errorType );
+            break;
+
+        case WSS_RECV_STREAM_FIELD_STATUS_CODE:
+            pFragment = &( pUpdate->statusCode );
+            break;
+
+        case WSS_RECV_STREAM_FIELD_DESCRIPTION:
+            pFragment = &( pUpdate->description );
+            break;
+
+        default:
+            /* The message type and the status response are not reported as fragments. */
+            pFragment = NULL;
+            break;
+    }
+
+    return pFragment;
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendWssRecvStreamToken( WssRecvStream_t * pStream,
+                                      const char * pData,
+                                      size_t length )
+{
+    if( ( pStream->tokenLength + length ) > SIGNALING_WSS_RECV_STREAM_TOKEN_MAX_LEN )
+    {
+        /* Too long for any known token, make sure it never matches one. */
+        pStream->tokenLength = SIGNALING_WSS_RECV_STREAM_TOKEN_MAX_LEN + 1U;
+    }
+    else
+    {
+        memcpy( &( pStream->token[ pStream->tokenLength ] ), pData, length );
+        pStream->tokenLength += length;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t OpenWssRecvStreamContainer( WssRecvStream_t * pStream,
+                                                     uint8_t isArray )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pStream->depth >= SIGNALING_JSON_MAX_DEPTH )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+    else
+    {
+        if( isArray != 0U )
+        {
+            pStream->arrayMask |= ( ( uint32_t ) 1U << pStream->depth );
+            pStream->state = WSS_RECV_STREAM_STATE_VALUE_OR_END;
+        }
+        else
+        {
+            pStream->arrayMask &= ~( ( uint32_t ) 1U << pStream->depth );
+            pStream->state = WSS_RECV_STREAM_STATE_KEY_OR_END;
+        }
+
+        pStream->depth++;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t CloseWssRecvStreamContainer( WssRecvStream_t * pStream,
+                                                      char closingBracket )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint8_t isArray = ( uint8_t ) ( ( pStream->arrayMask >> ( pStream->depth - 1U ) ) & 1U );
+
+    if( closingBracket != ( ( isArray != 0U ) ? ']' : '}' ) )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+    else
+    {
+        if( ( pStream->inStatusResponse != 0U ) && ( pStream->depth == 2U ) )
+        {
+            pStream->hasStatusResponse = 1U;
+            pStream->inStatusResponse = 0U;
+        }
+
+        pStream->depth--;
+
+        if( pStream->depth == 0U )
+        {
+            pStream->state = WSS_RECV_STREAM_STATE_DONE;
+
+            /* Like Signaling_ParseWssRecvMessage, only the last statusResponse
+             * is kept, so only that one must not be empty. */
+            if( ( pStream->hasStatusResponse != 0U ) && ( pStream->statusResponseMemberCount == 0U ) )
+            {
+                result = SIGNALING_RESULT_INVALID_STATUS_RESPONSE;
+            }
+        }
+        else
+        {
+            EndWssRecvStreamValue( pStream );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void EndWssRecvStreamValue( WssRecvStream_t * pStream )
+{
+    pStream->field = WSS_RECV_STREAM_FIELD_NONE;
+    pStream->state = WSS_RECV_STREAM_STATE_COMMA_OR_END;
+}
+
+/*-----------------------------------------------------------*/
+
+static void EndWssRecvStreamString( WssRecvStream_t * pStream )
+{
+    SignalingJsonToken_t token = SIGNALING_JSON_TOKEN_UNKNOWN;
+
+    if( pStream->tokenLength <= SIGNALING_WSS_RECV_STREAM_TOKEN_MAX_LEN )
+    {
+        token = LookupJsonToken( pStream->token, pStream->tokenLength );
+    }
+
+    if( pStream->isKey == 0U )
+    {
+        if( pStream->field == WSS_RECV_STREAM_FIELD_MESSAGE_TYPE )
+        {
+            pStream->messageType = ( token == SIGNALING_JSON_TOKEN_UNKNOWN ) ? SIGNALING_TYPE_MESSAGE_UNKNOWN :
+                                   GetMessageTypeFromString( pStream->token, pStream->tokenLength );
+        }
+
+        EndWssRecvStreamValue( pStream );
+    }
+    else
+    {
+        pStream->field = WSS_RECV_STREAM_FIELD_NONE;
+        pStream->state = WSS_RECV_STREAM_STATE_COLON;
+
+        if( pStream->depth == 1U )
+        {
+            switch( token )
+            {
+                case SIGNALING_JSON_TOKEN_SENDER_CLIENT_ID:
+                    pStream->field = WSS_RECV_STREAM_FIELD_SENDER_CLIENT_ID;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_MESSAGE_TYPE:
+                    pStream->field = WSS_RECV_STREAM_FIELD_MESSAGE_TYPE;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_MESSAGE_PAYLOAD:
+                    pStream->field = WSS_RECV_STREAM_FIELD_MESSAGE_PAYLOAD;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_STATUS_RESPONSE:
+                    pStream->field = WSS_RECV_STREAM_FIELD_STATUS_RESPONSE;
+                    break;
+
+                default:
+                    /* Do nothing, ignore unknown tags. */
+                    break;
+            }
+        }
+        else if( ( pStream->depth == 2U ) && ( pStream->inStatusResponse != 0U ) )
+        {
+            switch( token )
+            {
+                case SIGNALING_JSON_TOKEN_CORRELATION_ID:
+                    pStream->field = WSS_RECV_STREAM_FIELD_CORRELATION_ID;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_ERROR_TYPE:
+                    pStream->field = WSS_RECV_STREAM_FIELD_ERROR_TYPE;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_STATUS_CODE:
+                    pStream->field = WSS_RECV_STREAM_FIELD_STATUS_CODE;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_DESCRIPTION:
+                    pStream->field = WSS_RECV_STREAM_FIELD_DESCRIPTION;
+                    break;
+
+                default:
+                    /* Do nothing, ignore unknown tags. */
+                    break;
+            }
+        }
+        else
+        {
+            /* Members of nested values are skipped. */
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t StartWssRecvStreamValue( WssRecvStream_t * pStream,
+                                                  const char * pChunk,
+                                                  size_t * pIndex,
+                                                  WssRecvStreamUpdate_t * pUpdate )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    char c = pChunk[ *pIndex ];
+    uint8_t field = pStream->field;
+    WssRecvStreamFragment_t * pFragment;
+
+    if( field == WSS_RECV_STREAM_FIELD_STATUS_RESPONSE )
+    {
+        if( c != '{' )
+        {
+            result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+        }
+    }
+    else if( ( field != WSS_RECV_STREAM_FIELD_NONE ) && ( c != '"' ) )
+    {
+        /* Only string values are reported, anything else is skipped. */
+        if( field == WSS_RECV_STREAM_FIELD_MESSAGE_TYPE )
+        {
+            pStream->messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
+        }
+
+        field = WSS_RECV_STREAM_FIELD_NONE;
+        pStream->field = WSS_RECV_STREAM_FIELD_NONE;
+    }
+    else
+    {
+        /* Any value is accepted for unknown members. */
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        switch( c )
+        {
+            case '"':
+                pStream->state = WSS_RECV_STREAM_STATE_STRING;
+                pStream->isKey = 0U;
+                pStream->tokenLength = 0U;
+                pFragment = GetWssRecvStreamFragment( pUpdate, field );
+
+                if( pFragment != NULL )
+                {
+                    pFragment->pData = &( pChunk[ *pIndex + 1U ] );
+                    pFragment->length = 0U;
+                    pFragment->isFirstFragment = 1U;
+                    pFragment->isLastFragment = 0U;
+                }
+                break;
+
+            case '{':
+            case '[':
+                pStream->field = WSS_RECV_STREAM_FIELD_NONE;
+                result = OpenWssRecvStreamContainer( pStream, ( c == '[' ) ? 1U : 0U );
+
+                if( field == WSS_RECV_STREAM_FIELD_STATUS_RESPONSE )
+                {
+                    pStream->inStatusResponse = 1U;
+                    pStream->statusResponseMemberCount = 0U;
+                }
+                break;
+
+            case 't':
+            case 'f':
+            case 'n':
+                pStream->state = WSS_RECV_STREAM_STATE_LITERAL;
+                pStream->literal = ( uint8_t ) c;
+                pStream->literalIndex = 1U;
+                break;
+
+            case '-':
+                pStream->state = WSS_RECV_STREAM_STATE_NUMBER;
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_MINUS;
+                break;
+
+            default:
+                if( SIGNALING_IS_JSON_DIGIT( c ) )
+                {
+                    pStream->state = WSS_RECV_STREAM_STATE_NUMBER;
+                    pStream->numberState = ( c == '0' ) ? WSS_RECV_STREAM_NUMBER_ZERO : WSS_RECV_STREAM_NUMBER_INTEGER;
+                }
+                else
+                {
+                    result = SIGNALING_RESULT_INVALID_JSON;
+                }
+                break;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        ( *pIndex )++;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t FeedWssRecvStreamStructure( WssRecvStream_t * pStream,
+                                                     const char * pChunk,
+                                                     size_t * pIndex,
+                                                     WssRecvStreamUpdate_t * pUpdate )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    char c = pChunk[ *pIndex ];
+
+    if( SIGNALING_IS_JSON_SPACE( c ) && ( pStream->state != WSS_RECV_STREAM_STATE_TERMINATED ) )
+    {
+        ( *pIndex )++;
+    }
+    else if( ( c == '\0' ) && ( pStream->state == WSS_RECV_STREAM_STATE_DONE ) )
+    {
+        /* One null terminator may end the message, as for
+         * Signaling_ParseWssRecvMessage. Nothing may follow it. */
+        pStream->state = WSS_RECV_STREAM_STATE_TERMINATED;
+        ( *pIndex )++;
+    }
+    else
+    {
+        switch( pStream->state )
+        {
+            case WSS_RECV_STREAM_STATE_BEGIN:
+                if( c == '{' )
+                {
+                    result = OpenWssRecvStreamContainer( pStream, 0U );
+                    ( *pIndex )++;
+                }
+                else
+                {
+                    result = SIGNALING_RESULT_INVALID_JSON;
+                }
+                break;
+
+            case WSS_RECV_STREAM_STATE_KEY_OR_END:
+            case WSS_RECV_STREAM_STATE_KEY:
+                if( c == '"' )
+                {
+                    pStream->state = WSS_RECV_STREAM_STATE_STRING;
+                    pStream->isKey = 1U;
+                    pStream->tokenLength = 0U;
+
+                    if( ( pStream->inStatusResponse != 0U ) && ( pStream->depth == 2U ) )
+                    {
+                        pStream->statusResponseMemberCount = 1U;
+                    }
+
+                    ( *pIndex )++;
+                }
+                else if( ( c == '}' ) && ( pStream->state == WSS_RECV_STREAM_STATE_KEY_OR_END ) )
+                {
+                    result = CloseWssRecvStreamContainer( pStream, c );
+                    ( *pIndex )++;
+                }
+                else
+                {
+                    result = SIGNALING_RESULT_INVALID_JSON;
+                }
+                break;
+
+            case WSS_RECV_STREAM_STATE_COLON:
+                if( c == ':' )
+                {
+                    pStream->state = WSS_RECV_STREAM_STATE_VALUE;
+                    ( *pIndex )++;
+                }
+                else
+                {
+                    result = SIGNALING_RESULT_INVALID_JSON;
+                }
+                break;
+
+            case WSS_RECV_STREAM_STATE_VALUE_OR_END:
+                if( c == ']' )
+                {
+                    result = CloseWssRecvStreamContainer( pStream, c );
+                    ( *pIndex )++;
+                }
+                else
+                {
+                    result = StartWssRecvStreamValue( pStream, pChunk, pIndex, pUpdate );
+                }
+                break;
+
+            case WSS_RECV_STREAM_STATE_VALUE:
+                result = StartWssRecvStreamValue( pStream, pChunk, pIndex, pUpdate );
+                break;
+
+            case WSS_RECV_STREAM_STATE_COMMA_OR_END:
+                if( c == ',' )
+                {
+                    pStream->state = ( ( ( pStream->arrayMask >> ( pStream->depth - 1U ) ) & 1U ) != 0U ) ?
+                                     WSS_RECV_STREAM_STATE_VALUE : WSS_RECV_STREAM_STATE_KEY;
+                    ( *pIndex )++;
+                }
+                else if( ( c == '}' ) || ( c == ']' ) )
+                {
+                    result = CloseWssRecvStreamContainer( pStream, c );
+                    ( *pIndex )++;
+                }
+                else
+                {
+                    result = SIGNALING_RESULT_INVALID_JSON;
+                }
+                break;
+
+            default:
+                /* Only whitespace and a null terminator may follow the message. */
+                result = SIGNALING_RESULT_INVALID_JSON;
+                break;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t FeedWssRecvStreamEscape( WssRecvStream_t * pStream,
+                                                  char c )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint8_t digit = 0xFFU;
+
+    switch( pStream->escapeState )
+    {
+        case WSS_RECV_STREAM_ESCAPE_BACKSLASH:
+            if( c == 'u' )
+            {
+                pStream->escapeState = WSS_RECV_STREAM_ESCAPE_HEX;
+                pStream->hexRemaining = 4U;
+                pStream->hexValue = 0U;
+            }
+            else if( ( c == '"' ) || ( c == '\\' ) || ( c == '/' ) ||
+                     ( c == 'b' ) || ( c == 'f' ) || ( c == 'n' ) ||
+                     ( c == 'r' ) || ( c == 't' ) )
+            {
+                pStream->escapeState = WSS_RECV_STREAM_ESCAPE_NONE;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        case WSS_RECV_STREAM_ESCAPE_LOW_BACKSLASH:
+            if( c == '\\' )
+            {
+                pStream->escapeState = WSS_RECV_STREAM_ESCAPE_LOW_U;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        case WSS_RECV_STREAM_ESCAPE_LOW_U:
+            if( c == 'u' )
+            {
+                pStream->escapeState = WSS_RECV_STREAM_ESCAPE_LOW_HEX;
+                pStream->hexRemaining = 4U;
+                pStream->hexValue = 0U;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        default:
+            /* Inside the digits of a \uXXXX escape. */
+            if( SIGNALING_IS_JSON_DIGIT( c ) )
+            {
+                digit = ( uint8_t ) ( c - '0' );
+            }
+            else if( ( c >= 'a' ) && ( c <= 'f' ) )
+            {
+                digit = ( uint8_t ) ( c - 'a' + 10 );
+            }
+            else if( ( c >= 'A' ) && ( c <= 'F' ) )
+            {
+                digit = ( uint8_t ) ( c - 'A' + 10 );
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+
+            if( result == SIGNALING_RESULT_OK )
+            {
+                pStream->hexValue = ( uint16_t ) ( ( pStream->hexValue << 4 ) | digit );
+                pStream->hexRemaining--;
+            }
+
+            if( ( result == SIGNALING_RESULT_OK ) && ( pStream->hexRemaining == 0U ) )
+            {
+                /* Like SkipJsonEscape, NUL and unpaired surrogates are rejected. */
+                if( pStream->escapeState == WSS_RECV_STREAM_ESCAPE_LOW_HEX )
+                {
+                    if( ( pStream->hexValue < 0xDC00U ) || ( pStream->hexValue > 0xDFFFU ) )
+                    {
+                        result = SIGNALING_RESULT_INVALID_JSON;
+                    }
+                    else
+                    {
+                        pStream->escapeState = WSS_RECV_STREAM_ESCAPE_NONE;
+                    }
+                }
+                else if( ( pStream->hexValue == 0U ) ||
+                         ( ( pStream->hexValue >= 0xDC00U ) && ( pStream->hexValue <= 0xDFFFU ) ) )
+                {
+                    result = SIGNALING_RESULT_INVALID_JSON;
+                }
+                else if( ( pStream->hexValue >= 0xD800U ) && ( pStream->hexValue <= 0xDBFFU ) )
+                {
+                    pStream->escapeState = WSS_RECV_STREAM_ESCAPE_LOW_BACKSLASH;
+                }
+                else
+                {
+                    pStream->escapeState = WSS_RECV_STREAM_ESCAPE_NONE;
+                }
+            }
+            break;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t StartWssRecvStreamUtf8( WssRecvStream_t * pStream,
+                                                 uint8_t leadByte )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    /* The allowed range of the first continuation byte excludes overlong
+     * encodings, surrogates and code points above U+10FFFF, which is what
+     * SkipJsonUtf8 checks on the decoded code point. */
+    pStream->utf8Min = 0x80U;
+    pStream->utf8Max = 0xBFU;
+
+    if( ( leadByte >= 0xC2U ) && ( leadByte <= 0xDFU ) )
+    {
+        pStream->utf8Remaining = 1U;
+    }
+    else if( ( leadByte >= 0xE0U ) && ( leadByte <= 0xEFU ) )
+    {
+        pStream->utf8Remaining = 2U;
+        pStream->utf8Min = ( leadByte == 0xE0U ) ? 0xA0U : 0x80U;
+        pStream->utf8Max = ( leadByte == 0xEDU ) ? 0x9FU : 0xBFU;
+    }
+    else if( ( leadByte >= 0xF0U ) && ( leadByte <= 0xF4U ) )
+    {
+        pStream->utf8Remaining = 3U;
+        pStream->utf8Min = ( leadByte == 0xF0U ) ? 0x90U : 0x80U;
+        pStream->utf8Max = ( leadByte == 0xF4U ) ? 0x8FU : 0xBFU;
+    }
+    else
+    {
+        /* Stray continuation byte or invalid lead byte. */
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t FeedWssRecvStreamString( WssRecvStream_t * pStream,
+                                                  const char * pChunk,
+                                                  size_t chunkLength,
+                                                  size_t * pIndex,
+                                                  WssRecvStreamUpdate_t * pUpdate )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t i = *pIndex, runStart;
+    uint8_t c;
+    uint8_t isToken = ( ( pStream->isKey != 0U ) || ( pStream->field == WSS_RECV_STREAM_FIELD_MESSAGE_TYPE ) ) ? 1U : 0U;
+    WssRecvStreamFragment_t * pFragment = NULL;
+
+    if( pStream->isKey == 0U )
+    {
+        pFragment = GetWssRecvStreamFragment( pUpdate, pStream->field );
+    }
+
+    while( ( result == SIGNALING_RESULT_OK ) &&
+           ( i < chunkLength ) &&
+           ( pStream->state == WSS_RECV_STREAM_STATE_STRING ) )
+    {
+        c = ( uint8_t ) pChunk[ i ];
+
+        if( pStream->escapeState != WSS_RECV_STREAM_ESCAPE_NONE )
+        {
+            result = FeedWssRecvStreamEscape( pStream, ( char ) c );
+        }
+        else if( pStream->utf8Remaining != 0U )
+        {
+            if( ( c < pStream->utf8Min ) || ( c > pStream->utf8Max ) )
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            else
+            {
+                pStream->utf8Remaining--;
+                pStream->utf8Min = 0x80U;
+                pStream->utf8Max = 0xBFU;
+            }
+        }
+        else
+        {
+            /* Skip the bytes that need no attention in one go. */
+            runStart = i;
+            i = ScanJsonStringRun( pChunk, i, chunkLength );
+
+            if( isToken != 0U )
+            {
+                AppendWssRecvStreamToken( pStream, &( pChunk[ runStart ] ), i - runStart );
+            }
+
+            if( i >= chunkLength )
+            {
+                /* The string continues in the next chunk. */
+                break;
+            }
+
+            c = ( uint8_t ) pChunk[ i ];
+
+            if( c == ( uint8_t ) '"' )
+            {
+                if( pFragment != NULL )
+                {
+                    pFragment->length = ( size_t ) ( &( pChunk[ i ] ) - pFragment->pData );
+                    pFragment->isLastFragment = 1U;
+                }
+
+                EndWssRecvStreamString( pStream );
+            }
+            else if( c == ( uint8_t ) '\\' )
+            {
+                pStream->escapeState = WSS_RECV_STREAM_ESCAPE_BACKSLASH;
+            }
+            else if( c < 0x20U )
+            {
+                /* Control characters must be escaped. */
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            else
+            {
+                result = StartWssRecvStreamUtf8( pStream, c );
+            }
+        }
+
+        if( result == SIGNALING_RESULT_OK )
+        {
+            /* The closing quote is not part of the token. */
+            if( ( isToken != 0U ) && ( pStream->state == WSS_RECV_STREAM_STATE_STRING ) )
+            {
+                AppendWssRecvStreamToken( pStream, &( pChunk[ i ] ), 1U );
+            }
+
+            i++;
+        }
+    }
+
+    *pIndex = i;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t FeedWssRecvStreamNumber( WssRecvStream_t * pStream,
+                                                  char c,
+                                                  size_t * pIndex )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint8_t isDigit = SIGNALING_IS_JSON_DIGIT( c ) ? 1U : 0U;
+    uint8_t isExponent = ( ( c == 'e' ) || ( c == 'E' ) ) ? 1U : 0U;
+    uint8_t isEnd = 0U;
+
+    switch( pStream->numberState )
+    {
+        case WSS_RECV_STREAM_NUMBER_MINUS:
+            if( c == '0' )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_ZERO;
+            }
+            else if( isDigit != 0U )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_INTEGER;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        case WSS_RECV_STREAM_NUMBER_ZERO:
+        case WSS_RECV_STREAM_NUMBER_INTEGER:
+            if( ( isDigit != 0U ) && ( pStream->numberState == WSS_RECV_STREAM_NUMBER_INTEGER ) )
+            {
+                /* Leading zeros are not allowed, so digits only follow 1-9. */
+            }
+            else if( c == '.' )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_DOT;
+            }
+            else if( isExponent != 0U )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_EXPONENT;
+            }
+            else
+            {
+                isEnd = 1U;
+            }
+            break;
+
+        case WSS_RECV_STREAM_NUMBER_DOT:
+            if( isDigit != 0U )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_FRACTION;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        case WSS_RECV_STREAM_NUMBER_FRACTION:
+            if( isDigit != 0U )
+            {
+                /* More fraction digits. */
+            }
+            else if( isExponent != 0U )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_EXPONENT;
+            }
+            else
+            {
+                isEnd = 1U;
+            }
+            break;
+
+        case WSS_RECV_STREAM_NUMBER_EXPONENT:
+            if( ( c == '+' ) || ( c == '-' ) )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_EXPONENT_SIGN;
+            }
+            else if( isDigit != 0U )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_EXPONENT_DIGITS;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        case WSS_RECV_STREAM_NUMBER_EXPONENT_SIGN:
+            if( isDigit != 0U )
+            {
+                pStream->numberState = WSS_RECV_STREAM_NUMBER_EXPONENT_DIGITS;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+            break;
+
+        default:
+            /* Inside the exponent digits. */
+            if( isDigit == 0U )
+            {
+                isEnd = 1U;
+            }
+            break;
+    }
+
+    if( isEnd != 0U )
+    {
+        /* The character after the number belongs to the enclosing
+         * collection, leave it for FeedWssRecvStreamStructure. */
+        EndWssRecvStreamValue( pStream );
+    }
+    else if( result == SIGNALING_RESULT_OK )
+    {
+        ( *pIndex )++;
+    }
+    else
+    {
+        /* Invalid number. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t FeedWssRecvStreamLiteral( WssRecvStream_t * pStream,
+                                                   char c,
+                                                   size_t * pIndex )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    const char * pLiteral;
+
+    if( pStream->literal == ( uint8_t ) 't' )
+    {
+        pLiteral = "true";
+    }
+    else if( pStream->literal == ( uint8_t ) 'f' )
+    {
+        pLiteral = "false";
+    }
+    else
+    {
+        pLiteral = "null";
+    }
+
+    if( c != pLiteral[ pStream->literalIndex ] )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+    else
+    {
+        pStream->literalIndex++;
+        ( *pIndex )++;
+
+        if( pLiteral[ pStream->literalIndex ] == '\0' )
+        {
+            EndWssRecvStreamValue( pStream );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t DecodeBase64( const char * pInput,
+                                       size_t inputLength,
+                                       char * pOutput,
+                                       size_t * pOutputLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t i = 0, o = 0, paddingLength = 0, dataLength, decodedLength = 0;
+    uint8_t a, b, c, d;
+
+    #if defined( SIGNALING_BASE64_AVX2 )
+        /* Classify every character by its nibbles, see "Faster Base64
+         * Encoding and Decoding using AVX2 Instructions" by Muła and Lemire. */
+        const __m256i lutLow = _mm256_setr_epi8( 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A );
+        const __m256i lutHigh = _mm256_setr_epi8( 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                  0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 );
+        const __m256i lutRoll = _mm256_setr_epi8( 0, 16, 19, 4, -65, -65, -71, -71,
+                                                  0, 0, 0, 0, 0, 0, 0, 0,
+                                                  0, 16, 19, 4, -65, -65, -71, -71,
+                                                  0, 0, 0, 0, 0, 0, 0, 0 );
+        const __m256i nibbleMask = _mm256_set1_epi8( 0x0F );
+        const __m256i slashes = _mm256_set1_epi8( '/' );
+        const __m256i packBytes = _mm256_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 );
+        const __m256i packLanes = _mm256_setr_epi32( 0, 1, 2, 4, 5, 6, -1, -1 );
+        __m256i chunk, highNibbles, lowLookup, highLookup, values;
+    #elif defined( SIGNALING_BASE64_NEON )
+        uint8x16x4_t lowTable, highTable, chunk, values;
+        uint8x16x3_t bytes;
+        uint8x16_t invalid;
+        const uint8x16_t offset = vdupq_n_u8( 0x40U );
+        size_t k;
+    #endif /* if defined( SIGNALING_BASE64_AVX2 ) */
+
+    /* Up to two padding characters, only on a complete last quantum. */
+    if( ( inputLength > 0U ) &&
+        ( ( inputLength % 4U ) == 0U ) &&
+        ( pInput[ inputLength - 1U ] == '=' ) )
+    {
+        paddingLength = ( pInput[ inputLength - 2U ] == '=' ) ? 2U : 1U;
+    }
+
+    dataLength = inputLength - paddingLength;
+
+    if( ( dataLength % 4U ) == 1U )
+    {
+        result = SIGNALING_RESULT_INVALID_BASE64;
+    }
+    else
+    {
+        decodedLength = ( ( dataLength / 4U ) * 3U ) + ( ( ( dataLength % 4U ) == 0U ) ? 0U : ( ( dataLength % 4U ) - 1U ) );
+
+        if( decodedLength > *pOutputLength )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    /* The vector loops store whole registers, so they stop while the output
+     * still has room for one. The output never overtakes the input, which
+     * keeps in-place decoding safe. A block with a character outside the
+     * alphabet is left to the scalar loop, which reports it. */
+    #if defined( SIGNALING_BASE64_AVX2 )
+        while( ( result == SIGNALING_RESULT_OK ) &&
+               ( ( dataLength - i ) >= 32U ) &&
+               ( ( *pOutputLength - o ) >= 32U ) )
+        {
+            chunk = _mm256_loadu_si256( ( const __m256i * ) &( pInput[ i ] ) );
+            highNibbles = _mm256_and_si256( _mm256_srli_epi32( chunk, 4 ), nibbleMask );
+            lowLookup = _mm256_shuffle_epi8( lutLow, _mm256_and_si256( chunk, nibbleMask ) );
+            highLookup = _mm256_shuffle_epi8( lutHigh, highNibbles );
+
+            if( _mm256_testz_si256( lowLookup, highLookup ) == 0 )
+            {
+                break;
+            }
+
+            values = _mm256_add_epi8( chunk,
+                                      _mm256_shuffle_epi8( lutRoll,
+                                                           _mm256_add_epi8( _mm256_cmpeq_epi8( chunk, slashes ),
+                                                                            highNibbles ) ) );
+
+            /* Merge four 6-bit values into 24 bits and drop the gaps. */
+            values = _mm256_maddubs_epi16( values, _mm256_set1_epi32( 0x01400140 ) );
+            values = _mm256_madd_epi16( values, _mm256_set1_epi32( 0x00011000 ) );
+            values = _mm256_shuffle_epi8( values, packBytes );
+            values = _mm256_permutevar8x32_epi32( values, packLanes );
+            _mm256_storeu_si256( ( __m256i * ) &( pOutput[ o ] ), values );
+
+            i += 32U;
+            o += 24U;
+        }
+    #elif defined( SIGNALING_BASE64_NEON )
+        for( k = 0; k < 4U; k++ )
+        {
+            lowTable.val[ k ] = vld1q_u8( &( gBase64DecodeTable[ k * 16U ] ) );
+            highTable.val[ k ] = vld1q_u8( &( gBase64DecodeTable[ 64U + ( k * 16U ) ] ) );
+        }
+
+        while( ( result == SIGNALING_RESULT_OK ) &&
+               ( ( dataLength - i ) >= 64U ) &&
+               ( ( *pOutputLength - o ) >= 48U ) )
+        {
+            chunk = vld4q_u8( ( const uint8_t * ) &( pInput[ i ] ) );
+            invalid = vdupq_n_u8( 0U );
+
+            for( k = 0; k < 4U; k++ )
+            {
+                /* Characters below 0x40 come from the first table, the
+                 * others from the second one. Bytes above 0x7F are
+                 * caught by their high bit. */
+                values.val[ k ] = vqtbx4q_u8( vqtbl4q_u8( lowTable, chunk.val[ k ] ),
+                                              highTable,
+                                              vsubq_u8( chunk.val[ k ], offset ) );
+                invalid = vorrq_u8( invalid, vorrq_u8( values.val[ k ], chunk.val[ k ] ) );
+            }
+
+            if( vmaxvq_u8( invalid ) >= 0x80U )
+            {
+                break;
+            }
+
+            bytes.val[ 0 ] = vorrq_u8( vshlq_n_u8( values.val[ 0 ], 2 ), vshrq_n_u8( values.val[ 1 ], 4 ) );
+            bytes.val[ 1 ] = vorrq_u8( vshlq_n_u8( values.val[ 1 ], 4 ), vshrq_n_u8( values.val[ 2 ], 2 ) );
+            bytes.val[ 2 ] = vorrq_u8( vshlq_n_u8( values.val[ 2 ], 6 ), values.val[ 3 ] );
+            vst3q_u8( ( uint8_t * ) &( pOutput[ o ] ), bytes );
+
+            i += 64U;
+            o += 48U;
+        }
+    #endif /* if defined( SIGNALING_BASE64_AVX2 ) */
+
+    while( ( result == SIGNALING_RESULT_OK ) && ( ( dataLength - i ) >= 4U ) )
+    {
+        a = gBase64DecodeTable[ ( uint8_t ) pInput[ i ] ];
+        b = gBase64DecodeTable[ ( uint8_t ) pInput[ i + 1U ] ];
+        c = gBase64DecodeTable[ ( uint8_t ) pInput[ i + 2U ] ];
+        d = gBase64DecodeTable[ ( uint8_t ) pInput[ i + 3U ] ];
+
+        if( ( ( a | b | c | d ) & 0xC0U ) != 0U )
+        {
+            result = SIGNALING_RESULT_INVALID_BASE64;
+        }
+        else
+        {
+            pOutput[ o ] = ( char ) ( ( a << 2 ) | ( b >> 4 ) );
+            pOutput[ o + 1U ] = ( char ) ( ( b << 4 ) | ( c >> 2 ) );
+            pOutput[ o + 2U ] = ( char ) ( ( c << 6 ) | d );
+            i += 4U;
+            o += 3U;
+        }
+    }
+
+    /* Last quantum without padding, two or three characters. */
+    if( ( result == SIGNALING_RESULT_OK ) && ( i < dataLength ) )
+    {
+        a = gBase64DecodeTable[ ( uint8_t ) pInput[ i ] ];
+        b = gBase64DecodeTable[ ( uint8_t ) pInput[ i + 1U ] ];
+        c = ( ( dataLength - i ) == 3U ) ? gBase64DecodeTable[ ( uint8_t ) pInput[ i + 2U ] ] : 0U;
+
+        if( ( ( a | b | c ) & 0xC0U ) != 0U )
+        {
+            result = SIGNALING_RESULT_INVALID_BASE64;
+        }
+        else
+        {
+            pOutput[ o ] = ( char ) ( ( a << 2 ) | ( b >> 4 ) );
+            o++;
+
+            if( ( dataLength - i ) == 3U )
+            {
+                pOutput[ o ] = ( char ) ( ( b << 4 ) | ( c >> 2 ) );
+                o++;
+            }
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *pOutputLength = o;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void EncodeBase64( const char * pInput,
+                          size_t inputLength,
+                          char * pOutput )
+{
+    size_t i = 0, o = 0;
+    uint32_t triple;
+
+    #if defined( SIGNALING_BASE64_AVX2 )
+        const __m256i spreadBytes = _mm256_setr_epi8( 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 );
+        const __m256i shiftLut = _mm256_setr_epi8( 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                                   '/' - 63, 'A', 0, 0,
+                                                   'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                                   '/' - 63, 'A', 0, 0 );
+        __m256i chunk, indices, shifts;
+    #elif defined( SIGNALING_BASE64_NEON )
+        uint8x16x4_t alphabet, indices;
+        uint8x16x3_t bytes;
+        const uint8x16_t sixBits = vdupq_n_u8( 0x3FU );
+        size_t k;
+    #endif /* if defined( SIGNALING_BASE64_AVX2 ) */
+
+    #if defined( SIGNALING_BASE64_AVX2 )
+        /* Each 128-bit lane takes 12 input bytes. The second lane is loaded
+         * from offset 12, so 28 bytes must be readable. */
+        while( ( inputLength - i ) >= 28U )
+        {
+            chunk = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( ( const __m128i * ) &( pInput[ i ] ) ) ),
+                                             _mm_loadu_si128( ( const __m128i * ) &( pInput[ i + 12U ] ) ),
+                                             1 );
+            chunk = _mm256_shuffle_epi8( chunk, spreadBytes );
+
+            /* Move every 6-bit group into its own byte. */
+            indices = _mm256_or_si256( _mm256_mulhi_epu16( _mm256_and_si256( chunk, _mm256_set1_epi32( 0x0FC0FC00 ) ),
+                                                           _mm256_set1_epi32( 0x04000040 ) ),
+                                       _mm256_mullo_epi16( _mm256_and_si256( chunk, _mm256_set1_epi32( 0x003F03F0 ) ),
+                                                           _mm256_set1_epi32( 0x01000010 ) ) );
+
+            /* Map 0-25, 26-51, 52-61, 62 and 63 to their ranges of the alphabet. */
+            shifts = _mm256_subs_epu8( indices, _mm256_set1_epi8( 51 ) );
+            shifts = _mm256_or_si256( shifts,
+                                      _mm256_and_si256( _mm256_cmpgt_epi8( _mm256_set1_epi8( 26 ), indices ),
+                                                        _mm256_set1_epi8( 13 ) ) );
+            shifts = _mm256_shuffle_epi8( shiftLut, shifts );
+            _mm256_storeu_si256( ( __m256i * ) &( pOutput[ o ] ), _mm256_add_epi8( indices, shifts ) );
+
+            i += 24U;
+            o += 32U;
+        }
+    #elif defined( SIGNALING_BASE64_NEON )
+        for( k = 0; k < 4U; k++ )
+        {
+            alphabet.val[ k ] = vld1q_u8( ( const uint8_t * ) &( gBase64Alphabet[ k * 16U ] ) );
+        }
+
+        while( ( inputLength - i ) >= 48U )
+        {
+            bytes = vld3q_u8( ( const uint8_t * ) &( pInput[ i ] ) );
+            indices.val[ 0 ] = vshrq_n_u8( bytes.val[ 0 ], 2 );
+            indices.val[ 1 ] = vandq_u8( vorrq_u8( vshlq_n_u8( bytes.val[ 0 ], 4 ), vshrq_n_u8( bytes.val[ 1 ], 4 ) ), sixBits );
+            indices.val[ 2 ] = vandq_u8( vorrq_u8( vshlq_n_u8( bytes.val[ 1 ], 2 ), vshrq_n_u8( bytes.val[ 2 ], 6 ) ), sixBits );
+            indices.val[ 3 ] = vandq_u8( bytes.val[ 2 ], sixBits );
+
+            for( k = 0; k < 4U; k++ )
+            {
+                indices.val[ k ] = vqtbl4q_u8( alphabet, indices.val[ k ] );
+            }
+
+            vst4q_u8( ( uint8_t * ) &( pOutput[ o ] ), indices );
+
+            i += 48U;
+            o += 64U;
+        }
+    #endif /* if defined( SIGNALING_BASE64_AVX2 ) */
+
+    while( ( inputLength - i ) >= 3U )
+    {
+        triple = ( ( uint32_t ) ( uint8_t ) pInput[ i ] << 16 ) |
+                 ( ( uint32_t ) ( uint8_t ) pInput[ i + 1U ] << 8 ) |
+                 ( uint32_t ) ( uint8_t ) pInput[ i + 2U ];
+        pOutput[ o ] = gBase64Alphabet[ ( triple >> 18 ) & 0x3FU ];
+        pOutput[ o + 1U ] = gBase64Alphabet[ ( triple >> 12 ) & 0x3FU ];
+        pOutput[ o + 2U ] = gBase64Alphabet[ ( triple >> 6 ) & 0x3FU ];
+        pOutput[ o + 3U ] = gBase64Alphabet[ triple & 0x3FU ];
+        i += 3U;
+        o += 4U;
+    }
+
+    if( i < inputLength )
+    {
+        triple = ( uint32_t ) ( uint8_t ) pInput[ i ] << 16;
+
+        if( ( inputLength - i ) == 2U )
+        {
+            triple |= ( uint32_t ) ( uint8_t ) pInput[ i + 1U ] << 8;
+        }
+
+        pOutput[ o ] = gBase64Alphabet[ ( triple >> 18 ) & 0x3FU ];
+        pOutput[ o + 1U ] = gBase64Alphabet[ ( triple >> 12 ) & 0x3FU ];
+        pOutput[ o + 2U ] = ( ( inputLength - i ) == 2U ) ? gBase64Alphabet[ ( triple >> 6 ) & 0x3FU ] : '=';
+        pOutput[ o + 3U ] = '=';
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t UnescapeJsonString( char * pString,
+                                  size_t stringLength )
+{
+    size_t i = 0, outputLength = 0;
+    uint16_t value = 0, lowSurrogate = 0;
+    uint32_t codePoint;
+    const char * pBackslash;
+    char c;
+
+    /* Most values have no escape at all, and everything before the first
+     * backslash is already in place. */
+    pBackslash = memchr( pString, '\\', stringLength );
+
+    if( pBackslash == NULL )
+    {
+        outputLength = stringLength;
+    }
+    else
+    {
+        i = ( size_t ) ( pBackslash - pString );
+        outputLength = i;
+
+        /* The string was validated by SkipJsonString, so every escape is
+         * complete and every surrogate is paired. The output never grows
+         * past the input, which makes it safe to write in place. */
+        while( i < stringLength )
+        {
+            c = pString[ i ];
+
+            if( c != '\\' )
+            {
+                pString[ outputLength ] = c;
+                outputLength++;
+                i++;
+            }
+            else if( pString[ i + 1 ] == 'u' )
+            {
+                ( void ) ReadJsonHexEscape( pString, &( i ), stringLength, &( value ) );
+                codePoint = value;
+
+                if( ( value >= 0xD800U ) && ( value <= 0xDBFFU ) )
+                {
+                    ( void ) ReadJsonHexEscape( pString, &( i ), stringLength, &( lowSurrogate ) );
+                    codePoint = 0x10000U + ( ( ( uint32_t ) value - 0xD800U ) << 10 ) + ( ( uint32_t ) lowSurrogate - 0xDC00U );
+                }
+
+                if( codePoint < 0x80U )
+                {
+                    pString[ outputLength ] = ( char ) codePoint;
+                    outputLength++;
+                }
+                else if( codePoint < 0x800U )
+                {
+                    pString[ outputLength ] = ( char ) ( 0xC0U | ( codePoint >> 6 ) );
+                    pString[ outputLength + 1U ] = ( char ) ( 0x80U | ( codePoint & 0x3FU ) );
+                    outputLength += 2U;
+                }
+                else if( codePoint < 0x10000U )
+                {
+                    pString[ outputLength ] = ( char ) ( 0xE0U | ( codePoint >> 12 ) );
+                    pString[ outputLength + 1U ] = ( char ) ( 0x80U | ( ( codePoint >> 6 ) & 0x3FU ) );
+                    pString[ outputLength + 2U ] = ( char ) ( 0x80U | ( codePoint & 0x3FU ) );
+                    outputLength += 3U;
+                }
+                else
+                {
+                    pString[ outputLength ] = ( char ) ( 0xF0U | ( codePoint >> 18 ) );
+                    pString[ outputLength + 1U ] = ( char ) ( 0x80U | ( ( codePoint >> 12 ) & 0x3FU ) );
+                    pString[ outputLength + 2U ] = ( char ) ( 0x80U | ( ( codePoint >> 6 ) & 0x3FU ) );
+                    pString[ outputLength + 3U ] = ( char ) ( 0x80U | ( codePoint & 0x3FU ) );
+                    outputLength += 4U;
+                }
+            }
+            else
+            {
+                switch( pString[ i + 1 ] )
+                {
+                    case 'b':
+                        c = '\b';
+                        break;
+
+                    case 'f':
+                        c = '\f';
+                        break;
+
+                    case 'n':
+                        c = '\n';
+                        break;
+
+                    case 'r':
+                        c = '\r';
+                        break;
+
+                    case 't':
+                        c = '\t';
+                        break;
+
+                    default:
+                        /* '"', '\\' and '/' stand for themselves. */
+                        c = pString[ i + 1 ];
+                        break;
+                }
+
+                pString[ outputLength ] = c;
+                outputLength++;
+                i += 2U;
+            }
+        }
+    }
+
+    return outputLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static void UnescapeJsonValue( char * pMessage,
+                               const char ** ppValue,
+                               size_t * pValueLength )
+{
+    char * pValue;
+
+    if( *ppValue != NULL )
+    {
+        /* The value points into pMessage, so get back a writable pointer
+         * from its offset. */
+        pValue = &( pMessage[ *ppValue - pMessage ] );
+        *pValueLength = UnescapeJsonString( pValue, *pValueLength );
+        *ppValue = pValue;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendWssMessageToWriter( SignalingWriter_t * pWriter,
+                                      const WssSendMessage_t * pWssSendMessage,
+                                      const char * pRawPayload,
+                                      size_t rawPayloadLength )
+{
+    const char * pAction = GetStringFromMessageType( pWssSendMessage->messageType );
+
+    SIGNALING_APPEND_LITERAL( pWriter, "{\"action\":\"" );
+    AppendToWriter( pWriter, pAction, strlen( pAction ) );
+    SIGNALING_APPEND_LITERAL( pWriter, "\",\"RecipientClientId\":\"" );
+    AppendEscapedToWriter( pWriter, pWssSendMessage->pRecipientClientId, pWssSendMessage->recipientClientIdLength );
+    SIGNALING_APPEND_LITERAL( pWriter, "\",\"MessagePayload\":\"" );
+
+    if( pRawPayload == NULL )
+    {
+        AppendToWriter( pWriter, pWssSendMessage->pBase64EncodedMessage, pWssSendMessage->base64EncodedMessageLength );
+    }
+    else
+    {
+        /* Encode straight into the message, so the encoded payload is never
+         * stored anywhere else. */
+        AppendBase64ToWriter( pWriter, pRawPayload, rawPayloadLength );
+    }
+
+    SIGNALING_APPEND_LITERAL( pWriter, "\"" );
+
+    /* Append correlation ID. */
+    if( pWssSendMessage->correlationIdLength > 0 )
+    {
+        SIGNALING_APPEND_LITERAL( pWriter, ",\"CorrelationId\":\"" );
+        AppendEscapedToWriter( pWriter, pWssSendMessage->pCorrelationId, pWssSendMessage->correlationIdLength );
+        SIGNALING_APPEND_LITERAL( pWriter, "\"" );
+    }
+
+    SIGNALING_APPEND_LITERAL( pWriter, "}" );
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ConstructWssMessage( WssSendMessage_t * pWssSendMessage,
+                                              const char * pRawPayload,
+                                              size_t rawPayloadLength,
+                                              char * pBuffer,
+                                              size_t * pBufferLength )
+{
+    SignalingWriter_t writer;
+
+    InitWriter( &( writer ), pBuffer, *pBufferLength );
+    AppendWssMessageToWriter( &( writer ), pWssSendMessage, pRawPayload, rawPayloadLength );
+
+    return FinishWriter( &( writer ), pBufferLength );
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructDescribeSignalingChannelRequest( SignalingAwsRegion_t * pAwsRegion,
+                                                                      SignalingChannelName_t * pChannelName,
+                                                                      SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+
+    if( ( pAwsRegion == NULL ) ||
+        ( pAwsRegion->pAwsRegion == NULL ) ||
+        ( pChannelName == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendControlPlaneUrl( &( urlWriter ), pAwsRegion );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "describeSignalingChannel" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"ChannelName\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ), pChannelName->pChannelName, pChannelName->channelNameLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseDescribeSignalingChannelResponse( const char * pMessage,
+                                                                   size_t messageLength,
+                                                                   SignalingChannelInfo_t * pChannelInfo )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    const char * pChannelInfoBuffer = NULL;
+    size_t channelInfoBufferLength;
+    size_t channelInfoStart = 0, channelInfoNext = 0;
+
+    if( ( pMessage == NULL ) ||
+        ( pChannelInfo == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    #if !defined( SIGNALING_TRUST_CONTROL_PLANE_RESPONSES )
+        if( result == SIGNALING_RESULT_OK )
+        {
+            jsonResult = JSON_Validate( pMessage, messageLength );
+
+            if( jsonResult != JSONSuccess )
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+        }
+    #endif /* #if !defined( SIGNALING_TRUST_CONTROL_PLANE_RESPONSES ) */
+
+    if( result == SIGNALING_RESULT_OK )
     {
         memset( pChannelInfo, 0, sizeof( SignalingChannelInfo_t ) );
 
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            if( ( pair.jsonType != JSONObject ) ||
+                ( LookupJsonToken( pair.key, pair.keyLength ) != SIGNALING_JSON_TOKEN_CHANNEL_INFO ) )
+            {
+                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+            }
+            else
+            {
+                pChannelInfoBuffer = pair.value;
+                channelInfoBufferLength = pair.valueLength;
+            }
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Iterate( pChannelInfoBuffer, channelInfoBufferLength, &( channelInfoStart ), &( channelInfoNext ), &( pair ) );
+
+        while( jsonResult == JSONSuccess )
+        {
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_CHANNEL_ARN:
+                    pChannelInfo->channelArn.pChannelArn = pair.value;
+                    pChannelInfo->channelArn.channelArnLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_CHANNEL_NAME:
+                    if( pair.valueLength < SIGNALING_CHANNEL_NAME_MAX_LEN )
+                    {
+                        pChannelInfo->channelName.pChannelName = pair.value;
+                        pChannelInfo->channelName.channelNameLength = pair.valueLength;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_INVALID_CHANNEL_NAME;
+                    }
+                    break;
+
+                case SIGNALING_JSON_TOKEN_CHANNEL_STATUS:
+                    pChannelInfo->pChannelStatus = pair.value;
+                    pChannelInfo->channelStatusLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_CHANNEL_TYPE:
+                    if( LookupJsonToken( pair.value, pair.valueLength ) == SIGNALING_JSON_TOKEN_VALUE_SINGLE_MASTER )
+                    {
+                        pChannelInfo->channelType = SIGNALING_TYPE_CHANNEL_SINGLE_MASTER;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_INVALID_CHANNEL_TYPE;
+                    }
+                    break;
+
+                case SIGNALING_JSON_TOKEN_CREATION_TIME:
+                    /* We do not need CreationTime as of now. */
+                    break;
+
+                case SIGNALING_JSON_TOKEN_SINGLE_MASTER_CONFIGURATION:
+                    result = ParseSingleMasterConfiguration( pair.value, pair.valueLength, pChannelInfo );
+                    break;
+
+                case SIGNALING_JSON_TOKEN_VERSION:
+                    pChannelInfo->pVersion = pair.value;
+                    pChannelInfo->versionLength = pair.valueLength;
+                    break;
+
+                default:
+                    /* Skip unknown attributes. */
+                    break;
+            }
+
+            if( result != SIGNALING_RESULT_OK )
+            {
+                break;
+            }
+
+            jsonResult = JSON_Iterate( pChannelInfoBuffer, channelInfoBufferLength, &( channelInfoStart ), &( channelInfoNext ), &( pair ) );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructFetchTempCredsRequestForAwsIot( const char * pAwsIotEndpoint,
+                                                                     size_t awsIotEndpointLength,
+                                                                     const char * pRoleAlias,
+                                                                     size_t roleAliasLength,
+                                                                     SignalingRequest_t * pRequestBuffer )
+
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter;
+
+    if( ( pAwsIotEndpoint == NULL ) ||
+        ( pRoleAlias == NULL ) ||
+        ( pRequestBuffer == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "https://" );
+        AppendToWriter( &( urlWriter ), pAwsIotEndpoint, awsIotEndpointLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "/role-aliases/" );
+        AppendToWriter( &( urlWriter ), pRoleAlias, roleAliasLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "/credentials" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseFetchTempCredsResponseFromAwsIot( const char * pMessage,
+                                                                   size_t messageLength,
+                                                                   SignalingCredential_t * pCredentials )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    const char * pCredentialsBuffer = NULL;
+    size_t credentialsBufferLength;
+    size_t credentialsStart = 0, credentialsNext = 0;
+
+    if( ( pMessage == NULL ) ||
+        ( pCredentials == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Validate( pMessage,
+                                    messageLength );
+
+        if( jsonResult != JSONSuccess )
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pCredentials, 0, sizeof( SignalingCredential_t ) );
+
+        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            if( ( pair.jsonType != JSONObject ) ||
+                ( LookupJsonToken( pair.key, pair.keyLength ) != SIGNALING_JSON_TOKEN_CREDENTIALS ) )
+            {
+                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+            }
+            else
+            {
+                pCredentialsBuffer = pair.value;
+                credentialsBufferLength = pair.valueLength;
+            }
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Iterate( pCredentialsBuffer, credentialsBufferLength, &( credentialsStart ), &( credentialsNext ), &( pair ) );
+
+        while( jsonResult == JSONSuccess )
+        {
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_ACCESS_KEY_ID:
+                    if( pair.valueLength < ACCESS_KEY_MAX_LEN )
+                    {
+                        pCredentials->pAccessKeyId = pair.value;
+                        pCredentials->accessKeyIdLength = pair.valueLength;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_ACCESS_KEY_LENGTH_TOO_LARGE;
+                    }
+                    break;
+
+                case SIGNALING_JSON_TOKEN_SECRET_ACCESS_KEY:
+                    if( pair.valueLength < SECRET_ACCESS_KEY_MAX_LEN )
+                    {
+                        pCredentials->pSecretAccessKey = pair.value;
+                        pCredentials->secretAccessKeyLength = pair.valueLength;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE;
+                    }
+                    break;
+
+                case SIGNALING_JSON_TOKEN_SESSION_TOKEN:
+                    if( pair.valueLength < SESSION_TOKEN_MAX_LEN )
+                    {
+                        pCredentials->pSessionToken = pair.value;
+                        pCredentials->sessionTokenLength = pair.valueLength;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_SESSION_TOKEN_LENGTH_TOO_LARGE;
+                    }
+                    break;
+
+                case SIGNALING_JSON_TOKEN_EXPIRATION:
+                    if( pair.valueLength < EXPIRATION_MAX_LEN )
+                    {
+                        pCredentials->pExpiration = pair.value;
+                        pCredentials->expirationLength = pair.valueLength;
+                    }
+                    else
+                    {
+                        result = SIGNALING_RESULT_EXPIRATION_LENGTH_TOO_LARGE;
+                    }
+                    break;
+
+                default:
+                    /* Skip unknown attributes. */
+                    break;
+            }
+
+            if( result != SIGNALING_RESULT_OK )
+            {
+                break;
+            }
+
+            jsonResult = JSON_Iterate( pCredentialsBuffer, credentialsBufferLength, &( credentialsStart ), &( credentialsNext ), &( pair ) );
+        }
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( pCredentials->pAccessKeyId == NULL ) ||
+          ( pCredentials->pSecretAccessKey == NULL ) ||
+          ( pCredentials->pSessionToken == NULL ) ||
+          ( pCredentials->pExpiration == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructDescribeMediaStorageConfigRequest( SignalingAwsRegion_t * pAwsRegion,
+                                                                        SignalingChannelArn_t * pChannelArn,
+                                                                        SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+
+    if( ( pAwsRegion == NULL ) ||
+        ( pAwsRegion->pAwsRegion == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) ||
+        ( pChannelArn->pChannelArn == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendControlPlaneUrl( &( urlWriter ), pAwsRegion );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "describeMediaStorageConfiguration" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"ChannelARN\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ), pChannelArn->pChannelArn, pChannelArn->channelArnLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseDescribeMediaStorageConfigResponse( const char * pMessage,
+                                                                     size_t messageLength,
+                                                                     SignalingMediaStorageConfig_t * pMediaStorageConfig )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    const char * pMediaStorageConfigBuffer = NULL;
+    size_t mediaStorageConfigBufferLength;
+    size_t mediaStorageConfigStart = 0, mediaStorageConfigNext = 0;
+
+    if( ( pMessage == NULL ) ||
+        ( pMediaStorageConfig == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Validate( pMessage, messageLength );
+
+        if( jsonResult != JSONSuccess )
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pMediaStorageConfig, 0, sizeof( SignalingMediaStorageConfig_t ) );
+
+        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            if( ( pair.jsonType != JSONObject ) ||
+                ( LookupJsonToken( pair.key, pair.keyLength ) != SIGNALING_JSON_TOKEN_MEDIA_STORAGE_CONFIGURATION ) )
+            {
+                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+            }
+            else
+            {
+                pMediaStorageConfigBuffer = pair.value;
+                mediaStorageConfigBufferLength = pair.valueLength;
+            }
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Iterate( pMediaStorageConfigBuffer, mediaStorageConfigBufferLength, &( mediaStorageConfigStart ), &( mediaStorageConfigNext ), &( pair ) );
+
+        while( jsonResult == JSONSuccess )
+        {
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_STATUS:
+                    pMediaStorageConfig->pStatus = pair.value;
+                    pMediaStorageConfig->statusLength = pair.valueLength;
+                    break;
+
+                case SIGNALING_JSON_TOKEN_STREAM_ARN:
+                    pMediaStorageConfig->pStreamArn = pair.value;
+                    pMediaStorageConfig->streamArnLength = pair.valueLength;
+                    break;
+
+                default:
+                    /* Skip unknown attributes. */
+                    break;
+            }
+
+            jsonResult = JSON_Iterate( pMediaStorageConfigBuffer, mediaStorageConfigBufferLength, &( mediaStorageConfigStart ), &( mediaStorageConfigNext ), &( pair ) );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructCreateSignalingChannelRequest( SignalingAwsRegion_t * pAwsRegion,
+                                                                    CreateSignalingChannelRequestInfo_t * pCreateSignalingChannelRequestInfo,
+                                                                    SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+    size_t i;
+
+    if( ( pAwsRegion == NULL ) ||
+        ( pAwsRegion->pAwsRegion == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pCreateSignalingChannelRequestInfo == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) ||
+        ( ( pCreateSignalingChannelRequestInfo->numTags > 0 ) && ( pCreateSignalingChannelRequestInfo->pTags == NULL ) ) ||
+        ( pCreateSignalingChannelRequestInfo->channelName.channelNameLength >= SIGNALING_CHANNEL_NAME_MAX_LEN ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendControlPlaneUrl( &( urlWriter ), pAwsRegion );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "createSignalingChannel" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"ChannelName\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pCreateSignalingChannelRequestInfo->channelName.pChannelName,
+                               pCreateSignalingChannelRequestInfo->channelName.channelNameLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"ChannelType\":\"" );
+
+        if( pCreateSignalingChannelRequestInfo->channelType == SIGNALING_TYPE_CHANNEL_SINGLE_MASTER )
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "SINGLE_MASTER" );
+        }
+        else
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "UNKOWN" );
+        }
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"SingleMasterConfiguration\":{\"MessageTtlSeconds\":" );
+        AppendDecimalToWriter( &( bodyWriter ), pCreateSignalingChannelRequestInfo->messageTtlSeconds );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "}" );
+
+        if( pCreateSignalingChannelRequestInfo->numTags > 0 )
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), ",\"Tags\":[" );
+
+            for( i = 0; i < pCreateSignalingChannelRequestInfo->numTags; i++ )
+            {
+                if( i > 0 )
+                {
+                    SIGNALING_APPEND_LITERAL( &( bodyWriter ), "," );
+                }
+
+                SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"Key\":\"" );
+                AppendEscapedToWriter( &( bodyWriter ),
+                                       pCreateSignalingChannelRequestInfo->pTags[ i ].pName,
+                                       pCreateSignalingChannelRequestInfo->pTags[ i ].nameLength );
+                SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"Value\":\"" );
+                AppendEscapedToWriter( &( bodyWriter ),
+                                       pCreateSignalingChannelRequestInfo->pTags[ i ].pValue,
+                                       pCreateSignalingChannelRequestInfo->pTags[ i ].valueLength );
+                SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"}" );
+            }
+
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "]" );
+        }
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseCreateSignalingChannelResponse( const char * pMessage,
+                                                                 size_t messageLength,
+                                                                 SignalingChannelArn_t * pChannelArn )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+
+    if( ( pMessage == NULL ) ||
+        ( pChannelArn == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Validate( pMessage, messageLength );
+
+        if( jsonResult != JSONSuccess )
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pChannelArn, 0, sizeof( SignalingChannelArn_t ) );
+
+        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            if( LookupJsonToken( pair.key, pair.keyLength ) == SIGNALING_JSON_TOKEN_CHANNEL_ARN )
+            {
+                pChannelArn->pChannelArn = pair.value;
+                pChannelArn->channelArnLength = pair.valueLength;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+            }
+        }
+        else
+        {
+            result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructGetSignalingChannelEndpointRequest( SignalingAwsRegion_t * pAwsRegion,
+                                                                         GetSignalingChannelEndpointRequestInfo_t * pGetSignalingChannelEndpointRequestInfo,
+                                                                         SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+    uint8_t isFirstProtocol = 1;
+
+    if( ( pAwsRegion == NULL ) ||
+        ( pAwsRegion->pAwsRegion == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pGetSignalingChannelEndpointRequestInfo == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) ||
+        ( pGetSignalingChannelEndpointRequestInfo->channelArn.pChannelArn == NULL ) ||
+        ( ( pGetSignalingChannelEndpointRequestInfo->role != SIGNALING_ROLE_MASTER ) && ( pGetSignalingChannelEndpointRequestInfo->role != SIGNALING_ROLE_VIEWER ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendControlPlaneUrl( &( urlWriter ), pAwsRegion );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "getSignalingChannelEndpoint" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"ChannelARN\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pGetSignalingChannelEndpointRequestInfo->channelArn.pChannelArn,
+                               pGetSignalingChannelEndpointRequestInfo->channelArn.channelArnLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"SingleMasterChannelEndpointConfiguration\":{\"Protocols\":[" );
+
+        if( ( pGetSignalingChannelEndpointRequestInfo->protocols & SIGNALING_PROTOCOL_WEBSOCKET_SECURE ) != 0 )
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"WSS\"" );
+            isFirstProtocol = 0;
+        }
+
+        if( ( pGetSignalingChannelEndpointRequestInfo->protocols & SIGNALING_PROTOCOL_HTTPS ) != 0 )
+        {
+            if( isFirstProtocol == 0 )
+            {
+                SIGNALING_APPEND_LITERAL( &( bodyWriter ), "," );
+            }
+
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"HTTPS\"" );
+            isFirstProtocol = 0;
+        }
+
+        if( ( pGetSignalingChannelEndpointRequestInfo->protocols & SIGNALING_PROTOCOL_WEBRTC ) != 0 )
+        {
+            if( isFirstProtocol == 0 )
+            {
+                SIGNALING_APPEND_LITERAL( &( bodyWriter ), "," );
+            }
+
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"WEBRTC\"" );
+            isFirstProtocol = 0;
+        }
+
+        if( pGetSignalingChannelEndpointRequestInfo->role == SIGNALING_ROLE_MASTER )
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "],\"Role\":\"MASTER\"}}" );
+        }
+        else
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "],\"Role\":\"VIEWER\"}}" );
+        }
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseGetSignalingChannelEndpointResponse( const char * pMessage,
+                                                                      size_t messageLength,
+                                                                      SignalingChannelEndpoints_t * pSignalingChannelEndpoints )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    const char * pResourceEndpointListBuffer = NULL;
+    size_t resourceEndpointListBufferLength;
+    size_t resourceEndpointStart = 0, resourceEndpointNext = 0;
+    const char * pEndpointListBuffer = NULL;
+    size_t endpointListBufferLength;
+    size_t endpointListStart = 0, endpointListNext = 0;
+    const char * pEndpoint = NULL;
+    size_t endpointLength;
+    const char * pProtocol = NULL;
+    size_t protocolLength = 0;
+
+    if( ( pMessage == NULL ) ||
+        ( pSignalingChannelEndpoints == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    #if !defined( SIGNALING_TRUST_CONTROL_PLANE_RESPONSES )
+        if( result == SIGNALING_RESULT_OK )
+        {
+            jsonResult = JSON_Validate( pMessage, messageLength );
+
+            if( jsonResult != JSONSuccess )
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+        }
+    #endif /* #if !defined( SIGNALING_TRUST_CONTROL_PLANE_RESPONSES ) */
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pSignalingChannelEndpoints, 0, sizeof( SignalingChannelEndpoints_t ) );
+
+        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            if( ( pair.jsonType != JSONArray ) ||
+                ( LookupJsonToken( pair.key, pair.keyLength ) != SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT_LIST ) )
+            {
+                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+            }
+            else
+            {
+                pResourceEndpointListBuffer = pair.value;
+                resourceEndpointListBufferLength = pair.valueLength;
+            }
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_JSON;
+        }
+    }
+
+    while( result == SIGNALING_RESULT_OK )
+    {
+        jsonResult = JSON_Iterate( pResourceEndpointListBuffer, resourceEndpointListBufferLength, &( resourceEndpointStart ), &( resourceEndpointNext ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
+        {
+            pEndpointListBuffer = pair.value;
+            endpointListBufferLength = pair.valueLength;
+            endpointListStart = 0;
+            endpointListNext = 0;
+            pEndpoint = NULL;
+            endpointLength = 0;
+            pProtocol = NULL;
+            protocolLength = 0;
+
+            jsonResult = JSON_Iterate( pEndpointListBuffer, endpointListBufferLength, &( endpointListStart ), &( endpointListNext ), &( pair ) );
+
+            while( jsonResult == JSONSuccess )
+            {
+                switch( LookupJsonToken( pair.key, pair.keyLength ) )
+                {
+                    case SIGNALING_JSON_TOKEN_PROTOCOL:
+                        pProtocol = pair.value;
+                        protocolLength = pair.valueLength;
+                        break;
+
+                    case SIGNALING_JSON_TOKEN_RESOURCE_ENDPOINT:
+                        pEndpoint = pair.value;
+                        endpointLength = pair.valueLength;
+                        break;
+
+                    default:
+                        /* Skip unknown attributes. */
+                        break;
+                }
+
+                jsonResult = JSON_Iterate( pEndpointListBuffer, endpointListBufferLength, &( endpointListStart ), &( endpointListNext ), &( pair ) );
+            }
+
+            if( ( pEndpoint != NULL ) && ( pProtocol != NULL ) )
+            {
+                switch( LookupJsonToken( pProtocol, protocolLength ) )
+                {
+                    case SIGNALING_JSON_TOKEN_VALUE_WSS:
+                    case SIGNALING_JSON_TOKEN_VALUE_WSS_LOWER:
+                        pSignalingChannelEndpoints->wssEndpoint.pEndpoint = pEndpoint;
+                        pSignalingChannelEndpoints->wssEndpoint.endpointLength = endpointLength;
+                        break;
+
+                    case SIGNALING_JSON_TOKEN_VALUE_HTTPS:
+                    case SIGNALING_JSON_TOKEN_VALUE_HTTPS_LOWER:
+                        pSignalingChannelEndpoints->httpsEndpoint.pEndpoint = pEndpoint;
+                        pSignalingChannelEndpoints->httpsEndpoint.endpointLength = endpointLength;
+                        break;
+
+                    case SIGNALING_JSON_TOKEN_VALUE_WEBRTC:
+                    case SIGNALING_JSON_TOKEN_VALUE_WEBRTC_LOWER:
+                        pSignalingChannelEndpoints->webrtcEndpoint.pEndpoint = pEndpoint;
+                        pSignalingChannelEndpoints->webrtcEndpoint.endpointLength = endpointLength;
+                        break;
+
+                    default:
+                        result = SIGNALING_RESULT_INVALID_PROTOCOL;
+                        break;
+                }
+            }
+        }
+        else
+        {
+            /* All parsed. */
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructGetIceServerConfigRequest( SignalingChannelEndpoint_t * pHttpsEndpoint,
+                                                                GetIceServerConfigRequestInfo_t * pGetIceServerConfigRequestInfo,
+                                                                SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+
+    if( ( pHttpsEndpoint == NULL ) ||
+        ( pHttpsEndpoint->pEndpoint == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pGetIceServerConfigRequestInfo == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) ||
+        ( pGetIceServerConfigRequestInfo->pClientId == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendToWriter( &( urlWriter ), pHttpsEndpoint->pEndpoint, pHttpsEndpoint->endpointLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "/v1/get-ice-server-config" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"ChannelARN\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pGetIceServerConfigRequestInfo->channelArn.pChannelArn,
+                               pGetIceServerConfigRequestInfo->channelArn.channelArnLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"ClientId\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pGetIceServerConfigRequestInfo->pClientId,
+                               pGetIceServerConfigRequestInfo->clientIdLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"Service\":\"TURN\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseGetIceServerConfigResponse( const char * pMessage,
+                                                             size_t messageLength,
+                                                             SignalingIceServer_t * pIceServers,
+                                                             size_t * pNumIceServers )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    JSONStatus_t jsonResult;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    JSONPair_t firstPair = { 0 };
+    const char * pIceServerListBuffer = NULL;
+    size_t iceServerListBufferLength;
+
+    if( ( pMessage == NULL ) ||
+        ( pIceServers == NULL ) ||
+        ( pNumIceServers == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        #if !defined( SIGNALING_TRUST_CONTROL_PLANE_RESPONSES )
+            /* Validate the whole response with the single-pass scanner while
+             * picking up the first member, instead of a separate JSON_Validate. */
+            jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+            if( jsonResult == JSONSuccess )
+            {
+                firstPair = pair;
+            }
+
+            while( jsonResult == JSONSuccess )
+            {
+                jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+            }
+
+            if( ( jsonResult != JSONNotFound ) || ( firstPair.key == NULL ) )
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+        #else
+            /* Only the first member is needed, the rest of the response is
+             * never looked at. */
+            jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+            if( jsonResult == JSONSuccess )
+            {
+                firstPair = pair;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_JSON;
+            }
+        #endif /* #if !defined( SIGNALING_TRUST_CONTROL_PLANE_RESPONSES ) */
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pIceServers, 0, sizeof( SignalingIceServer_t ) * ( *pNumIceServers ) );
+
+        if( ( firstPair.jsonType != JSONArray ) ||
+            ( LookupJsonToken( firstPair.key, firstPair.keyLength ) != SIGNALING_JSON_TOKEN_ICE_SERVER_LIST ) )
+        {
+            result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+        }
+        else
+        {
+            pIceServerListBuffer = firstPair.value;
+            iceServerListBufferLength = firstPair.valueLength;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ParseIceServerList( pIceServerListBuffer, iceServerListBufferLength, pIceServers, pNumIceServers );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructJoinStorageSessionRequest( SignalingChannelEndpoint_t * pWebrtcEndpoint,
+                                                                JoinStorageSessionRequestInfo_t * pJoinStorageSessionRequestInfo,
+                                                                SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+
+    if( ( pWebrtcEndpoint == NULL ) ||
+        ( pWebrtcEndpoint->pEndpoint == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pJoinStorageSessionRequestInfo == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) ||
+        ( pJoinStorageSessionRequestInfo->channelArn.pChannelArn == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendToWriter( &( urlWriter ), pWebrtcEndpoint->pEndpoint, pWebrtcEndpoint->endpointLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "/joinStorageSession" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"channelArn\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pJoinStorageSessionRequestInfo->channelArn.pChannelArn,
+                               pJoinStorageSessionRequestInfo->channelArn.channelArnLength );
+
+        if( pJoinStorageSessionRequestInfo->role != SIGNALING_ROLE_MASTER )
+        {
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"clientId\":\"" );
+            AppendEscapedToWriter( &( bodyWriter ),
+                                   pJoinStorageSessionRequestInfo->pClientId,
+                                   pJoinStorageSessionRequestInfo->clientIdLength );
+        }
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructDeleteSignalingChannelRequest( SignalingAwsRegion_t * pAwsRegion,
+                                                                    DeleteSignalingChannelRequestInfo_t * pDeleteSignalingChannelRequestInfo,
+                                                                    SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
+
+    if( ( pAwsRegion == NULL ) ||
+        ( pAwsRegion->pAwsRegion == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pDeleteSignalingChannelRequestInfo == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) ||
+        ( pDeleteSignalingChannelRequestInfo->channelArn.pChannelArn == NULL ) ||
+        ( pDeleteSignalingChannelRequestInfo->pVersion == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendControlPlaneUrl( &( urlWriter ), pAwsRegion );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "deleteSignalingChannel" );
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "{\"ChannelARN\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pDeleteSignalingChannelRequestInfo->channelArn.pChannelArn,
+                               pDeleteSignalingChannelRequestInfo->channelArn.channelArnLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"CurrentVersion\":\"" );
+        AppendEscapedToWriter( &( bodyWriter ),
+                               pDeleteSignalingChannelRequestInfo->pVersion,
+                               pDeleteSignalingChannelRequestInfo->versionLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructConnectWssEndpointRequest( SignalingChannelEndpoint_t * pWssEndpoint,
+                                                                ConnectWssEndpointRequestInfo_t * pConnectWssEndpointRequestInfo,
+                                                                SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter;
+
+    if( ( pWssEndpoint == NULL ) ||
+        ( pWssEndpoint->pEndpoint == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pConnectWssEndpointRequestInfo == NULL ) ||
+        ( pConnectWssEndpointRequestInfo->channelArn.pChannelArn == NULL ) ||
+        ( ( pConnectWssEndpointRequestInfo->role != SIGNALING_ROLE_MASTER ) &&
+          ( pConnectWssEndpointRequestInfo->role != SIGNALING_ROLE_VIEWER ) ) ||
+        ( ( pConnectWssEndpointRequestInfo->role == SIGNALING_ROLE_VIEWER ) &&
+          ( pConnectWssEndpointRequestInfo->pClientId == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+
+        AppendToWriter( &( urlWriter ), pWssEndpoint->pEndpoint, pWssEndpoint->endpointLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "?X-Amz-ChannelARN=" );
+        AppendToWriter( &( urlWriter ),
+                        pConnectWssEndpointRequestInfo->channelArn.pChannelArn,
+                        pConnectWssEndpointRequestInfo->channelArn.channelArnLength );
+
+        if( pConnectWssEndpointRequestInfo->role == SIGNALING_ROLE_VIEWER )
+        {
+            SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-ClientId=" );
+            AppendToWriter( &( urlWriter ),
+                            pConnectWssEndpointRequestInfo->pClientId,
+                            pConnectWssEndpointRequestInfo->clientIdLength );
+        }
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructPresignedConnectWssEndpointRequest( SignalingChannelEndpoint_t * pWssEndpoint,
+                                                                         ConnectWssEndpointRequestInfo_t * pConnectWssEndpointRequestInfo,
+                                                                         SignalingSigV4PresignInfo_t * pPresignInfo,
+                                                                         SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter;
+    SignalingSha256_t sha256;
+    const SignalingCredential_t * pCredential = NULL;
+    const char * pHost = NULL, * pPath = NULL;
+    size_t hostLength = 0, pathLength = 0, queryStart;
+    uint8_t canonicalRequestHash[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    char signature[ SIGNALING_SIGV4_SIGNATURE_LENGTH ] = { 0 };
+
+    if( ( pWssEndpoint == NULL ) ||
+        ( pWssEndpoint->pEndpoint == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( pConnectWssEndpointRequestInfo == NULL ) ||
+        ( pConnectWssEndpointRequestInfo->channelArn.pChannelArn == NULL ) ||
+        ( ( pConnectWssEndpointRequestInfo->role != SIGNALING_ROLE_MASTER ) &&
+          ( pConnectWssEndpointRequestInfo->role != SIGNALING_ROLE_VIEWER ) ) ||
+        ( ( pConnectWssEndpointRequestInfo->role == SIGNALING_ROLE_VIEWER ) &&
+          ( pConnectWssEndpointRequestInfo->pClientId == NULL ) ) ||
+        ( pPresignInfo == NULL ) ||
+        ( pPresignInfo->pSigner == NULL ) ||
+        ( pPresignInfo->pCredential == NULL ) ||
+        ( pPresignInfo->pCredential->pAccessKeyId == NULL ) ||
+        ( pPresignInfo->pCredential->pSecretAccessKey == NULL ) ||
+        ( ( pPresignInfo->pCredential->pSessionToken == NULL ) &&
+          ( pPresignInfo->pCredential->sessionTokenLength != 0U ) ) ||
+        ( pPresignInfo->pAwsRegion == NULL ) ||
+        ( pPresignInfo->pAwsRegion->pAwsRegion == NULL ) ||
+        ( pPresignInfo->pDate == NULL ) ||
+        ( pPresignInfo->expiresSeconds == 0U ) ||
+        ( pPresignInfo->expiresSeconds > SIGNALING_SIGV4_MAX_EXPIRES_SECONDS ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( ( pPresignInfo->pDate[ 8 ] != 'T' ) || ( pPresignInfo->pDate[ 15 ] != 'Z' ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( pPresignInfo->pAwsRegion->awsRegionLength > SIGNALING_SIGV4_MAX_REGION_LENGTH )
+    {
+        result = SIGNALING_RESULT_REGION_LENGTH_TOO_LARGE;
+    }
+    else if( pPresignInfo->pCredential->secretAccessKeyLength > SECRET_ACCESS_KEY_MAX_LEN )
+    {
+        result = SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE;
+    }
+    else
+    {
+        pCredential = pPresignInfo->pCredential;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = Signaling_SplitUrl( pWssEndpoint->pEndpoint, pWssEndpoint->endpointLength,
+                                     &( pHost ), &( hostLength ), &( pPath ), &( pathLength ), NULL, NULL );
+    }
+
+    /* An endpoint with a query of its own can't take the presigned one. */
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( memchr( pWssEndpoint->pEndpoint, '?', pWssEndpoint->endpointLength ) != NULL ) )
+    {
+        result = SIGNALING_RESULT_INVALID_URL;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
 
-        if( jsonResult == JSONSuccess )
+        AppendToWriter( &( urlWriter ), pWssEndpoint->pEndpoint, pWssEndpoint->endpointLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "?" );
+        queryStart = urlWriter.length;
+
+        /* The parameters are appended in the order of their encoded names,
+         * so the query is already its own canonical form. */
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "X-Amz-Algorithm=AWS4-HMAC-SHA256&X-Amz-ChannelARN=" );
+        AppendUriEncodedToWriter( &( urlWriter ),
+                                  pConnectWssEndpointRequestInfo->channelArn.pChannelArn,
+                                  pConnectWssEndpointRequestInfo->channelArn.channelArnLength );
+
+        if( pConnectWssEndpointRequestInfo->role == SIGNALING_ROLE_VIEWER )
         {
-            if( ( pair.jsonType != JSONObject ) ||
-                ( pair.keyLength != strlen( "ChannelInfo" ) ) ||
-                ( strncmp( pair.key, "ChannelInfo", pair.keyLength ) != 0 ) )
+            SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-ClientId=" );
+            AppendUriEncodedToWriter( &( urlWriter ),
+                                      pConnectWssEndpointRequestInfo->pClientId,
+                                      pConnectWssEndpointRequestInfo->clientIdLength );
+        }
+
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-Credential=" );
+        AppendUriEncodedToWriter( &( urlWriter ), pCredential->pAccessKeyId, pCredential->accessKeyIdLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "%2F" );
+        AppendToWriter( &( urlWriter ), pPresignInfo->pDate, 8 );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "%2F" );
+        AppendUriEncodedToWriter( &( urlWriter ), pPresignInfo->pAwsRegion->pAwsRegion, pPresignInfo->pAwsRegion->awsRegionLength );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "%2F" SIGNALING_KVS_SERVICE_NAME "%2Faws4_request&X-Amz-Date=" );
+        AppendUriEncodedToWriter( &( urlWriter ), pPresignInfo->pDate, SIGNALING_SIGV4_DATE_LENGTH );
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-Expires=" );
+        AppendDecimalToWriter( &( urlWriter ), pPresignInfo->expiresSeconds );
+
+        if( pCredential->sessionTokenLength > 0U )
+        {
+            SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-Security-Token=" );
+            AppendUriEncodedToWriter( &( urlWriter ), pCredential->pSessionToken, pCredential->sessionTokenLength );
+        }
+
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-SignedHeaders=host" );
+
+        /* Sign only once the whole query is in the buffer, it is hashed
+         * from there. A size query only needs the signature length. */
+        if( urlWriter.length < urlWriter.bufferLength )
+        {
+            Signaling_Sha256Init( &( sha256 ) );
+            Signaling_Sha256Update( &( sha256 ), "GET\n", SIGNALING_LITERAL_LENGTH( "GET\n" ) );
+
+            if( pathLength == 0U )
             {
-                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                Signaling_Sha256Update( &( sha256 ), "/", 1 );
             }
             else
             {
-                pChannelInfoBuffer = pair.value;
-                channelInfoBufferLength = pair.valueLength;
+                Signaling_Sha256Update( &( sha256 ), pPath, pathLength );
             }
+
+            Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+            Signaling_Sha256Update( &( sha256 ), &( urlWriter.pBuffer[ queryStart ] ), urlWriter.length - queryStart );
+            Signaling_Sha256Update( &( sha256 ), "\nhost:", SIGNALING_LITERAL_LENGTH( "\nhost:" ) );
+            Signaling_Sha256Update( &( sha256 ), pHost, hostLength );
+            Signaling_Sha256Update( &( sha256 ), "\n\nhost\n" SIGNALING_EMPTY_PAYLOAD_HASH,
+                                    SIGNALING_LITERAL_LENGTH( "\n\nhost\n" SIGNALING_EMPTY_PAYLOAD_HASH ) );
+            Signaling_Sha256Final( &( sha256 ), canonicalRequestHash );
+
+            result = Signaling_SigV4Sign( pPresignInfo->pSigner,
+                                          pCredential,
+                                          pPresignInfo->pAwsRegion,
+                                          SIGNALING_KVS_SERVICE_NAME,
+                                          SIGNALING_LITERAL_LENGTH( SIGNALING_KVS_SERVICE_NAME ),
+                                          pPresignInfo->pDate,
+                                          canonicalRequestHash,
+                                          signature );
         }
-        else
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-Signature=" );
+        AppendToWriter( &( urlWriter ), signature, sizeof( signature ) );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_SerializeHttpRequest( const SignalingRequest_t * pRequest,
+                                                 const SignalingHttpRequestInfo_t * pHttpRequestInfo,
+                                                 char * pBuffer,
+                                                 size_t * pBufferLength )
+{
+    SignalingResult_t result;
+    SignalingWriter_t writer;
+
+    result = ValidateHttpRequest( pRequest, pHttpRequestInfo );
+
+    if( ( result == SIGNALING_RESULT_OK ) && ( pBufferLength == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitWriter( &( writer ), pBuffer, *pBufferLength );
+
+        AppendHttpHeadersToWriter( &( writer ), pRequest, pHttpRequestInfo );
+        AppendToWriter( &( writer ), pRequest->pBody, pRequest->bodyLength );
+
+        result = FinishWriter( &( writer ), pBufferLength );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_SerializeHttpRequestSegments( const SignalingRequest_t * pRequest,
+                                                         const SignalingHttpRequestInfo_t * pHttpRequestInfo,
+                                                         char * pHeaderBuffer,
+                                                         size_t * pHeaderBufferLength,
+                                                         SignalingIoVec_t * pSegments,
+                                                         size_t * pSegmentCount,
+                                                         size_t * pTotalLength )
+{
+    SignalingResult_t result;
+    SignalingWriter_t writer;
+
+    result = ValidateHttpRequest( pRequest, pHttpRequestInfo );
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( pHeaderBuffer == NULL ) ||
+          ( pHeaderBufferLength == NULL ) ||
+          ( pSegments == NULL ) ||
+          ( pSegmentCount == NULL ) ||
+          ( pTotalLength == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( *pSegmentCount < SIGNALING_HTTP_REQUEST_MAX_SEGMENTS ) )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        /* Only the request line and headers are written, the body is sent
+         * from where it was constructed. */
+        InitWriter( &( writer ), pHeaderBuffer, *pHeaderBufferLength );
+        AppendHttpHeadersToWriter( &( writer ), pRequest, pHttpRequestInfo );
+
+        result = FinishWriter( &( writer ), pHeaderBufferLength );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        pSegments[ 0 ].pBase = pHeaderBuffer;
+        pSegments[ 0 ].length = *pHeaderBufferLength;
+        *pSegmentCount = 1;
+
+        if( pRequest->bodyLength > 0U )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            pSegments[ 1 ].pBase = pRequest->pBody;
+            pSegments[ 1 ].length = pRequest->bodyLength;
+            *pSegmentCount = 2;
         }
+
+        *pTotalLength = *pHeaderBufferLength + pRequest->bodyLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_InitChannelContext( SignalingChannelArn_t * pChannelArn,
+                                                SignalingChannelEndpoints_t * pEndpoints,
+                                                char * pBuffer,
+                                                size_t * pBufferLength,
+                                                SignalingChannelContext_t * pContext )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t writer;
+    size_t offsets[ 5 ] = { 0 }, lengths[ 5 ] = { 0 }, i;
+    const char * pFragments[ 5 ] = { NULL };
+
+    if( ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) ||
+        ( pEndpoints == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pContext == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        jsonResult = JSON_Iterate( pChannelInfoBuffer, channelInfoBufferLength, &( channelInfoStart ), &( channelInfoNext ), &( pair ) );
+        /* The fragments are written back to back, in the order of the
+         * context fields. */
+        InitWriter( &( writer ), pBuffer, *pBufferLength );
 
-        while( jsonResult == JSONSuccess )
+        if( pEndpoints->httpsEndpoint.pEndpoint != NULL )
         {
-            if( strncmp( pair.key, "ChannelARN", pair.keyLength ) == 0 )
-            {
-                pChannelInfo->channelArn.pChannelArn = pair.value;
-                pChannelInfo->channelArn.channelArnLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "ChannelName", pair.keyLength ) == 0 )
-            {
-                if( pair.valueLength < SIGNALING_CHANNEL_NAME_MAX_LEN )
-                {
-                    pChannelInfo->channelName.pChannelName = pair.value;
-                    pChannelInfo->channelName.channelNameLength = pair.valueLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_INVALID_CHANNEL_NAME;
-                }
-            }
-            else if( strncmp( pair.key, "ChannelStatus", pair.keyLength ) == 0 )
-            {
-                pChannelInfo->pChannelStatus = pair.value;
-                pChannelInfo->channelStatusLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "ChannelType", pair.keyLength ) == 0 )
-            {
-                if( strncmp( pair.value, "SINGLE_MASTER", pair.valueLength ) == 0 )
-                {
-                    pChannelInfo->channelType = SIGNALING_TYPE_CHANNEL_SINGLE_MASTER;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_INVALID_CHANNEL_TYPE;
-                }
-            }
-            else if( strncmp( pair.key, "CreationTime", pair.keyLength ) == 0 )
-            {
-                /* We do not need CreationTime as of now. */
-            }
-            else if( strncmp( pair.key, "SingleMasterConfiguration", pair.keyLength ) == 0 )
-            {
-                const char * pConfigBuffer = pair.value;
-                size_t configBufferLength = pair.valueLength;
-                size_t configStart = 0, configNext = 0;
-
-                jsonResult = JSON_Iterate( pConfigBuffer, configBufferLength, &( configStart ), &( configNext ), &( pair ) );
+            offsets[ 0 ] = writer.length;
+            AppendToWriter( &( writer ), pEndpoints->httpsEndpoint.pEndpoint, pEndpoints->httpsEndpoint.endpointLength );
+            SIGNALING_APPEND_LITERAL( &( writer ), "/v1/get-ice-server-config" );
+            lengths[ 0 ] = writer.length - offsets[ 0 ];
+
+            offsets[ 1 ] = writer.length;
+            SIGNALING_APPEND_LITERAL( &( writer ), "{\"ChannelARN\":\"" );
+            AppendEscapedToWriter( &( writer ), pChannelArn->pChannelArn, pChannelArn->channelArnLength );
+            SIGNALING_APPEND_LITERAL( &( writer ), "\",\"ClientId\":\"" );
+            lengths[ 1 ] = writer.length - offsets[ 1 ];
+        }
 
-                if( jsonResult == JSONSuccess )
-                {
-                    if( strncmp( pair.key, "MessageTtlSeconds", pair.keyLength ) == 0 )
-                    {
-                        if( pair.valueLength >= SIGNALING_CHANNEL_TTL_SECONDS_BUFFER_MAX )
-                        {
-                            /* Unexpected TTL value from cloud. */
-                            result = SIGNALING_RESULT_INVALID_TTL;
-                            break;
-                        }
+        if( pEndpoints->wssEndpoint.pEndpoint != NULL )
+        {
+            offsets[ 2 ] = writer.length;
+            AppendToWriter( &( writer ), pEndpoints->wssEndpoint.pEndpoint, pEndpoints->wssEndpoint.endpointLength );
+            SIGNALING_APPEND_LITERAL( &( writer ), "?X-Amz-ChannelARN=" );
+            AppendToWriter( &( writer ), pChannelArn->pChannelArn, pChannelArn->channelArnLength );
+            lengths[ 2 ] = writer.length - offsets[ 2 ];
+        }
 
-                        strncpy( ttlSecondsBuffer, pair.value, pair.valueLength );
-                        pChannelInfo->messageTtlSeconds = ( uint32_t ) strtoul( ttlSecondsBuffer, NULL, 10 );
+        if( pEndpoints->webrtcEndpoint.pEndpoint != NULL )
+        {
+            offsets[ 3 ] = writer.length;
+            AppendToWriter( &( writer ), pEndpoints->webrtcEndpoint.pEndpoint, pEndpoints->webrtcEndpoint.endpointLength );
+            SIGNALING_APPEND_LITERAL( &( writer ), "/joinStorageSession" );
+            lengths[ 3 ] = writer.length - offsets[ 3 ];
+
+            offsets[ 4 ] = writer.length;
+            SIGNALING_APPEND_LITERAL( &( writer ), "{\"channelArn\":\"" );
+            AppendEscapedToWriter( &( writer ), pChannelArn->pChannelArn, pChannelArn->channelArnLength );
+            lengths[ 4 ] = writer.length - offsets[ 4 ];
+        }
 
-                        if( ( pChannelInfo->messageTtlSeconds < SIGNALING_CHANNEL_TTL_SECONDS_MIN ) ||
-                            ( pChannelInfo->messageTtlSeconds > SIGNALING_CHANNEL_TTL_SECONDS_MAX ) )
-                        {
-                            /* Unexpected TTL value from cloud. */
-                            result = SIGNALING_RESULT_INVALID_TTL;
-                        }
-                    }
-                    else
-                    {
-                        /* Unknown attribute. */
-                        result = SIGNALING_RESULT_INVALID_JSON;
-                    }
-                }
-                else
-                {
-                    /* Invalid single master configuration. */
-                    result = SIGNALING_RESULT_INVALID_JSON;
-                }
-            }
-            else if( strncmp( pair.key, "Version", pair.keyLength ) == 0 )
-            {
-                pChannelInfo->pVersion = pair.value;
-                pChannelInfo->versionLength = pair.valueLength;
-            }
-            else
-            {
-                /* Skip unknown attributes. */
-            }
+        result = FinishWriter( &( writer ), pBufferLength );
+    }
 
-            if( result != SIGNALING_RESULT_OK )
+    if( ( result == SIGNALING_RESULT_OK ) && ( pBuffer != NULL ) )
+    {
+        for( i = 0; i < 5U; i++ )
+        {
+            if( lengths[ i ] > 0U )
             {
-                break;
+                pFragments[ i ] = &( pBuffer[ offsets[ i ] ] );
             }
-
-            jsonResult = JSON_Iterate( pChannelInfoBuffer, channelInfoBufferLength, &( channelInfoStart ), &( channelInfoNext ), &( pair ) );
         }
+
+        pContext->pIceServerConfigUrl = pFragments[ 0 ];
+        pContext->iceServerConfigUrlLength = lengths[ 0 ];
+        pContext->pIceServerConfigBodyPrefix = pFragments[ 1 ];
+        pContext->iceServerConfigBodyPrefixLength = lengths[ 1 ];
+        pContext->pConnectWssUrlPrefix = pFragments[ 2 ];
+        pContext->connectWssUrlPrefixLength = lengths[ 2 ];
+        pContext->pJoinStorageSessionUrl = pFragments[ 3 ];
+        pContext->joinStorageSessionUrlLength = lengths[ 3 ];
+        pContext->pJoinStorageSessionBodyPrefix = pFragments[ 4 ];
+        pContext->joinStorageSessionBodyPrefixLength = lengths[ 4 ];
     }
 
     return result;
@@ -434,41 +4957,76 @@ SignalingResult_t Signaling_ParseDescribeSignalingChannelResponse( const char *
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructFetchTempCredsRequestForAwsIot( const char * pAwsIotEndpoint,
-                                                                     size_t awsIotEndpointLength,
-                                                                     const char * pRoleAlias,
-                                                                     size_t roleAliasLength,
-                                                                     SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_ConstructGetIceServerConfigRequestFromContext( const SignalingChannelContext_t * pContext,
+                                                                          const char * pClientId,
+                                                                          size_t clientIdLength,
+                                                                          SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t urlWriter, bodyWriter;
 
+    if( ( pContext == NULL ) ||
+        ( pContext->pIceServerConfigUrl == NULL ) ||
+        ( pClientId == NULL ) ||
+        ( pRequestBuffer == NULL ) ||
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+
+        AppendToWriter( &( urlWriter ), pContext->pIceServerConfigUrl, pContext->iceServerConfigUrlLength );
+
+        AppendToWriter( &( bodyWriter ), pContext->pIceServerConfigBodyPrefix, pContext->iceServerConfigBodyPrefixLength );
+        AppendEscapedToWriter( &( bodyWriter ), pClientId, clientIdLength );
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"Service\":\"TURN\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructJoinStorageSessionRequestFromContext( const SignalingChannelContext_t * pContext,
+                                                                          SignalingRole_t role,
+                                                                          const char * pClientId,
+                                                                          size_t clientIdLength,
+                                                                          SignalingRequest_t * pRequestBuffer )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
+    SignalingWriter_t urlWriter, bodyWriter;
 
-    if( ( pAwsIotEndpoint == NULL ) ||
-        ( pRoleAlias == NULL ) ||
+    if( ( pContext == NULL ) ||
+        ( pContext->pJoinStorageSessionUrl == NULL ) ||
+        ( ( role != SIGNALING_ROLE_MASTER ) && ( pClientId == NULL ) ) ||
         ( pRequestBuffer == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) )
+        ( ( pRequestBuffer->pUrl != NULL ) && ( pRequestBuffer->pBody == NULL ) ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                   pRequestBuffer->urlLength,
-                                   "https://%.*s/role-aliases/%.*s/credentials",
-                                   ( int ) awsIotEndpointLength,
-                                   pAwsIotEndpoint,
-                                   ( int ) roleAliasLength,
-                                   pRoleAlias );
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal,
-                                               pRequestBuffer->urlLength );
+        AppendToWriter( &( urlWriter ), pContext->pJoinStorageSessionUrl, pContext->joinStorageSessionUrlLength );
 
-        if( result == SIGNALING_RESULT_OK )
+        AppendToWriter( &( bodyWriter ), pContext->pJoinStorageSessionBodyPrefix, pContext->joinStorageSessionBodyPrefixLength );
+
+        if( role != SIGNALING_ROLE_MASTER )
         {
-            pRequestBuffer->urlLength = snprintfRetVal;
+            SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\",\"clientId\":\"" );
+            AppendEscapedToWriter( &( bodyWriter ), pClientId, clientIdLength );
         }
+
+        SIGNALING_APPEND_LITERAL( &( bodyWriter ), "\"}" );
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), &( bodyWriter ) );
     }
 
     return result;
@@ -476,145 +5034,209 @@ SignalingResult_t Signaling_ConstructFetchTempCredsRequestForAwsIot( const char
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseFetchTempCredsResponseFromAwsIot( const char * pMessage,
-                                                                   size_t messageLength,
-                                                                   SignalingCredential_t * pCredentials )
+SignalingResult_t Signaling_ConstructConnectWssEndpointRequestFromContext( const SignalingChannelContext_t * pContext,
+                                                                          SignalingRole_t role,
+                                                                          const char * pClientId,
+                                                                          size_t clientIdLength,
+                                                                          SignalingRequest_t * pRequestBuffer )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
-    const char * pCredentialsBuffer = NULL;
-    size_t credentialsBufferLength;
-    size_t credentialsStart = 0, credentialsNext = 0;
+    SignalingWriter_t urlWriter;
 
-    if( ( pMessage == NULL ) ||
-        ( pCredentials == NULL ) )
+    if( ( pContext == NULL ) ||
+        ( pContext->pConnectWssUrlPrefix == NULL ) ||
+        ( ( role != SIGNALING_ROLE_MASTER ) && ( role != SIGNALING_ROLE_VIEWER ) ) ||
+        ( ( role == SIGNALING_ROLE_VIEWER ) && ( pClientId == NULL ) ) ||
+        ( pRequestBuffer == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        InitRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+
+        AppendToWriter( &( urlWriter ), pContext->pConnectWssUrlPrefix, pContext->connectWssUrlPrefixLength );
+
+        if( role == SIGNALING_ROLE_VIEWER )
+        {
+            SIGNALING_APPEND_LITERAL( &( urlWriter ), "&X-Amz-ClientId=" );
+            AppendToWriter( &( urlWriter ), pClientId, clientIdLength );
+        }
+
+        result = FinishRequestWriters( pRequestBuffer, &( urlWriter ), NULL );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructWssMessage( WssSendMessage_t * pWssSendMessage,
+                                                 char * pBuffer,
+                                                 size_t * pBufferLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( ( pWssSendMessage == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pWssSendMessage->pBase64EncodedMessage == NULL ) ||
+        ( ( pWssSendMessage->recipientClientIdLength != 0 ) && 
+          ( pWssSendMessage->pRecipientClientId == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    /* A NULL buffer is a size query, the writer then only counts. */
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ConstructWssMessage( pWssSendMessage, NULL, 0, pBuffer, pBufferLength );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructWssMessageFromRawPayload( WssSendMessage_t * pWssSendMessage,
+                                                               const char * pPayload,
+                                                               size_t payloadLength,
+                                                               char * pBuffer,
+                                                               size_t * pBufferLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( ( pWssSendMessage == NULL ) ||
+        ( pPayload == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( ( pWssSendMessage->recipientClientIdLength != 0 ) &&
+          ( pWssSendMessage->pRecipientClientId == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    /* A NULL buffer is a size query, the writer then only counts. */
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ConstructWssMessage( pWssSendMessage, pPayload, payloadLength, pBuffer, pBufferLength );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ConstructWssMessageBatch( WssSendMessage_t * pWssSendMessages,
+                                                      size_t messageCount,
+                                                      char * pBuffer,
+                                                      size_t * pBufferLength,
+                                                      size_t * pOffsets )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t writer;
+    size_t i;
+
+    if( ( pWssSendMessages == NULL ) ||
+        ( messageCount == 0 ) ||
+        ( pBufferLength == NULL ) ||
+        ( ( pBuffer != NULL ) && ( pOffsets == NULL ) ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
-    if( result == SIGNALING_RESULT_OK )
+    /* Validate every message up front, so that the loop serializing them
+     * does nothing else. */
+    for( i = 0; ( result == SIGNALING_RESULT_OK ) && ( i < messageCount ); i++ )
     {
-        jsonResult = JSON_Validate( pMessage,
-                                    messageLength );
-
-        if( jsonResult != JSONSuccess )
+        if( ( pWssSendMessages[ i ].pBase64EncodedMessage == NULL ) ||
+            ( ( pWssSendMessages[ i ].recipientClientIdLength != 0 ) &&
+              ( pWssSendMessages[ i ].pRecipientClientId == NULL ) ) ||
+            ( ( pWssSendMessages[ i ].correlationIdLength != 0 ) &&
+              ( pWssSendMessages[ i ].pCorrelationId == NULL ) ) )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            result = SIGNALING_RESULT_BAD_PARAM;
         }
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        memset( pCredentials, 0, sizeof( SignalingCredential_t ) );
-
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+        InitWriter( &( writer ), pBuffer, *pBufferLength );
 
-        if( jsonResult == JSONSuccess )
+        for( i = 0; i < messageCount; i++ )
         {
-            if( ( pair.jsonType != JSONObject ) ||
-                ( pair.keyLength != strlen( "credentials" ) ) ||
-                ( strncmp( pair.key, "credentials", pair.keyLength ) != 0 ) )
-            {
-                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-            }
-            else
+            if( pOffsets != NULL )
             {
-                pCredentialsBuffer = pair.value;
-                credentialsBufferLength = pair.valueLength;
+                pOffsets[ i ] = writer.length;
             }
+
+            AppendWssMessageToWriter( &( writer ), &( pWssSendMessages[ i ] ), NULL, 0 );
         }
-        else
+
+        if( pOffsets != NULL )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            pOffsets[ messageCount ] = writer.length;
         }
+
+        result = FinishWriter( &( writer ), pBufferLength );
     }
 
-    if( result == SIGNALING_RESULT_OK )
-    {
-        jsonResult = JSON_Iterate( pCredentialsBuffer, credentialsBufferLength, &( credentialsStart ), &( credentialsNext ), &( pair ) );
+    return result;
+}
 
-        while( jsonResult == JSONSuccess )
-        {
-            if( strncmp( pair.key,
-                         "accessKeyId",
-                         pair.keyLength ) == 0 )
-            {
-                if( pair.valueLength < ACCESS_KEY_MAX_LEN )
-                {
-                    pCredentials->pAccessKeyId = pair.value;
-                    pCredentials->accessKeyIdLength = pair.valueLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_ACCESS_KEY_LENGTH_TOO_LARGE;
-                }
+/*-----------------------------------------------------------*/
 
-            }
-            else if( strncmp( pair.key,
-                              "secretAccessKey",
-                              pair.keyLength ) == 0 )
-            {
-                if( pair.valueLength < SECRET_ACCESS_KEY_MAX_LEN )
-                {
-                    pCredentials->pSecretAccessKey = pair.value;
-                    pCredentials->secretAccessKeyLength = pair.valueLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE;
-                }
-            }
-            else if( strncmp( pair.key,
-                              "sessionToken",
-                              pair.keyLength ) == 0 )
-            {
-                if( pair.valueLength < SESSION_TOKEN_MAX_LEN )
-                {
-                    pCredentials->pSessionToken = pair.value;
-                    pCredentials->sessionTokenLength = pair.valueLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_SESSION_TOKEN_LENGTH_TOO_LARGE;
-                }
-            }
-            else if( strncmp( pair.key,
-                              "expiration",
-                              pair.keyLength ) == 0 )
-            {
-                if( pair.valueLength < EXPIRATION_MAX_LEN )
-                {
-                    pCredentials->pExpiration = pair.value;
-                    pCredentials->expirationLength = pair.valueLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_EXPIRATION_LENGTH_TOO_LARGE;
-                }
-            }
-            else
-            {
-                /* Skip unknown attributes. */
-            }
+SignalingResult_t Signaling_ConstructWssMessageWithHeadroom( WssSendMessage_t * pWssSendMessage,
+                                                             char * pBuffer,
+                                                             size_t * pBufferLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t messageBufferLength = 0;
 
-            if( result != SIGNALING_RESULT_OK )
-            {
-                break;
-            }
+    if( ( pWssSendMessage == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pWssSendMessage->pBase64EncodedMessage == NULL ) ||
+        ( ( pWssSendMessage->recipientClientIdLength != 0 ) &&
+          ( pWssSendMessage->pRecipientClientId == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
 
-            jsonResult = JSON_Iterate( pCredentialsBuffer, credentialsBufferLength, &( credentialsStart ), &( credentialsNext ), &( pair ) );
+    if( ( result == SIGNALING_RESULT_OK ) && ( pBuffer != NULL ) )
+    {
+        if( *pBufferLength <= SIGNALING_WSS_FRAME_HEADROOM )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            messageBufferLength = *pBufferLength - SIGNALING_WSS_FRAME_HEADROOM;
         }
     }
 
-    if( ( result == SIGNALING_RESULT_OK ) &&
-        ( ( pCredentials->pAccessKeyId == NULL ) ||
-          ( pCredentials->pSecretAccessKey == NULL ) ||
-          ( pCredentials->pSessionToken == NULL ) ||
-          ( pCredentials->pExpiration == NULL ) ) )
+    if( result == SIGNALING_RESULT_OK )
     {
-        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+        result = ConstructWssMessage( pWssSendMessage,
+                                      NULL,
+                                      0,
+                                      ( pBuffer != NULL ) ? &( pBuffer[ SIGNALING_WSS_FRAME_HEADROOM ] ) : NULL,
+                                      &( messageBufferLength ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        if( pBuffer != NULL )
+        {
+            *pBufferLength = messageBufferLength;
+        }
+        else if( messageBufferLength > ( SIZE_MAX - SIGNALING_WSS_FRAME_HEADROOM ) )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            /* Size query, the size includes the headroom. */
+            *pBufferLength = messageBufferLength + SIGNALING_WSS_FRAME_HEADROOM;
+        }
     }
 
     return result;
@@ -622,67 +5244,87 @@ SignalingResult_t Signaling_ParseFetchTempCredsResponseFromAwsIot( const char *
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructDescribeMediaStorageConfigRequest( SignalingAwsRegion_t * pAwsRegion,
-                                                                        SignalingChannelArn_t * pChannelArn,
-                                                                        SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_FinalizeWssFrame( char * pBuffer,
+                                              size_t messageLength,
+                                              const uint8_t * pMaskingKey,
+                                              size_t * pFrameOffset,
+                                              size_t * pFrameLength )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
+    uint8_t * pFrame;
+    size_t headerLength = 2, frameOffset = 0, i;
 
-    if( ( pAwsRegion == NULL ) ||
-        ( pAwsRegion->pAwsRegion == NULL ) ||
-        ( pChannelArn == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) ||
-        ( pChannelArn->pChannelArn == NULL ) )
+    if( ( pBuffer == NULL ) ||
+        ( pFrameOffset == NULL ) ||
+        ( pFrameLength == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        if( SIGNALING_IS_CHINA_REGION( pAwsRegion ) )
+        if( messageLength >= 65536U )
+        {
+            headerLength += 8U;
+        }
+        else if( messageLength >= 126U )
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com.cn/describeMediaStorageConfiguration",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
+            headerLength += 2U;
         }
         else
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com/describeMediaStorageConfiguration",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
+            /* The length fits in the second header byte. */
+        }
+
+        if( pMaskingKey != NULL )
+        {
+            headerLength += 4U;
         }
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
+        frameOffset = SIGNALING_WSS_FRAME_HEADROOM - headerLength;
 
-        if( result == SIGNALING_RESULT_OK )
+        if( messageLength > ( SIZE_MAX - SIGNALING_WSS_FRAME_HEADROOM ) )
         {
-            pRequestBuffer->urlLength = snprintfRetVal;
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
         }
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                   pRequestBuffer->bodyLength,
-                                   "{"
-                                        "\"ChannelARN\":\"%.*s\""
-                                   "}",
-                                   ( int ) pChannelArn->channelArnLength,
-                                   pChannelArn->pChannelArn );
+        pFrame = ( uint8_t * ) &( pBuffer[ frameOffset ] );
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->bodyLength );
+        /* FIN bit and the text opcode, the message is JSON. */
+        pFrame[ 0 ] = 0x81U;
+        pFrame[ 1 ] = ( pMaskingKey != NULL ) ? 0x80U : 0x00U;
 
-        if( result == SIGNALING_RESULT_OK )
+        if( messageLength >= 65536U )
         {
-            pRequestBuffer->bodyLength = snprintfRetVal;
+            pFrame[ 1 ] |= 127U;
+
+            for( i = 0; i < 8U; i++ )
+            {
+                pFrame[ 2U + i ] = ( uint8_t ) ( ( ( uint64_t ) messageLength ) >> ( 8U * ( 7U - i ) ) );
+            }
+        }
+        else if( messageLength >= 126U )
+        {
+            pFrame[ 1 ] |= 126U;
+            pFrame[ 2 ] = ( uint8_t ) ( messageLength >> 8 );
+            pFrame[ 3 ] = ( uint8_t ) messageLength;
+        }
+        else
+        {
+            pFrame[ 1 ] |= ( uint8_t ) messageLength;
         }
+
+        if( pMaskingKey != NULL )
+        {
+            memcpy( &( pFrame[ headerLength - 4U ] ), pMaskingKey, 4U );
+            MaskWssPayload( &( pFrame[ headerLength ] ), messageLength, pMaskingKey );
+        }
+
+        *pFrameOffset = frameOffset;
+        *pFrameLength = headerLength + messageLength;
     }
 
     return result;
@@ -690,82 +5332,110 @@ SignalingResult_t Signaling_ConstructDescribeMediaStorageConfigRequest( Signalin
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseDescribeMediaStorageConfigResponse( const char * pMessage,
-                                                                     size_t messageLength,
-                                                                     SignalingMediaStorageConfig_t * pMediaStorageConfig )
+SignalingResult_t Signaling_ConstructWssMessageSegments( WssSendMessage_t * pWssSendMessage,
+                                                         SignalingIoVec_t * pSegments,
+                                                         size_t * pSegmentCount,
+                                                         size_t * pTotalLength )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
-    const char * pMediaStorageConfigBuffer = NULL;
-    size_t mediaStorageConfigBufferLength;
-    size_t mediaStorageConfigStart = 0, mediaStorageConfigNext = 0;
+    const char * pAction;
+    size_t count = 0, i;
 
-    if( ( pMessage == NULL ) ||
-        ( pMediaStorageConfig == NULL ) )
+    if( ( pWssSendMessage == NULL ) ||
+        ( pSegments == NULL ) ||
+        ( pSegmentCount == NULL ) ||
+        ( pTotalLength == NULL ) ||
+        ( pWssSendMessage->pBase64EncodedMessage == NULL ) ||
+        ( ( pWssSendMessage->recipientClientIdLength != 0 ) &&
+          ( pWssSendMessage->pRecipientClientId == NULL ) ) ||
+        ( ( pWssSendMessage->correlationIdLength != 0 ) &&
+          ( pWssSendMessage->pCorrelationId == NULL ) ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
-    if( result == SIGNALING_RESULT_OK )
+    /* Segments reference the fields as they are, so there is no place to
+     * write an escaped copy. */
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( FindJsonEscape( pWssSendMessage->pRecipientClientId,
+                            0,
+                            pWssSendMessage->recipientClientIdLength ) != pWssSendMessage->recipientClientIdLength ) ||
+          ( FindJsonEscape( pWssSendMessage->pCorrelationId,
+                            0,
+                            pWssSendMessage->correlationIdLength ) != pWssSendMessage->correlationIdLength ) ) )
     {
-        jsonResult = JSON_Validate( pMessage, messageLength );
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
 
-        if( jsonResult != JSONSuccess )
-        {
-            result = SIGNALING_RESULT_INVALID_JSON;
-        }
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( *pSegmentCount < SIGNALING_WSS_MESSAGE_MAX_SEGMENTS ) )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        memset( pMediaStorageConfig, 0, sizeof( SignalingMediaStorageConfig_t ) );
+        /* Same layout as ConstructWssMessage, but every field is referenced
+         * where it already lives instead of being copied. */
+        pAction = GetStringFromMessageType( pWssSendMessage->messageType );
 
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+        pSegments[ count ].pBase = "{\"action\":\"";
+        pSegments[ count ].length = SIGNALING_LITERAL_LENGTH( "{\"action\":\"" );
+        count++;
 
-        if( jsonResult == JSONSuccess )
+        pSegments[ count ].pBase = pAction;
+        pSegments[ count ].length = strlen( pAction );
+        count++;
+
+        pSegments[ count ].pBase = "\",\"RecipientClientId\":\"";
+        pSegments[ count ].length = SIGNALING_LITERAL_LENGTH( "\",\"RecipientClientId\":\"" );
+        count++;
+
+        if( pWssSendMessage->recipientClientIdLength > 0 )
         {
-            if( ( pair.jsonType != JSONObject ) ||
-                ( pair.keyLength != strlen( "MediaStorageConfiguration" ) ) ||
-                ( strncmp( pair.key, "MediaStorageConfiguration", pair.keyLength ) != 0 ) )
-            {
-                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-            }
-            else
-            {
-                pMediaStorageConfigBuffer = pair.value;
-                mediaStorageConfigBufferLength = pair.valueLength;
-            }
+            pSegments[ count ].pBase = pWssSendMessage->pRecipientClientId;
+            pSegments[ count ].length = pWssSendMessage->recipientClientIdLength;
+            count++;
         }
-        else
+
+        pSegments[ count ].pBase = "\",\"MessagePayload\":\"";
+        pSegments[ count ].length = SIGNALING_LITERAL_LENGTH( "\",\"MessagePayload\":\"" );
+        count++;
+
+        if( pWssSendMessage->base64EncodedMessageLength > 0 )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            pSegments[ count ].pBase = pWssSendMessage->pBase64EncodedMessage;
+            pSegments[ count ].length = pWssSendMessage->base64EncodedMessageLength;
+            count++;
         }
-    }
 
-    if( result == SIGNALING_RESULT_OK )
-    {
-        jsonResult = JSON_Iterate( pMediaStorageConfigBuffer, mediaStorageConfigBufferLength, &( mediaStorageConfigStart ), &( mediaStorageConfigNext ), &( pair ) );
+        if( pWssSendMessage->correlationIdLength > 0 )
+        {
+            pSegments[ count ].pBase = "\",\"CorrelationId\":\"";
+            pSegments[ count ].length = SIGNALING_LITERAL_LENGTH( "\",\"CorrelationId\":\"" );
+            count++;
 
-        while( jsonResult == JSONSuccess )
+            pSegments[ count ].pBase = pWssSendMessage->pCorrelationId;
+            pSegments[ count ].length = pWssSendMessage->correlationIdLength;
+            count++;
+        }
+
+        pSegments[ count ].pBase = "\"}";
+        pSegments[ count ].length = SIGNALING_LITERAL_LENGTH( "\"}" );
+        count++;
+
+        *pSegmentCount = count;
+        *pTotalLength = 0;
+
+        for( i = 0; i < count; i++ )
         {
-            if( strncmp( pair.key, "Status", pair.keyLength ) == 0 )
-            {
-                pMediaStorageConfig->pStatus = pair.value;
-                pMediaStorageConfig->statusLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "StreamARN", pair.keyLength ) == 0 )
-            {
-                pMediaStorageConfig->pStreamArn = pair.value;
-                pMediaStorageConfig->streamArnLength = pair.valueLength;
-            }
-            else
+            if( pSegments[ i ].length > ( SIZE_MAX - *pTotalLength ) )
             {
-                /* Skip unknown attributes. */
+                result = SIGNALING_RESULT_OUT_OF_MEMORY;
+                break;
             }
 
-            jsonResult = JSON_Iterate( pMediaStorageConfigBuffer, mediaStorageConfigBufferLength, &( mediaStorageConfigStart ), &( mediaStorageConfigNext ), &( pair ) );
+            *pTotalLength += pSegments[ i ].length;
         }
     }
 
@@ -774,168 +5444,165 @@ SignalingResult_t Signaling_ParseDescribeMediaStorageConfigResponse( const char
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructCreateSignalingChannelRequest( SignalingAwsRegion_t * pAwsRegion,
-                                                                    CreateSignalingChannelRequestInfo_t * pCreateSignalingChannelRequestInfo,
-                                                                    SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_InitBroadcast( WssSendMessage_t * pWssSendMessage,
+                                          char * pBuffer,
+                                          size_t * pBufferLength,
+                                          SignalingBroadcast_t * pBroadcast )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
-    size_t remainingLength = 0, currentIndex = 0, i;
+    SignalingWriter_t writer;
+    const char * pAction;
+    size_t prefixLength = 0;
 
-    if( ( pAwsRegion == NULL ) ||
-        ( pAwsRegion->pAwsRegion == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pCreateSignalingChannelRequestInfo == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) ||
-        ( ( pCreateSignalingChannelRequestInfo->numTags > 0 ) && ( pCreateSignalingChannelRequestInfo->pTags == NULL ) ) ||
-        ( pCreateSignalingChannelRequestInfo->channelName.channelNameLength >= SIGNALING_CHANNEL_NAME_MAX_LEN ) )
+    if( ( pWssSendMessage == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pBroadcast == NULL ) ||
+        ( pWssSendMessage->pBase64EncodedMessage == NULL ) ||
+        ( ( pWssSendMessage->correlationIdLength != 0 ) &&
+          ( pWssSendMessage->pCorrelationId == NULL ) ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        if( SIGNALING_IS_CHINA_REGION( pAwsRegion ) )
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com.cn/createSignalingChannel",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
-        }
-        else
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com/createSignalingChannel",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
-        }
+        /* Same layout as ConstructWssMessage, split around the recipient
+         * client ID, which is ignored here. */
+        pAction = GetStringFromMessageType( pWssSendMessage->messageType );
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
+        InitWriter( &( writer ), pBuffer, *pBufferLength );
 
-        if( result == SIGNALING_RESULT_OK )
+        SIGNALING_APPEND_LITERAL( &( writer ), "{\"action\":\"" );
+        AppendToWriter( &( writer ), pAction, strlen( pAction ) );
+        SIGNALING_APPEND_LITERAL( &( writer ), "\",\"RecipientClientId\":\"" );
+        prefixLength = writer.length;
+
+        SIGNALING_APPEND_LITERAL( &( writer ), "\",\"MessagePayload\":\"" );
+        AppendToWriter( &( writer ), pWssSendMessage->pBase64EncodedMessage, pWssSendMessage->base64EncodedMessageLength );
+        SIGNALING_APPEND_LITERAL( &( writer ), "\"" );
+
+        if( pWssSendMessage->correlationIdLength > 0 )
         {
-            pRequestBuffer->urlLength = snprintfRetVal;
+            SIGNALING_APPEND_LITERAL( &( writer ), ",\"CorrelationId\":\"" );
+            AppendEscapedToWriter( &( writer ), pWssSendMessage->pCorrelationId, pWssSendMessage->correlationIdLength );
+            SIGNALING_APPEND_LITERAL( &( writer ), "\"" );
         }
+
+        SIGNALING_APPEND_LITERAL( &( writer ), "}" );
+
+        result = FinishWriter( &( writer ), pBufferLength );
     }
 
-    if( result == SIGNALING_RESULT_OK )
+    if( ( result == SIGNALING_RESULT_OK ) && ( pBuffer != NULL ) )
     {
-        remainingLength = pRequestBuffer->bodyLength;
+        pBroadcast->pPrefix = pBuffer;
+        pBroadcast->prefixLength = prefixLength;
+        pBroadcast->pSuffix = &( pBuffer[ prefixLength ] );
+        pBroadcast->suffixLength = *pBufferLength - prefixLength;
+    }
+
+    return result;
+}
 
-        snprintfRetVal = snprintf( &( pRequestBuffer->pBody[ currentIndex ] ),
-                                   remainingLength,
-                                   "{"
-                                        "\"ChannelName\":\"%.*s\","
-                                        "\"ChannelType\":\"%s\","
-                                        "\"SingleMasterConfiguration\":"
-                                        "{"
-                                            "\"MessageTtlSeconds\":%u"
-                                        "}",
-                                   ( int ) pCreateSignalingChannelRequestInfo->channelName.channelNameLength,
-                                   pCreateSignalingChannelRequestInfo->channelName.pChannelName,
-                                   ( pCreateSignalingChannelRequestInfo->channelType == SIGNALING_TYPE_CHANNEL_SINGLE_MASTER ) ? "SINGLE_MASTER" : "UNKOWN",
-                                   ( unsigned int ) pCreateSignalingChannelRequestInfo->messageTtlSeconds );
+/*-----------------------------------------------------------*/
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
+SignalingResult_t Signaling_ConstructBroadcastMessage( const SignalingBroadcast_t * pBroadcast,
+                                                       const char * pRecipientClientId,
+                                                       size_t recipientClientIdLength,
+                                                       char * pBuffer,
+                                                       size_t * pBufferLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingWriter_t writer;
 
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength = snprintfRetVal;
-            remainingLength -= snprintfRetVal;
-            currentIndex += snprintfRetVal;
-        }
+    if( ( pBroadcast == NULL ) ||
+        ( pBroadcast->pPrefix == NULL ) ||
+        ( pBroadcast->pSuffix == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( ( recipientClientIdLength != 0 ) && ( pRecipientClientId == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
     }
 
-    if( ( result == SIGNALING_RESULT_OK ) && ( pCreateSignalingChannelRequestInfo->numTags > 0 ) )
+    if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( &( pRequestBuffer->pBody[ currentIndex ] ),
-                                   remainingLength,
-                                   ","
-                                   "\"Tags\":"
-                                   "[" );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
+        InitWriter( &( writer ), pBuffer, *pBufferLength );
 
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength += snprintfRetVal;
-            remainingLength -= snprintfRetVal;
-            currentIndex += snprintfRetVal;
-        }
+        AppendToWriter( &( writer ), pBroadcast->pPrefix, pBroadcast->prefixLength );
+        AppendEscapedToWriter( &( writer ), pRecipientClientId, recipientClientIdLength );
+        AppendToWriter( &( writer ), pBroadcast->pSuffix, pBroadcast->suffixLength );
 
-        for( i = 0; ( i < pCreateSignalingChannelRequestInfo->numTags ) && ( result == SIGNALING_RESULT_OK ); i++ )
-        {
-            if( i == 0 )
-            {
-                snprintfRetVal = snprintf( &( pRequestBuffer->pBody[ currentIndex ] ),
-                                           remainingLength,
-                                           "{"
-                                                "\"Key\":\"%.*s\","
-                                                "\"Value\":\"%.*s\""
-                                           "}",
-                                           ( int ) pCreateSignalingChannelRequestInfo->pTags[ i ].nameLength,
-                                           pCreateSignalingChannelRequestInfo->pTags[ i ].pName,
-                                           ( int ) pCreateSignalingChannelRequestInfo->pTags[ i ].valueLength,
-                                           pCreateSignalingChannelRequestInfo->pTags[ i ].pValue );
-            }
-            else
-            {
-                snprintfRetVal = snprintf( &( pRequestBuffer->pBody[ currentIndex ] ),
-                                           remainingLength,
-                                           ",{"
-                                                "\"Key\":\"%.*s\","
-                                                "\"Value\":\"%.*s\""
-                                           "}",
-                                           ( int ) pCreateSignalingChannelRequestInfo->pTags[ i ].nameLength,
-                                           pCreateSignalingChannelRequestInfo->pTags[ i ].pName,
-                                           ( int ) pCreateSignalingChannelRequestInfo->pTags[ i ].valueLength,
-                                           pCreateSignalingChannelRequestInfo->pTags[ i ].pValue );
-            }
+        result = FinishWriter( &( writer ), pBufferLength );
+    }
 
-            result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
+    return result;
+}
 
-            if( result == SIGNALING_RESULT_OK )
-            {
-                pRequestBuffer->bodyLength += snprintfRetVal;
-                remainingLength -= snprintfRetVal;
-                currentIndex += snprintfRetVal;
-            }
-        }
+/*-----------------------------------------------------------*/
 
-        if( result == SIGNALING_RESULT_OK )
-        {
-            snprintfRetVal = snprintf( &( pRequestBuffer->pBody[ currentIndex ] ),
-                                       remainingLength,
-                                       "]" );
+SignalingResult_t Signaling_ConstructBroadcastSegments( const SignalingBroadcast_t * pBroadcast,
+                                                        const char * pRecipientClientId,
+                                                        size_t recipientClientIdLength,
+                                                        SignalingIoVec_t * pSegments,
+                                                        size_t * pSegmentCount,
+                                                        size_t * pTotalLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t count = 0;
+
+    if( ( pBroadcast == NULL ) ||
+        ( pBroadcast->pPrefix == NULL ) ||
+        ( pBroadcast->pSuffix == NULL ) ||
+        ( pSegments == NULL ) ||
+        ( pSegmentCount == NULL ) ||
+        ( pTotalLength == NULL ) ||
+        ( ( recipientClientIdLength != 0 ) && ( pRecipientClientId == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
 
-            result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
+    /* The recipient client ID is referenced as it is, so there is no place
+     * to write an escaped copy. */
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( FindJsonEscape( pRecipientClientId, 0, recipientClientIdLength ) != recipientClientIdLength ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
 
-            if( result == SIGNALING_RESULT_OK )
-            {
-                pRequestBuffer->bodyLength += snprintfRetVal;
-                remainingLength -= snprintfRetVal;
-                currentIndex += snprintfRetVal;
-            }
-        }
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( *pSegmentCount < SIGNALING_BROADCAST_MAX_SEGMENTS ) )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( recipientClientIdLength > ( SIZE_MAX - pBroadcast->prefixLength ) ) ||
+          ( pBroadcast->suffixLength > ( SIZE_MAX - pBroadcast->prefixLength - recipientClientIdLength ) ) ) )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( &( pRequestBuffer->pBody[ currentIndex ] ),
-                                   remainingLength,
-                                   "}" );
+        /* Every recipient shares the prefix and the suffix, which holds the
+         * payload, so the cost doesn't depend on the payload size. */
+        pSegments[ count ].pBase = pBroadcast->pPrefix;
+        pSegments[ count ].length = pBroadcast->prefixLength;
+        count++;
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
-
-        if( result == SIGNALING_RESULT_OK )
+        if( recipientClientIdLength > 0 )
         {
-            pRequestBuffer->bodyLength += snprintfRetVal;
-            remainingLength -= snprintfRetVal;
-            currentIndex += snprintfRetVal;
+            pSegments[ count ].pBase = pRecipientClientId;
+            pSegments[ count ].length = recipientClientIdLength;
+            count++;
         }
+
+        pSegments[ count ].pBase = pBroadcast->pSuffix;
+        pSegments[ count ].length = pBroadcast->suffixLength;
+        count++;
+
+        *pSegmentCount = count;
+        *pTotalLength = pBroadcast->prefixLength + recipientClientIdLength + pBroadcast->suffixLength;
     }
 
     return result;
@@ -943,53 +5610,21 @@ SignalingResult_t Signaling_ConstructCreateSignalingChannelRequest( SignalingAws
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseCreateSignalingChannelResponse( const char * pMessage,
-                                                                 size_t messageLength,
-                                                                 SignalingChannelArn_t * pChannelArn )
+SignalingResult_t Signaling_ParseWssRecvMessage( const char * pMessage,
+                                                 size_t messageLength,
+                                                 WssRecvMessage_t * pWssRecvMessage )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
 
     if( ( pMessage == NULL ) ||
-        ( pChannelArn == NULL ) )
+        ( pWssRecvMessage == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        jsonResult = JSON_Validate( pMessage, messageLength );
-
-        if( jsonResult != JSONSuccess )
-        {
-            result = SIGNALING_RESULT_INVALID_JSON;
-        }
-    }
-
-    if( result == SIGNALING_RESULT_OK )
-    {
-        memset( pChannelArn, 0, sizeof( SignalingChannelArn_t ) );
-
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
-
-        if( jsonResult == JSONSuccess )
-        {
-            if( strncmp( pair.key, "ChannelARN", pair.keyLength ) == 0 )
-            {
-                pChannelArn->pChannelArn = pair.value;
-                pChannelArn->channelArnLength = pair.valueLength;
-            }
-            else
-            {
-                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-            }
-        }
-        else
-        {
-            result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-        }
+        result = ParseWssRecvMessage( pMessage, messageLength, pWssRecvMessage );
     }
 
     return result;
@@ -997,127 +5632,34 @@ SignalingResult_t Signaling_ParseCreateSignalingChannelResponse( const char * pM
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructGetSignalingChannelEndpointRequest( SignalingAwsRegion_t * pAwsRegion,
-                                                                         GetSignalingChannelEndpointRequestInfo_t * pGetSignalingChannelEndpointRequestInfo,
-                                                                         SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_ParseWssRecvMessageBatch( const WssRecvFrame_t * pFrames,
+                                                      size_t frameCount,
+                                                      WssRecvMessage_t * pWssRecvMessages,
+                                                      SignalingResult_t * pResults )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
-    char protocolsString[ SIGNALING_GET_ENDPOINT_PROTOCOL_MAX_STRING_LENGTH ] = { 0 };
-    size_t protocolIndex = 0;
-    uint8_t isFirstProtocol = 1;
+    size_t i;
 
-    if( ( pAwsRegion == NULL ) ||
-        ( pAwsRegion->pAwsRegion == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pGetSignalingChannelEndpointRequestInfo == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) ||
-        ( pGetSignalingChannelEndpointRequestInfo->channelArn.pChannelArn == NULL ) ||
-        ( ( pGetSignalingChannelEndpointRequestInfo->role != SIGNALING_ROLE_MASTER ) && ( pGetSignalingChannelEndpointRequestInfo->role != SIGNALING_ROLE_VIEWER ) ) )
+    if( ( pFrames == NULL ) ||
+        ( pWssRecvMessages == NULL ) ||
+        ( pResults == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
-    if( result == SIGNALING_RESULT_OK )
+    /* Parameters are checked once for the whole batch, each frame then goes
+     * straight to the parser. */
+    for( i = 0; ( result == SIGNALING_RESULT_OK ) && ( i < frameCount ); i++ )
     {
-        if( SIGNALING_IS_CHINA_REGION( pAwsRegion ) )
+        if( pFrames[ i ].pMessage == NULL )
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com.cn/getSignalingChannelEndpoint",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
+            pResults[ i ] = SIGNALING_RESULT_BAD_PARAM;
         }
         else
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com/getSignalingChannelEndpoint",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
-        }
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->urlLength = snprintfRetVal;
-        }
-    }
-
-    if( result == SIGNALING_RESULT_OK )
-    {
-        if( ( pGetSignalingChannelEndpointRequestInfo->protocols & SIGNALING_PROTOCOL_WEBSOCKET_SECURE ) != 0 )
-        {
-            memcpy( ( void * ) &( protocolsString[ protocolIndex ] ),
-                    ( const void * ) "\"WSS\"",
-                    5 );
-            protocolIndex += 5;
-
-            isFirstProtocol = 0;
-        }
-
-        if( ( pGetSignalingChannelEndpointRequestInfo->protocols & SIGNALING_PROTOCOL_HTTPS ) != 0 )
-        {
-            if( isFirstProtocol == 0 )
-            {
-                memcpy( ( void * ) &( protocolsString[ protocolIndex ] ),
-                        ( const void * ) ",",
-                        1 );
-                protocolIndex += 1;
-            }
-
-            memcpy( ( void * ) &( protocolsString[ protocolIndex ] ),
-                    ( const void * ) "\"HTTPS\"",
-                    8 );
-            protocolIndex += 7;
-
-            isFirstProtocol = 0;
-        }
-
-        if( ( pGetSignalingChannelEndpointRequestInfo->protocols & SIGNALING_PROTOCOL_WEBRTC ) != 0 )
-        {
-            if( isFirstProtocol == 0 )
-            {
-                memcpy( ( void * ) &( protocolsString[ protocolIndex ] ),
-                        ( const void * ) ",",
-                        2 );
-                protocolIndex += 1;
-            }
-
-            memcpy( ( void * ) &( protocolsString[ protocolIndex ] ),
-                    ( const void * ) "\"WEBRTC\"",
-                    9 );
-            protocolIndex += 8;
-
-            isFirstProtocol = 0;
-        }
-    }
-
-    if( result == SIGNALING_RESULT_OK )
-    {
-        snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                   pRequestBuffer->bodyLength,
-                                   "{"
-                                        "\"ChannelARN\":\"%.*s\","
-                                        "\"SingleMasterChannelEndpointConfiguration\":"
-                                        "{"
-                                            "\"Protocols\":[%.*s],"
-                                            "\"Role\":\"%s\""
-                                        "}"
-                                   "}",
-                                   ( int ) pGetSignalingChannelEndpointRequestInfo->channelArn.channelArnLength,
-                                   pGetSignalingChannelEndpointRequestInfo->channelArn.pChannelArn,
-                                   ( int ) protocolIndex,
-                                   protocolsString,
-                                   ( pGetSignalingChannelEndpointRequestInfo->role == SIGNALING_ROLE_MASTER ) ? "MASTER" : "VIEWER" );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->bodyLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength = snprintfRetVal;
+            pResults[ i ] = ParseWssRecvMessage( pFrames[ i ].pMessage,
+                                                 pFrames[ i ].messageLength,
+                                                 &( pWssRecvMessages[ i ] ) );
         }
     }
 
@@ -1126,131 +5668,69 @@ SignalingResult_t Signaling_ConstructGetSignalingChannelEndpointRequest( Signali
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseGetSignalingChannelEndpointResponse( const char * pMessage,
-                                                                      size_t messageLength,
-                                                                      SignalingChannelEndpoints_t * pSignalingChannelEndpoints )
+SignalingResult_t Signaling_PeekWssMessage( const char * pMessage,
+                                            size_t messageLength,
+                                            WssRecvMessage_t * pWssRecvMessage )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
+    JSONStatus_t jsonResult = JSONSuccess;
     size_t start = 0, next = 0;
     JSONPair_t pair = { 0 };
-    const char * pResourceEndpointListBuffer = NULL;
-    size_t resourceEndpointListBufferLength;
-    size_t resourceEndpointStart = 0, resourceEndpointNext = 0;
-    const char * pEndpointListBuffer = NULL;
-    size_t endpointListBufferLength;
-    size_t endpointListStart = 0, endpointListNext = 0;
-    const char * pEndpoint = NULL;
-    size_t endpointLength;
-    const char * pProtocol = NULL;
-    size_t protocolLength = 0;
+    uint8_t foundMessageType = 0, foundSenderClientId = 0;
 
     if( ( pMessage == NULL ) ||
-        ( pSignalingChannelEndpoints == NULL ) )
+        ( pWssRecvMessage == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        jsonResult = JSON_Validate( pMessage, messageLength );
-
-        if( jsonResult != JSONSuccess )
+        /* Exclude null terminator in messageLength. */
+        if( ( messageLength > 0 ) && ( pMessage[ messageLength - 1 ] == '\0' ) )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            messageLength--;
         }
-    }
-
-    if( result == SIGNALING_RESULT_OK )
-    {
-        memset( pSignalingChannelEndpoints, 0, sizeof( SignalingChannelEndpoints_t ) );
-
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
 
-        if( jsonResult == JSONSuccess )
-        {
-            if( ( pair.jsonType != JSONArray ) ||
-                ( pair.keyLength != strlen( "ResourceEndpointList" ) ) ||
-                ( strncmp( pair.key, "ResourceEndpointList", pair.keyLength ) != 0 ) )
-            {
-                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-            }
-            else
-            {
-                pResourceEndpointListBuffer = pair.value;
-                resourceEndpointListBufferLength = pair.valueLength;
-            }
-        }
-        else
-        {
-            result = SIGNALING_RESULT_INVALID_JSON;
-        }
+        memset( pWssRecvMessage, 0, sizeof( WssRecvMessage_t ) );
+        pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
     }
 
-    while( result == SIGNALING_RESULT_OK )
+    /* Members are validated one at a time, so stopping early leaves the
+     * rest of the message untouched. */
+    while( ( result == SIGNALING_RESULT_OK ) &&
+           ( jsonResult == JSONSuccess ) &&
+           ( ( foundMessageType == 0U ) || ( foundSenderClientId == 0U ) ) )
     {
-        jsonResult = JSON_Iterate( pResourceEndpointListBuffer, resourceEndpointListBufferLength, &( resourceEndpointStart ), &( resourceEndpointNext ), &( pair ) );
+        jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
 
         if( jsonResult == JSONSuccess )
         {
-            pEndpointListBuffer = pair.value;
-            endpointListBufferLength = pair.valueLength;
-            endpointListStart = 0;
-            endpointListNext = 0;
-            pEndpoint = NULL;
-            endpointLength = 0;
-            pProtocol = NULL;
-            protocolLength = 0;
-
-            jsonResult = JSON_Iterate( pEndpointListBuffer, endpointListBufferLength, &( endpointListStart ), &( endpointListNext ), &( pair ) );
-
-            while( jsonResult == JSONSuccess )
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
             {
-                if( strncmp( pair.key, "Protocol", pair.keyLength ) == 0 )
-                {
-                    pProtocol = pair.value;
-                    protocolLength = pair.valueLength;
-                }
-                else if( strncmp( pair.key, "ResourceEndpoint", pair.keyLength ) == 0 )
-                {
-                    pEndpoint = pair.value;
-                    endpointLength = pair.valueLength;
-                }
+                case SIGNALING_JSON_TOKEN_SENDER_CLIENT_ID:
+                    pWssRecvMessage->pSenderClientId = pair.value;
+                    pWssRecvMessage->senderClientIdLength = pair.valueLength;
+                    foundSenderClientId = 1U;
+                    break;
 
-                jsonResult = JSON_Iterate( pEndpointListBuffer, endpointListBufferLength, &( endpointListStart ), &( endpointListNext ), &( pair ) );
-            }
+                case SIGNALING_JSON_TOKEN_MESSAGE_TYPE:
+                    pWssRecvMessage->messageType = GetMessageTypeFromString( pair.value, pair.valueLength );
+                    foundMessageType = 1U;
+                    break;
 
-            if( ( pEndpoint != NULL ) && ( pProtocol != NULL ) )
-            {
-                if( ( protocolLength == 3 ) && ( ( strncmp( pProtocol, "WSS", 3 ) == 0 ) ||
-                                                 ( strncmp( pProtocol, "wss", 3 ) == 0 ) ) )
-                {
-                    pSignalingChannelEndpoints->wssEndpoint.pEndpoint = pEndpoint;
-                    pSignalingChannelEndpoints->wssEndpoint.endpointLength = endpointLength;
-                }
-                else if( ( protocolLength == 5 ) && ( ( strncmp( pProtocol, "HTTPS", 5 ) == 0 ) ||
-                                                      ( strncmp( pProtocol, "https", 5 ) == 0 ) ) )
-                {
-                    pSignalingChannelEndpoints->httpsEndpoint.pEndpoint = pEndpoint;
-                    pSignalingChannelEndpoints->httpsEndpoint.endpointLength = endpointLength;
-                }
-                else if( ( protocolLength == 6 ) && ( ( strncmp( pProtocol, "WEBRTC", 6 ) == 0 ) ||
-                                                      ( strncmp( pProtocol, "webrtc", 6 ) == 0 ) ) )
-                {
-                    pSignalingChannelEndpoints->webrtcEndpoint.pEndpoint = pEndpoint;
-                    pSignalingChannelEndpoints->webrtcEndpoint.endpointLength = endpointLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_INVALID_PROTOCOL;
-                }
+                default:
+                    /* Do nothing, ignore other tags. */
+                    break;
             }
         }
-        else
-        {
-            /* All parsed. */
-            break;
-        }
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( jsonResult != JSONSuccess ) &&
+        ( jsonResult != JSONNotFound ) )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
     }
 
     return result;
@@ -1258,60 +5738,21 @@ SignalingResult_t Signaling_ParseGetSignalingChannelEndpointResponse( const char
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructGetIceServerConfigRequest( SignalingChannelEndpoint_t * pHttpsEndpoint,
-                                                                GetIceServerConfigRequestInfo_t * pGetIceServerConfigRequestInfo,
-                                                                SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_InitWssRecvStream( WssRecvStream_t * pStream )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
 
-    if( ( pHttpsEndpoint == NULL ) ||
-        ( pHttpsEndpoint->pEndpoint == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pGetIceServerConfigRequestInfo == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) ||
-        ( pGetIceServerConfigRequestInfo->pClientId == NULL ) )
+    if( pStream == NULL )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                   pRequestBuffer->urlLength,
-                                   "%.*s/v1/get-ice-server-config",
-                                   ( int ) pHttpsEndpoint->endpointLength,
-                                   pHttpsEndpoint->pEndpoint );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->urlLength = snprintfRetVal;
-        }
-    }
-
-    if( result == SIGNALING_RESULT_OK )
-    {
-        snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                   pRequestBuffer->bodyLength,
-                                   "{"
-                                        "\"ChannelARN\":\"%.*s\","
-                                        "\"ClientId\":\"%.*s\","
-                                        "\"Service\":\"TURN\""
-                                   "}",
-                                   ( int ) pGetIceServerConfigRequestInfo->channelArn.channelArnLength,
-                                   pGetIceServerConfigRequestInfo->channelArn.pChannelArn,
-                                   ( int ) pGetIceServerConfigRequestInfo->clientIdLength,
-                                   pGetIceServerConfigRequestInfo->pClientId );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->bodyLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength = snprintfRetVal;
-        }
+        memset( pStream, 0, sizeof( WssRecvStream_t ) );
+        pStream->result = SIGNALING_RESULT_OK;
+        pStream->messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
+        pStream->state = WSS_RECV_STREAM_STATE_BEGIN;
     }
 
     return result;
@@ -1319,64 +5760,86 @@ SignalingResult_t Signaling_ConstructGetIceServerConfigRequest( SignalingChannel
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseGetIceServerConfigResponse( const char * pMessage,
-                                                             size_t messageLength,
-                                                             SignalingIceServer_t * pIceServers,
-                                                             size_t * pNumIceServers )
+SignalingResult_t Signaling_FeedWssRecvStream( WssRecvStream_t * pStream,
+                                               const char * pChunk,
+                                               size_t chunkLength,
+                                               WssRecvStreamUpdate_t * pUpdate )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
-    const char * pIceServerListBuffer = NULL;
-    size_t iceServerListBufferLength;
+    size_t i = 0;
+    WssRecvStreamFragment_t * pFragment = NULL;
 
-    if( ( pMessage == NULL ) ||
-        ( pIceServers == NULL ) ||
-        ( pNumIceServers == NULL ) )
+    if( ( pStream == NULL ) ||
+        ( pUpdate == NULL ) ||
+        ( ( pChunk == NULL ) && ( chunkLength > 0U ) ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        jsonResult = JSON_Validate( pMessage, messageLength );
+        memset( pUpdate, 0, sizeof( WssRecvStreamUpdate_t ) );
 
-        if( jsonResult != JSONSuccess )
+        /* Errors are sticky until the parser is initialized again. */
+        result = pStream->result;
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( chunkLength > 0U ) &&
+        ( pStream->state == WSS_RECV_STREAM_STATE_STRING ) &&
+        ( pStream->isKey == 0U ) )
+    {
+        /* A string value that started in an earlier chunk continues at the
+         * start of this one. */
+        pFragment = GetWssRecvStreamFragment( pUpdate, pStream->field );
+
+        if( pFragment != NULL )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            pFragment->pData = pChunk;
         }
     }
 
-    if( result == SIGNALING_RESULT_OK )
+    while( ( result == SIGNALING_RESULT_OK ) && ( i < chunkLength ) )
     {
-        memset( pIceServers, 0, sizeof( SignalingIceServer_t ) * ( *pNumIceServers ) );
+        switch( pStream->state )
+        {
+            case WSS_RECV_STREAM_STATE_STRING:
+                result = FeedWssRecvStreamString( pStream, pChunk, chunkLength, &( i ), pUpdate );
+                break;
 
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+            case WSS_RECV_STREAM_STATE_NUMBER:
+                result = FeedWssRecvStreamNumber( pStream, pChunk[ i ], &( i ) );
+                break;
 
-        if( jsonResult == JSONSuccess )
-        {
-            if( ( pair.jsonType != JSONArray ) ||
-                ( pair.keyLength != strlen( "IceServerList" ) ) ||
-                ( strncmp( pair.key, "IceServerList", pair.keyLength ) != 0 ) )
-            {
-                result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-            }
-            else
-            {
-                pIceServerListBuffer = pair.value;
-                iceServerListBufferLength = pair.valueLength;
-            }
+            case WSS_RECV_STREAM_STATE_LITERAL:
+                result = FeedWssRecvStreamLiteral( pStream, pChunk[ i ], &( i ) );
+                break;
+
+            default:
+                result = FeedWssRecvStreamStructure( pStream, pChunk, &( i ), pUpdate );
+                break;
         }
-        else
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( chunkLength > 0U ) &&
+        ( pStream->state == WSS_RECV_STREAM_STATE_STRING ) &&
+        ( pStream->isKey == 0U ) )
+    {
+        /* The string value continues in the next chunk. */
+        pFragment = GetWssRecvStreamFragment( pUpdate, pStream->field );
+
+        if( pFragment != NULL )
         {
-            result = SIGNALING_RESULT_INVALID_JSON;
+            pFragment->length = ( size_t ) ( &( pChunk[ chunkLength ] ) - pFragment->pData );
         }
     }
 
-    if( result == SIGNALING_RESULT_OK )
+    if( result != SIGNALING_RESULT_BAD_PARAM )
     {
-        result = ParseIceServerList( pIceServerListBuffer, iceServerListBufferLength, pIceServers, pNumIceServers );
+        pStream->result = result;
+        pUpdate->messageType = pStream->messageType;
+        pUpdate->isMessageComplete = ( pStream->state >= WSS_RECV_STREAM_STATE_DONE ) ? 1U : 0U;
     }
 
     return result;
@@ -1384,72 +5847,23 @@ SignalingResult_t Signaling_ParseGetIceServerConfigResponse( const char * pMessa
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructJoinStorageSessionRequest( SignalingChannelEndpoint_t * pWebrtcEndpoint,
-                                                                JoinStorageSessionRequestInfo_t * pJoinStorageSessionRequestInfo,
-                                                                SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_DecodeBase64( const char * pInput,
+                                          size_t inputLength,
+                                          char * pOutput,
+                                          size_t * pOutputLength )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
 
-    if( ( pWebrtcEndpoint == NULL ) ||
-        ( pWebrtcEndpoint->pEndpoint == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pJoinStorageSessionRequestInfo == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) ||
-        ( pJoinStorageSessionRequestInfo->channelArn.pChannelArn == NULL ) )
+    if( ( pInput == NULL ) ||
+        ( pOutput == NULL ) ||
+        ( pOutputLength == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                   pRequestBuffer->urlLength,
-                                   "%.*s/joinStorageSession",
-                                   ( int ) pWebrtcEndpoint->endpointLength,
-                                   pWebrtcEndpoint->pEndpoint );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->urlLength = snprintfRetVal;
-        }
-    }
-
-    if( result == SIGNALING_RESULT_OK )
-    {
-        if( pJoinStorageSessionRequestInfo->role == SIGNALING_ROLE_MASTER )
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                       pRequestBuffer->bodyLength,
-                                       "{"
-                                            "\"channelArn\":\"%.*s\""
-                                       "}",
-                                       ( int ) pJoinStorageSessionRequestInfo->channelArn.channelArnLength,
-                                       pJoinStorageSessionRequestInfo->channelArn.pChannelArn );
-        }
-        else
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                       pRequestBuffer->bodyLength,
-                                       "{"
-                                            "\"channelArn\":\"%.*s\","
-                                            "\"clientId\":\"%.*s\""
-                                       "}",
-                                       ( int ) pJoinStorageSessionRequestInfo->channelArn.channelArnLength,
-                                       pJoinStorageSessionRequestInfo->channelArn.pChannelArn,
-                                       ( int ) pJoinStorageSessionRequestInfo->clientIdLength,
-                                       pJoinStorageSessionRequestInfo->pClientId );
-        }
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->bodyLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength = snprintfRetVal;
-        }
+        result = DecodeBase64( pInput, inputLength, pOutput, pOutputLength );
     }
 
     return result;
@@ -1457,71 +5871,36 @@ SignalingResult_t Signaling_ConstructJoinStorageSessionRequest( SignalingChannel
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructDeleteSignalingChannelRequest( SignalingAwsRegion_t * pAwsRegion,
-                                                                    DeleteSignalingChannelRequestInfo_t * pDeleteSignalingChannelRequestInfo,
-                                                                    SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_EncodeBase64( const char * pInput,
+                                          size_t inputLength,
+                                          char * pOutput,
+                                          size_t * pOutputLength )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
+    size_t encodedLength = 0;
 
-    if( ( pAwsRegion == NULL ) ||
-        ( pAwsRegion->pAwsRegion == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pDeleteSignalingChannelRequestInfo == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pRequestBuffer->pBody == NULL ) ||
-        ( pDeleteSignalingChannelRequestInfo->channelArn.pChannelArn == NULL ) ||
-        ( pDeleteSignalingChannelRequestInfo->pVersion == NULL ) )
+    if( ( pInput == NULL ) ||
+        ( pOutput == NULL ) ||
+        ( pOutputLength == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        if( SIGNALING_IS_CHINA_REGION( pAwsRegion ) )
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com.cn/deleteSignalingChannel",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
-        }
-        else
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "https://kinesisvideo.%.*s.amazonaws.com/deleteSignalingChannel",
-                                       ( int ) pAwsRegion->awsRegionLength,
-                                       pAwsRegion->pAwsRegion );
-        }
+        encodedLength = ( ( inputLength + 2U ) / 3U ) * 4U;
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
-
-        if( result == SIGNALING_RESULT_OK )
+        if( ( inputLength > ( ( SIZE_MAX / 4U ) * 3U ) ) ||
+            ( encodedLength > *pOutputLength ) )
         {
-            pRequestBuffer->urlLength = snprintfRetVal;
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
         }
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( pRequestBuffer->pBody,
-                                   pRequestBuffer->bodyLength,
-                                   "{"
-                                   "\"ChannelARN\":\"%.*s\","
-                                   "\"CurrentVersion\":\"%.*s\""
-                                   "}",
-                                   ( int ) pDeleteSignalingChannelRequestInfo->channelArn.channelArnLength,
-                                   pDeleteSignalingChannelRequestInfo->channelArn.pChannelArn,
-                                   ( int ) pDeleteSignalingChannelRequestInfo->versionLength,
-                                   pDeleteSignalingChannelRequestInfo->pVersion );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->bodyLength );
-
-        if( result == SIGNALING_RESULT_OK )
-        {
-            pRequestBuffer->bodyLength = snprintfRetVal;
-        }
+        EncodeBase64( pInput, inputLength, pOutput );
+        *pOutputLength = encodedLength;
     }
 
     return result;
@@ -1529,144 +5908,197 @@ SignalingResult_t Signaling_ConstructDeleteSignalingChannelRequest( SignalingAws
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructConnectWssEndpointRequest( SignalingChannelEndpoint_t * pWssEndpoint,
-                                                                ConnectWssEndpointRequestInfo_t * pConnectWssEndpointRequestInfo,
-                                                                SignalingRequest_t * pRequestBuffer )
+SignalingResult_t Signaling_ParseSdpMessage( char * pMessage,
+                                             size_t messageLength,
+                                             SignalingSdpMessage_t * pSdpMessage )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
 
-    if( ( pWssEndpoint == NULL ) ||
-        ( pWssEndpoint->pEndpoint == NULL ) ||
-        ( pRequestBuffer == NULL ) ||
-        ( pConnectWssEndpointRequestInfo == NULL ) ||
-        ( pRequestBuffer->pUrl == NULL ) ||
-        ( pConnectWssEndpointRequestInfo->channelArn.pChannelArn == NULL ) ||
-        ( ( pConnectWssEndpointRequestInfo->role != SIGNALING_ROLE_MASTER ) &&
-          ( pConnectWssEndpointRequestInfo->role != SIGNALING_ROLE_VIEWER ) ) ||
-        ( ( pConnectWssEndpointRequestInfo->role == SIGNALING_ROLE_VIEWER ) &&
-          ( pConnectWssEndpointRequestInfo->pClientId == NULL ) ) )
+    if( ( pMessage == NULL ) ||
+        ( pSdpMessage == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        if( pConnectWssEndpointRequestInfo->role == SIGNALING_ROLE_MASTER )
-        {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "%.*s?X-Amz-ChannelARN=%.*s",
-                                       ( int ) pWssEndpoint->endpointLength,
-                                       pWssEndpoint->pEndpoint,
-                                       ( int ) pConnectWssEndpointRequestInfo->channelArn.channelArnLength,
-                                       pConnectWssEndpointRequestInfo->channelArn.pChannelArn );
-        }
-        else
+        /* Exclude null terminator in messageLength. */
+        if( ( messageLength > 0 ) && ( pMessage[ messageLength - 1 ] == '\0' ) )
         {
-            snprintfRetVal = snprintf( pRequestBuffer->pUrl,
-                                       pRequestBuffer->urlLength,
-                                       "%.*s?X-Amz-ChannelARN=%.*s&X-Amz-ClientId=%.*s",
-                                       ( int ) pWssEndpoint->endpointLength,
-                                       pWssEndpoint->pEndpoint,
-                                       ( int ) pConnectWssEndpointRequestInfo->channelArn.channelArnLength,
-                                       pConnectWssEndpointRequestInfo->channelArn.pChannelArn,
-                                       ( int ) pConnectWssEndpointRequestInfo->clientIdLength,
-                                       pConnectWssEndpointRequestInfo->pClientId );
+            messageLength--;
         }
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, pRequestBuffer->urlLength );
+        memset( pSdpMessage, 0, sizeof( SignalingSdpMessage_t ) );
+    }
 
-        if( result == SIGNALING_RESULT_OK )
+    /* Keep walking after an unexpected member so that a malformed message
+     * is reported as invalid JSON. */
+    while( ( ( result == SIGNALING_RESULT_OK ) || ( result == SIGNALING_RESULT_UNEXPECTED_RESPONSE ) ) &&
+           ( jsonResult == JSONSuccess ) )
+    {
+        jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+
+        if( jsonResult == JSONSuccess )
         {
-            pRequestBuffer->urlLength = snprintfRetVal;
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_TYPE:
+                    if( pair.jsonType != JSONString )
+                    {
+                        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                    }
+                    else
+                    {
+                        pSdpMessage->pType = pair.value;
+                        pSdpMessage->typeLength = pair.valueLength;
+                    }
+                    break;
+
+                case SIGNALING_JSON_TOKEN_SDP:
+                    if( pair.jsonType != JSONString )
+                    {
+                        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                    }
+                    else
+                    {
+                        pSdpMessage->pSdp = pair.value;
+                        pSdpMessage->sdpLength = pair.valueLength;
+                    }
+                    break;
+
+                default:
+                    /* Do nothing, ignore other tags. */
+                    break;
+            }
         }
     }
 
+    if( ( ( result == SIGNALING_RESULT_OK ) || ( result == SIGNALING_RESULT_UNEXPECTED_RESPONSE ) ) &&
+        ( jsonResult != JSONNotFound ) )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+
+    /* The whole message is valid, so the values can be rewritten now. */
+    if( result == SIGNALING_RESULT_OK )
+    {
+        UnescapeJsonValue( pMessage, &( pSdpMessage->pType ), &( pSdpMessage->typeLength ) );
+        UnescapeJsonValue( pMessage, &( pSdpMessage->pSdp ), &( pSdpMessage->sdpLength ) );
+    }
+
     return result;
 }
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ConstructWssMessage( WssSendMessage_t * pWssSendMessage,
-                                                 char * pBuffer,
-                                                 size_t * pBufferLength )
+SignalingResult_t Signaling_ParseIceCandidateMessage( char * pMessage,
+                                                      size_t messageLength,
+                                                      SignalingIceCandidateMessage_t * pIceCandidateMessage )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    int snprintfRetVal = 0;
-    size_t remainingLength = *pBufferLength;
-    size_t currentIndex = 0;
+    JSONStatus_t jsonResult = JSONSuccess;
+    size_t start = 0, next = 0;
+    JSONPair_t pair = { 0 };
+    uint8_t isNull;
 
-    if( ( pWssSendMessage == NULL ) ||
-        ( pBuffer == NULL ) ||
-        ( pWssSendMessage->pBase64EncodedMessage == NULL ) ||
-        ( ( pWssSendMessage->recipientClientIdLength != 0 ) && 
-          ( pWssSendMessage->pRecipientClientId == NULL ) ) )
+    if( ( pMessage == NULL ) ||
+        ( pIceCandidateMessage == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        snprintfRetVal = snprintf( &( pBuffer[ currentIndex ] ),
-                                   remainingLength,
-                                   "{"
-                                        "\"action\":\"%s\","
-                                        "\"RecipientClientId\":\"%.*s\","
-                                        "\"MessagePayload\":\"%.*s\"",
-                                   GetStringFromMessageType( pWssSendMessage->messageType ),
-                                   ( int ) pWssSendMessage->recipientClientIdLength,
-                                   pWssSendMessage->pRecipientClientId,
-                                   ( int ) pWssSendMessage->base64EncodedMessageLength,
-                                   pWssSendMessage->pBase64EncodedMessage );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
-
-        if( result == SIGNALING_RESULT_OK )
+        /* Exclude null terminator in messageLength. */
+        if( ( messageLength > 0 ) && ( pMessage[ messageLength - 1 ] == '\0' ) )
         {
-            remainingLength -= snprintfRetVal;
-            currentIndex += snprintfRetVal;
+            messageLength--;
         }
+
+        memset( pIceCandidateMessage, 0, sizeof( SignalingIceCandidateMessage_t ) );
     }
 
-    /* Append correlation ID. */
-    if( ( result == SIGNALING_RESULT_OK ) &&
-        ( pWssSendMessage->correlationIdLength > 0 ) )
+    /* Keep walking after an unexpected member so that a malformed message
+     * is reported as invalid JSON. */
+    while( ( ( result == SIGNALING_RESULT_OK ) || ( result == SIGNALING_RESULT_UNEXPECTED_RESPONSE ) ) &&
+           ( jsonResult == JSONSuccess ) )
     {
-        snprintfRetVal = snprintf( &( pBuffer[ currentIndex ] ),
-                                   remainingLength,
-                                   ","
-                                   "\"CorrelationId\":\"%.*s\"",
-                                   ( int ) pWssSendMessage->correlationIdLength,
-                                   pWssSendMessage->pCorrelationId );
-
-        result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
+        jsonResult = IterateValidatedObject( pMessage, messageLength, &( start ), &( next ), &( pair ) );
 
-        if( result == SIGNALING_RESULT_OK )
+        if( jsonResult == JSONSuccess )
         {
-            remainingLength -= snprintfRetVal;
-            currentIndex += snprintfRetVal;
-        }
-    }
+            /* Browsers send null for the members they don't know. */
+            isNull = ( pair.jsonType == JSONNull ) ? 1U : 0U;
 
-    if( result == SIGNALING_RESULT_OK )
-    {
-        snprintfRetVal = snprintf( &( pBuffer[ currentIndex ] ),
-                                   remainingLength,
-                                   "}" );
+            switch( LookupJsonToken( pair.key, pair.keyLength ) )
+            {
+                case SIGNALING_JSON_TOKEN_CANDIDATE:
+                    if( pair.jsonType != JSONString )
+                    {
+                        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                    }
+                    else
+                    {
+                        pIceCandidateMessage->pCandidate = pair.value;
+                        pIceCandidateMessage->candidateLength = pair.valueLength;
+                    }
+                    break;
 
-        result = InterpretSnprintfReturnValue( snprintfRetVal, remainingLength );
+                case SIGNALING_JSON_TOKEN_SDP_MID:
+                    if( isNull != 0U )
+                    {
+                        pIceCandidateMessage->pSdpMid = NULL;
+                        pIceCandidateMessage->sdpMidLength = 0;
+                    }
+                    else if( pair.jsonType != JSONString )
+                    {
+                        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                    }
+                    else
+                    {
+                        pIceCandidateMessage->pSdpMid = pair.value;
+                        pIceCandidateMessage->sdpMidLength = pair.valueLength;
+                    }
+                    break;
 
-        if( result == SIGNALING_RESULT_OK )
-        {
-            remainingLength -= snprintfRetVal;
-            currentIndex += snprintfRetVal;
+                case SIGNALING_JSON_TOKEN_SDP_M_LINE_INDEX:
+                    if( isNull != 0U )
+                    {
+                        pIceCandidateMessage->pSdpMLineIndex = NULL;
+                        pIceCandidateMessage->sdpMLineIndexLength = 0;
+                    }
+                    else if( pair.jsonType != JSONNumber )
+                    {
+                        result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
+                    }
+                    else
+                    {
+                        pIceCandidateMessage->pSdpMLineIndex = pair.value;
+                        pIceCandidateMessage->sdpMLineIndexLength = pair.valueLength;
+                    }
+                    break;
+
+                default:
+                    /* Do nothing, ignore other tags. */
+                    break;
+            }
         }
     }
 
+    if( ( ( result == SIGNALING_RESULT_OK ) || ( result == SIGNALING_RESULT_UNEXPECTED_RESPONSE ) ) &&
+        ( jsonResult != JSONNotFound ) )
+    {
+        result = SIGNALING_RESULT_INVALID_JSON;
+    }
+
+    /* The whole message is valid, so the values can be rewritten now. */
     if( result == SIGNALING_RESULT_OK )
     {
-        *pBufferLength = currentIndex;
+        UnescapeJsonValue( pMessage, &( pIceCandidateMessage->pCandidate ), &( pIceCandidateMessage->candidateLength ) );
+        UnescapeJsonValue( pMessage, &( pIceCandidateMessage->pSdpMid ), &( pIceCandidateMessage->sdpMidLength ) );
     }
 
     return result;
@@ -1674,157 +6106,61 @@ SignalingResult_t Signaling_ConstructWssMessage( WssSendMessage_t * pWssSendMess
 
 /*-----------------------------------------------------------*/
 
-SignalingResult_t Signaling_ParseWssRecvMessage( const char * pMessage,
-                                                 size_t messageLength,
-                                                 WssRecvMessage_t * pWssRecvMessage )
+SignalingResult_t Signaling_DecodeAndParseSdpMessage( const char * pBase64EncodedPayload,
+                                                      size_t base64EncodedPayloadLength,
+                                                      char * pBuffer,
+                                                      size_t * pBufferLength,
+                                                      SignalingSdpMessage_t * pSdpMessage )
 {
     SignalingResult_t result = SIGNALING_RESULT_OK;
-    JSONStatus_t jsonResult;
-    size_t start = 0, next = 0;
-    JSONPair_t pair = { 0 };
-    const char * pStatusResponseBuffer = NULL;
-    size_t statusResponseBufferLength = 0;
-    size_t statusResponseStart = 0, statusResponseNext = 0;
 
-    if( ( pMessage == NULL ) ||
-        ( pWssRecvMessage == NULL ) )
+    if( ( pBase64EncodedPayload == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pSdpMessage == NULL ) )
     {
         result = SIGNALING_RESULT_BAD_PARAM;
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        /* Exclude null terminator in messageLength. */
-        if(messageLength > 0 )
-        {
-            if( pMessage[ messageLength - 1 ] == '\0' )
-                {
-                    messageLength--;
-                }
-        }
-
-        jsonResult = JSON_Validate( pMessage, messageLength );
-
-        if( jsonResult != JSONSuccess )
-        {
-            result = SIGNALING_RESULT_INVALID_JSON;
-        }
+        result = DecodeBase64( pBase64EncodedPayload, base64EncodedPayloadLength, pBuffer, pBufferLength );
     }
 
     if( result == SIGNALING_RESULT_OK )
     {
-        pWssRecvMessage->pSenderClientId = NULL;
-        pWssRecvMessage->senderClientIdLength = 0;
-        pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
-        pWssRecvMessage->pBase64EncodedPayload = NULL;
-        pWssRecvMessage->base64EncodedPayloadLength = 0;
-        memset( &( pWssRecvMessage->statusResponse ), 0, sizeof( WssStatusResponse_t ) );
+        result = Signaling_ParseSdpMessage( pBuffer, *pBufferLength, pSdpMessage );
+    }
 
-        jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
+    return result;
+}
 
-        while( jsonResult == JSONSuccess )
-        {
-            if( strncmp( pair.key, "senderClientId", pair.keyLength ) == 0 )
-            {
-                pWssRecvMessage->pSenderClientId = pair.value;
-                pWssRecvMessage->senderClientIdLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "messageType", pair.keyLength ) == 0 )
-            {
-                if( strncmp( pair.value, "SDP_OFFER", pair.valueLength ) == 0 )
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_SDP_OFFER;
-                }
-                else if( strncmp( pair.value, "SDP_ANSWER", pair.valueLength ) == 0 )
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_SDP_ANSWER;
-                }
-                else if( strncmp( pair.value, "ICE_CANDIDATE", pair.valueLength ) == 0 )
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_ICE_CANDIDATE;
-                }
-                else if( strncmp( pair.value, "GO_AWAY", pair.valueLength ) == 0 )
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_GO_AWAY;
-                }
-                else if( strncmp( pair.value, "RECONNECT_ICE_SERVER", pair.valueLength ) == 0 )
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_RECONNECT_ICE_SERVER;
-                }
-                else if( strncmp( pair.value, "STATUS_RESPONSE", pair.valueLength ) == 0 )
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_STATUS_RESPONSE;
-                }
-                else
-                {
-                    pWssRecvMessage->messageType = SIGNALING_TYPE_MESSAGE_UNKNOWN;
-                }
-            }
-            else if( strncmp( pair.key, "messagePayload", pair.keyLength ) == 0 )
-            {
-                pWssRecvMessage->pBase64EncodedPayload = pair.value;
-                pWssRecvMessage->base64EncodedPayloadLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "statusResponse", pair.keyLength ) == 0 )
-            {
-                if( pair.jsonType == JSONObject )
-                {
-                    pStatusResponseBuffer = pair.value;
-                    statusResponseBufferLength = pair.valueLength;
-                }
-                else
-                {
-                    result = SIGNALING_RESULT_UNEXPECTED_RESPONSE;
-                    break;
-                }
-            }
-            else
-            {
-                /* Do nothing, ignore unknown tags. */
-            }
+/*-----------------------------------------------------------*/
 
-            jsonResult = JSON_Iterate( pMessage, messageLength, &( start ), &( next ), &( pair ) );
-        }
-    }
+SignalingResult_t Signaling_DecodeAndParseIceCandidateMessage( const char * pBase64EncodedPayload,
+                                                               size_t base64EncodedPayloadLength,
+                                                               char * pBuffer,
+                                                               size_t * pBufferLength,
+                                                               SignalingIceCandidateMessage_t * pIceCandidateMessage )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
 
-    if( ( result == SIGNALING_RESULT_OK ) && ( pStatusResponseBuffer != NULL ) )
+    if( ( pBase64EncodedPayload == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pIceCandidateMessage == NULL ) )
     {
-        jsonResult = JSON_Iterate( pStatusResponseBuffer, statusResponseBufferLength, &( statusResponseStart ), &( statusResponseNext ), &( pair ) );
-
-        if( jsonResult != JSONSuccess )
-        {
-            result = SIGNALING_RESULT_INVALID_STATUS_RESPONSE;
-        }
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
 
-        while( jsonResult == JSONSuccess )
-        {
-            if( strncmp( pair.key, "correlationId", pair.keyLength ) == 0 )
-            {
-                pWssRecvMessage->statusResponse.pCorrelationId = pair.value;
-                pWssRecvMessage->statusResponse.correlationIdLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "errorType", pair.keyLength ) == 0 )
-            {
-                pWssRecvMessage->statusResponse.pErrorType = pair.value;
-                pWssRecvMessage->statusResponse.errorTypeLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "statusCode", pair.keyLength ) == 0 )
-            {
-                pWssRecvMessage->statusResponse.pStatusCode = pair.value;
-                pWssRecvMessage->statusResponse.statusCodeLength = pair.valueLength;
-            }
-            else if( strncmp( pair.key, "description", pair.keyLength ) == 0 )
-            {
-                pWssRecvMessage->statusResponse.pDescription = pair.value;
-                pWssRecvMessage->statusResponse.descriptionLength = pair.valueLength;
-            }
-            else
-            {
-                /* Do nothing, ignore unknown tags. */
-            }
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = DecodeBase64( pBase64EncodedPayload, base64EncodedPayloadLength, pBuffer, pBufferLength );
+    }
 
-            jsonResult = JSON_Iterate( pStatusResponseBuffer, statusResponseBufferLength, &( statusResponseStart ), &( statusResponseNext ), &( pair ) );
-        }
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = Signaling_ParseIceCandidateMessage( pBuffer, *pBufferLength, pIceCandidateMessage );
     }
 
     return result;
@@ -0,0 +1,492 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_bootstrap.h"
+
+#define SIGNALING_HTTP_STATUS_SWITCHING_PROTOCOLS    ( 101U )
+#define SIGNALING_HTTP_STATUS_NOT_FOUND              ( 404U )
+
+#define SIGNALING_IS_HTTP_SUCCESS( statusCode )      ( ( ( statusCode ) >= 200U ) && ( ( statusCode ) < 300U ) )
+
+#define SIGNALING_CHANNEL_STATUS_ACTIVE              "ACTIVE"
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t CopyToBuffer( SignalingBootstrap_t * pBootstrap,
+                                       const char * pData,
+                                       size_t dataLength,
+                                       const char ** ppCopy );
+
+static SignalingResult_t CopyIceServers( SignalingBootstrap_t * pBootstrap,
+                                         const SignalingIceServer_t * pIceServers,
+                                         size_t iceServerCount );
+
+static SignalingResult_t ConstructRequest( SignalingBootstrap_t * pBootstrap,
+                                           SignalingBootstrapStep_t step,
+                                           SignalingRequest_t * pRequestBuffer );
+
+static SignalingResult_t ParseResponse( SignalingBootstrap_t * pBootstrap,
+                                        SignalingBootstrapStep_t step,
+                                        const char * pBody,
+                                        size_t bodyLength );
+
+static void UpdateCompletion( SignalingBootstrap_t * pBootstrap );
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t CopyToBuffer( SignalingBootstrap_t * pBootstrap,
+                                       const char * pData,
+                                       size_t dataLength,
+                                       const char ** ppCopy )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( dataLength > ( pBootstrap->bufferLength - pBootstrap->bufferUsed ) )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+    else
+    {
+        memcpy( &( pBootstrap->pBuffer[ pBootstrap->bufferUsed ] ), pData, dataLength );
+        *ppCopy = &( pBootstrap->pBuffer[ pBootstrap->bufferUsed ] );
+        pBootstrap->bufferUsed += dataLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t CopyIceServers( SignalingBootstrap_t * pBootstrap,
+                                         const SignalingIceServer_t * pIceServers,
+                                         size_t iceServerCount )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingIceServer_t * pCopy;
+    size_t i;
+    uint32_t j;
+
+    for( i = 0; ( i < iceServerCount ) && ( result == SIGNALING_RESULT_OK ); i++ )
+    {
+        pCopy = &( pBootstrap->iceServers[ i ] );
+        *pCopy = pIceServers[ i ];
+
+        if( pIceServers[ i ].pUserName != NULL )
+        {
+            result = CopyToBuffer( pBootstrap, pIceServers[ i ].pUserName, pIceServers[ i ].userNameLength, &( pCopy->pUserName ) );
+        }
+
+        if( ( result == SIGNALING_RESULT_OK ) && ( pIceServers[ i ].pPassword != NULL ) )
+        {
+            result = CopyToBuffer( pBootstrap, pIceServers[ i ].pPassword, pIceServers[ i ].passwordLength, &( pCopy->pPassword ) );
+        }
+
+        for( j = 0; ( j < pIceServers[ i ].urisNum ) && ( result == SIGNALING_RESULT_OK ); j++ )
+        {
+            result = CopyToBuffer( pBootstrap, pIceServers[ i ].pUris[ j ], pIceServers[ i ].urisLength[ j ], &( pCopy->pUris[ j ] ) );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ConstructRequest( SignalingBootstrap_t * pBootstrap,
+                                           SignalingBootstrapStep_t step,
+                                           SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    CreateSignalingChannelRequestInfo_t createInfo;
+    GetSignalingChannelEndpointRequestInfo_t getEndpointInfo;
+    GetIceServerConfigRequestInfo_t getIceServerConfigInfo;
+    ConnectWssEndpointRequestInfo_t connectInfo;
+
+    if( step == SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL )
+    {
+        result = Signaling_ConstructDescribeSignalingChannelRequest( &( pBootstrap->info.awsRegion ),
+                                                                     &( pBootstrap->info.channelName ),
+                                                                     pRequestBuffer );
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL )
+    {
+        memset( &( createInfo ), 0, sizeof( CreateSignalingChannelRequestInfo_t ) );
+        createInfo.channelName = pBootstrap->info.channelName;
+        createInfo.channelType = SIGNALING_TYPE_CHANNEL_SINGLE_MASTER;
+        createInfo.messageTtlSeconds = pBootstrap->info.messageTtlSeconds;
+
+        result = Signaling_ConstructCreateSignalingChannelRequest( &( pBootstrap->info.awsRegion ),
+                                                                   &( createInfo ),
+                                                                   pRequestBuffer );
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT )
+    {
+        /* The HTTPS endpoint is only needed for GetIceServerConfig. */
+        getEndpointInfo.channelArn = pBootstrap->channelArn;
+        getEndpointInfo.protocols = ( uint8_t ) SIGNALING_PROTOCOL_WEBSOCKET_SECURE;
+        getEndpointInfo.role = pBootstrap->info.role;
+
+        if( pBootstrap->info.getIceServerConfig != 0U )
+        {
+            getEndpointInfo.protocols |= ( uint8_t ) SIGNALING_PROTOCOL_HTTPS;
+        }
+
+        result = Signaling_ConstructGetSignalingChannelEndpointRequest( &( pBootstrap->info.awsRegion ),
+                                                                        &( getEndpointInfo ),
+                                                                        pRequestBuffer );
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS )
+    {
+        connectInfo.channelArn = pBootstrap->channelArn;
+        connectInfo.role = pBootstrap->info.role;
+        connectInfo.pClientId = pBootstrap->info.pClientId;
+        connectInfo.clientIdLength = pBootstrap->info.clientIdLength;
+
+        if( pBootstrap->info.pPresignInfo != NULL )
+        {
+            result = Signaling_ConstructPresignedConnectWssEndpointRequest( &( pBootstrap->endpoints.wssEndpoint ),
+                                                                            &( connectInfo ),
+                                                                            pBootstrap->info.pPresignInfo,
+                                                                            pRequestBuffer );
+        }
+        else
+        {
+            result = Signaling_ConstructConnectWssEndpointRequest( &( pBootstrap->endpoints.wssEndpoint ),
+                                                                   &( connectInfo ),
+                                                                   pRequestBuffer );
+        }
+    }
+    else
+    {
+        getIceServerConfigInfo.channelArn = pBootstrap->channelArn;
+        getIceServerConfigInfo.pClientId = pBootstrap->info.pClientId;
+        getIceServerConfigInfo.clientIdLength = pBootstrap->info.clientIdLength;
+
+        result = Signaling_ConstructGetIceServerConfigRequest( &( pBootstrap->endpoints.httpsEndpoint ),
+                                                               &( getIceServerConfigInfo ),
+                                                               pRequestBuffer );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseResponse( SignalingBootstrap_t * pBootstrap,
+                                        SignalingBootstrapStep_t step,
+                                        const char * pBody,
+                                        size_t bodyLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingChannelInfo_t channelInfo;
+    SignalingChannelArn_t channelArn = { 0 };
+    SignalingChannelEndpoints_t endpoints;
+    SignalingIceServer_t iceServers[ SIGNALING_BOOTSTRAP_MAX_ICE_SERVERS ];
+    size_t iceServerCount = SIGNALING_BOOTSTRAP_MAX_ICE_SERVERS;
+    size_t bufferUsed = pBootstrap->bufferUsed;
+
+    if( step == SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL )
+    {
+        memset( &( channelInfo ), 0, sizeof( SignalingChannelInfo_t ) );
+        result = Signaling_ParseDescribeSignalingChannelResponse( pBody, bodyLength, &( channelInfo ) );
+
+        /* The endpoints of a channel that is being created, updated or deleted can't be used. */
+        if( ( result == SIGNALING_RESULT_OK ) &&
+            ( ( channelInfo.pChannelStatus == NULL ) ||
+              ( channelInfo.channelStatusLength != strlen( SIGNALING_CHANNEL_STATUS_ACTIVE ) ) ||
+              ( strncmp( channelInfo.pChannelStatus, SIGNALING_CHANNEL_STATUS_ACTIVE, channelInfo.channelStatusLength ) != 0 ) ) )
+        {
+            result = SIGNALING_RESULT_CHANNEL_NOT_ACTIVE;
+        }
+
+        /* After a create, the ARN is already known. */
+        if( ( result == SIGNALING_RESULT_OK ) && ( pBootstrap->channelArn.pChannelArn == NULL ) )
+        {
+            channelArn = channelInfo.channelArn;
+        }
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL )
+    {
+        result = Signaling_ParseCreateSignalingChannelResponse( pBody, bodyLength, &( channelArn ) );
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT )
+    {
+        memset( &( endpoints ), 0, sizeof( SignalingChannelEndpoints_t ) );
+        result = Signaling_ParseGetSignalingChannelEndpointResponse( pBody, bodyLength, &( endpoints ) );
+
+        if( ( result == SIGNALING_RESULT_OK ) &&
+            ( ( endpoints.wssEndpoint.pEndpoint == NULL ) ||
+              ( ( pBootstrap->info.getIceServerConfig != 0U ) && ( endpoints.httpsEndpoint.pEndpoint == NULL ) ) ) )
+        {
+            result = SIGNALING_RESULT_INVALID_ENDPOINT;
+        }
+
+        if( result == SIGNALING_RESULT_OK )
+        {
+            result = CopyToBuffer( pBootstrap,
+                                   endpoints.wssEndpoint.pEndpoint,
+                                   endpoints.wssEndpoint.endpointLength,
+                                   &( pBootstrap->endpoints.wssEndpoint.pEndpoint ) );
+            pBootstrap->endpoints.wssEndpoint.endpointLength = endpoints.wssEndpoint.endpointLength;
+        }
+
+        if( ( result == SIGNALING_RESULT_OK ) && ( endpoints.httpsEndpoint.pEndpoint != NULL ) )
+        {
+            result = CopyToBuffer( pBootstrap,
+                                   endpoints.httpsEndpoint.pEndpoint,
+                                   endpoints.httpsEndpoint.endpointLength,
+                                   &( pBootstrap->endpoints.httpsEndpoint.pEndpoint ) );
+            pBootstrap->endpoints.httpsEndpoint.endpointLength = endpoints.httpsEndpoint.endpointLength;
+        }
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG )
+    {
+        result = Signaling_ParseGetIceServerConfigResponse( pBody,
+                                                            bodyLength,
+                                                            iceServers,
+                                                            &( iceServerCount ) );
+
+        /* The strings point into the response body, which the caller reuses. */
+        if( result == SIGNALING_RESULT_OK )
+        {
+            result = CopyIceServers( pBootstrap, iceServers, iceServerCount );
+        }
+
+        pBootstrap->iceServerCount = ( result == SIGNALING_RESULT_OK ) ? iceServerCount : 0U;
+    }
+    else
+    {
+        /* The websocket handshake has no body to parse. */
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) && ( channelArn.pChannelArn != NULL ) )
+    {
+        /* The ARN points into the response body, which the caller reuses. */
+        result = CopyToBuffer( pBootstrap,
+                               channelArn.pChannelArn,
+                               channelArn.channelArnLength,
+                               &( pBootstrap->channelArn.pChannelArn ) );
+        pBootstrap->channelArn.channelArnLength = channelArn.channelArnLength;
+    }
+
+    if( result != SIGNALING_RESULT_OK )
+    {
+        /* Nothing is kept from a response that failed, so that its retry starts over. */
+        pBootstrap->bufferUsed = bufferUsed;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateCompletion( SignalingBootstrap_t * pBootstrap )
+{
+    size_t i;
+
+    pBootstrap->isComplete = 1U;
+
+    for( i = 0; i < ( size_t ) SIGNALING_BOOTSTRAP_STEP_MAX; i++ )
+    {
+        if( ( pBootstrap->stepStates[ i ] != ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_DONE ) &&
+            ( pBootstrap->stepStates[ i ] != ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED ) )
+        {
+            pBootstrap->isComplete = 0U;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_BootstrapInit( SignalingBootstrap_t * pBootstrap,
+                                           const SignalingBootstrapInfo_t * pBootstrapInfo,
+                                           char * pBuffer,
+                                           size_t bufferLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( ( pBootstrap == NULL ) ||
+        ( pBootstrapInfo == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBootstrapInfo->awsRegion.pAwsRegion == NULL ) ||
+        ( ( pBootstrapInfo->channelArn.pChannelArn == NULL ) && ( pBootstrapInfo->channelName.pChannelName == NULL ) ) ||
+        ( ( pBootstrapInfo->role != SIGNALING_ROLE_MASTER ) && ( pBootstrapInfo->role != SIGNALING_ROLE_VIEWER ) ) ||
+        ( pBootstrapInfo->pClientId == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pBootstrap, 0, sizeof( SignalingBootstrap_t ) );
+        pBootstrap->info = *pBootstrapInfo;
+        pBootstrap->pBuffer = pBuffer;
+        pBootstrap->bufferLength = bufferLength;
+
+        if( pBootstrapInfo->channelArn.pChannelArn != NULL )
+        {
+            pBootstrap->channelArn = pBootstrapInfo->channelArn;
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED;
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED;
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+        }
+        else
+        {
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+        }
+
+        if( pBootstrapInfo->getIceServerConfig == 0U )
+        {
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_BootstrapNextRequest( SignalingBootstrap_t * pBootstrap,
+                                                  SignalingBootstrapStep_t * pStep,
+                                                  SignalingRequest_t * pRequestBuffer )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingBootstrapStep_t step = SIGNALING_BOOTSTRAP_STEP_NONE;
+    size_t i;
+
+    if( ( pBootstrap == NULL ) ||
+        ( pStep == NULL ) ||
+        ( pRequestBuffer == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        for( i = 0; ( i < ( size_t ) SIGNALING_BOOTSTRAP_STEP_MAX ) && ( step == SIGNALING_BOOTSTRAP_STEP_NONE ); i++ )
+        {
+            if( pBootstrap->stepStates[ i ] == ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY )
+            {
+                step = ( SignalingBootstrapStep_t ) i;
+            }
+        }
+
+        *pStep = step;
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) && ( step != SIGNALING_BOOTSTRAP_STEP_NONE ) )
+    {
+        result = ConstructRequest( pBootstrap, step, pRequestBuffer );
+
+        /* A size query leaves the call ready. */
+        if( ( result == SIGNALING_RESULT_OK ) && ( pRequestBuffer->pUrl != NULL ) )
+        {
+            pBootstrap->stepStates[ step ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_IN_FLIGHT;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_BootstrapFeedResponse( SignalingBootstrap_t * pBootstrap,
+                                                   SignalingBootstrapStep_t step,
+                                                   uint16_t statusCode,
+                                                   const char * pBody,
+                                                   size_t bodyLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint8_t isNotFound = 0U;
+
+    if( ( pBootstrap == NULL ) ||
+        ( step >= SIGNALING_BOOTSTRAP_STEP_MAX ) ||
+        ( pBootstrap->stepStates[ step ] != ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_IN_FLIGHT ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS )
+    {
+        if( ( statusCode != SIGNALING_HTTP_STATUS_SWITCHING_PROTOCOLS ) && !SIGNALING_IS_HTTP_SUCCESS( statusCode ) )
+        {
+            result = SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS;
+        }
+    }
+    else if( ( step == SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ) &&
+             ( statusCode == SIGNALING_HTTP_STATUS_NOT_FOUND ) &&
+             ( pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] == ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_DONE ) )
+    {
+        /* The channel that was just created is not visible yet. */
+        result = SIGNALING_RESULT_CHANNEL_NOT_ACTIVE;
+    }
+    else if( ( step == SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ) &&
+             ( statusCode == SIGNALING_HTTP_STATUS_NOT_FOUND ) &&
+             ( pBootstrap->info.createChannel != 0U ) )
+    {
+        isNotFound = 1U;
+    }
+    else if( !SIGNALING_IS_HTTP_SUCCESS( statusCode ) )
+    {
+        result = SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS;
+    }
+    else
+    {
+        result = ParseResponse( pBootstrap, step, pBody, bodyLength );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        pBootstrap->stepStates[ step ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_DONE;
+
+        if( step == SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL )
+        {
+            if( isNotFound != 0U )
+            {
+                pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+            }
+            else
+            {
+                if( pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] != ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_DONE )
+                {
+                    pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED;
+                }
+
+                pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+            }
+        }
+        else if( step == SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL )
+        {
+            /* A new channel is CREATING, describe it until it is ACTIVE. */
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+        }
+        else if( step == SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT )
+        {
+            /* Both need the endpoints only, they are sent without waiting for each other. */
+            pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+
+            if( pBootstrap->info.getIceServerConfig != 0U )
+            {
+                pBootstrap->stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+            }
+        }
+        else
+        {
+            /* Nothing depends on the other calls. */
+        }
+
+        UpdateCompletion( pBootstrap );
+    }
+    else if( result != SIGNALING_RESULT_BAD_PARAM )
+    {
+        pBootstrap->stepStates[ step ] = ( uint8_t ) SIGNALING_BOOTSTRAP_STEP_STATE_READY;
+    }
+    else
+    {
+        /* Empty else marker. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,454 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_channel_manager.h"
+
+/* States of a slot. */
+#define SLOT_STATE_FREE            ( 0U )
+#define SLOT_STATE_USED            ( 1U )
+
+/* Number of ':' before the resource of an ARN. */
+#define ARN_RESOURCE_COLON_COUNT   ( 5U )
+
+#define ARN_RESOURCE_TYPE_CHANNEL  "channel/"
+
+/* FNV-1a. */
+#define FNV_OFFSET_BASIS           ( 2166136261U )
+#define FNV_PRIME                  ( 16777619U )
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t GetChannelName( const SignalingChannelArn_t * pChannelArn,
+                                         SignalingChannelName_t * pChannelName );
+
+static uint32_t HashChannelName( const SignalingChannelName_t * pChannelName );
+
+static SignalingResult_t LocateChannel( const SignalingChannelManager_t * pManager,
+                                        const SignalingChannelArn_t * pChannelArn,
+                                        const SignalingChannelName_t * pChannelName,
+                                        uint32_t * pNameHash,
+                                        SignalingManagedChannel_t ** ppChannel,
+                                        SignalingManagedChannel_t ** ppFreeSlot );
+
+/*-----------------------------------------------------------*/
+
+/* The name of arn:partition:kinesisvideo:region:account:channel/name/creation-time. */
+static SignalingResult_t GetChannelName( const SignalingChannelArn_t * pChannelArn,
+                                         SignalingChannelName_t * pChannelName )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    const char * pArn = pChannelArn->pChannelArn;
+    size_t arnLength = pChannelArn->channelArnLength;
+    size_t i = 0, colonCount = 0, nameStart;
+
+    while( ( i < arnLength ) && ( colonCount < ARN_RESOURCE_COLON_COUNT ) )
+    {
+        if( pArn[ i ] == ':' )
+        {
+            colonCount++;
+        }
+
+        i++;
+    }
+
+    if( ( colonCount < ARN_RESOURCE_COLON_COUNT ) ||
+        ( ( arnLength - i ) < strlen( ARN_RESOURCE_TYPE_CHANNEL ) ) ||
+        ( strncmp( &( pArn[ i ] ), ARN_RESOURCE_TYPE_CHANNEL, strlen( ARN_RESOURCE_TYPE_CHANNEL ) ) != 0 ) )
+    {
+        result = SIGNALING_RESULT_INVALID_CHANNEL_NAME;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        nameStart = i + strlen( ARN_RESOURCE_TYPE_CHANNEL );
+        i = nameStart;
+
+        while( ( i < arnLength ) && ( pArn[ i ] != '/' ) )
+        {
+            i++;
+        }
+
+        if( i == nameStart )
+        {
+            result = SIGNALING_RESULT_INVALID_CHANNEL_NAME;
+        }
+        else
+        {
+            pChannelName->pChannelName = &( pArn[ nameStart ] );
+            pChannelName->channelNameLength = i - nameStart;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t HashChannelName( const SignalingChannelName_t * pChannelName )
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    size_t i;
+
+    for( i = 0; i < pChannelName->channelNameLength; i++ )
+    {
+        hash ^= ( uint32_t ) ( uint8_t ) pChannelName->pChannelName[ i ];
+        hash *= FNV_PRIME;
+    }
+
+    /* The last bytes of FNV-1a barely reach the top bits, which pick the shard, so mix
+     * them down with the MurmurHash3 finalizer. */
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Probe the shard of the channel. If the channel is not found, ppFreeSlot is set to the slot
+ * it would be added to, or NULL if the probe sequence went through the whole shard. */
+static SignalingResult_t LocateChannel( const SignalingChannelManager_t * pManager,
+                                        const SignalingChannelArn_t * pChannelArn,
+                                        const SignalingChannelName_t * pChannelName,
+                                        uint32_t * pNameHash,
+                                        SignalingManagedChannel_t ** ppChannel,
+                                        SignalingManagedChannel_t ** ppFreeSlot )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingChannelName_t channelName;
+    const SignalingChannelShard_t * pShard = NULL;
+    SignalingManagedChannel_t * pSlot;
+    size_t shardIndex = 0, slotIndex = 0, i;
+    uint32_t nameHash = 0;
+    uint8_t isEndOfProbe = 0U;
+
+    *ppChannel = NULL;
+    *ppFreeSlot = NULL;
+
+    if( pChannelArn != NULL )
+    {
+        result = GetChannelName( pChannelArn, &( channelName ) );
+    }
+    else
+    {
+        channelName = *pChannelName;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        nameHash = HashChannelName( &( channelName ) );
+        result = Signaling_ChannelManagerShardOf( pManager, NULL, &( channelName ), &( shardIndex ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        pShard = &( pManager->shards[ shardIndex ] );
+        slotIndex = nameHash & ( pShard->slotCount - 1U );
+
+        for( i = 0; ( i < pShard->slotCount ) && ( isEndOfProbe == 0U ); i++ )
+        {
+            pSlot = &( pShard->pSlots[ slotIndex ] );
+
+            if( pSlot->slotState == SLOT_STATE_FREE )
+            {
+                *ppFreeSlot = pSlot;
+                isEndOfProbe = 1U;
+            }
+            else if( ( pSlot->nameHash == nameHash ) &&
+                     ( ( ( pChannelArn != NULL ) &&
+                         ( pSlot->channelArn.channelArnLength == pChannelArn->channelArnLength ) &&
+                         ( memcmp( pSlot->channelArn.pChannelArn, pChannelArn->pChannelArn, pChannelArn->channelArnLength ) == 0 ) ) ||
+                       ( ( pChannelArn == NULL ) &&
+                         ( pSlot->channelName.channelNameLength == channelName.channelNameLength ) &&
+                         ( memcmp( pSlot->channelName.pChannelName, channelName.pChannelName, channelName.channelNameLength ) == 0 ) ) ) )
+            {
+                *ppChannel = pSlot;
+                isEndOfProbe = 1U;
+            }
+            else
+            {
+                /* Empty on purpose. */
+            }
+
+            slotIndex = ( slotIndex + 1U ) & ( pShard->slotCount - 1U );
+        }
+
+        if( *ppChannel == NULL )
+        {
+            result = SIGNALING_RESULT_CHANNEL_NOT_FOUND;
+        }
+
+        *pNameHash = nameHash;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ChannelManagerInit( SignalingChannelManager_t * pManager,
+                                                SignalingManagedChannel_t * pSlots,
+                                                size_t slotCount,
+                                                size_t shardCount )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t shardSlotCount = 1U, i;
+
+    if( ( pManager == NULL ) ||
+        ( pSlots == NULL ) ||
+        ( shardCount == 0U ) ||
+        ( shardCount > SIGNALING_CHANNEL_MANAGER_MAX_SHARDS ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( slotCount < shardCount )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+    else
+    {
+        /* Empty on purpose. */
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        while( shardSlotCount <= ( ( slotCount / shardCount ) / 2U ) )
+        {
+            shardSlotCount *= 2U;
+        }
+
+        memset( pManager, 0, sizeof( SignalingChannelManager_t ) );
+        memset( pSlots, 0, shardSlotCount * shardCount * sizeof( SignalingManagedChannel_t ) );
+        pManager->shardCount = shardCount;
+
+        for( i = 0; i < shardCount; i++ )
+        {
+            pManager->shards[ i ].pSlots = &( pSlots[ i * shardSlotCount ] );
+            pManager->shards[ i ].slotCount = shardSlotCount;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ChannelManagerShardOf( const SignalingChannelManager_t * pManager,
+                                                   const SignalingChannelArn_t * pChannelArn,
+                                                   const SignalingChannelName_t * pChannelName,
+                                                   size_t * pShardIndex )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingChannelName_t channelName;
+
+    if( ( pManager == NULL ) ||
+        ( pShardIndex == NULL ) ||
+        ( ( pChannelArn != NULL ) && ( pChannelArn->pChannelArn == NULL ) ) ||
+        ( ( pChannelArn == NULL ) && ( ( pChannelName == NULL ) || ( pChannelName->pChannelName == NULL ) ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( pChannelArn != NULL )
+    {
+        result = GetChannelName( pChannelArn, &( channelName ) );
+    }
+    else
+    {
+        channelName = *pChannelName;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        /* The top bits pick the shard, the bottom ones the slot within the shard. */
+        *pShardIndex = ( size_t ) ( ( ( uint64_t ) HashChannelName( &( channelName ) ) * pManager->shardCount ) >> 32 );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ChannelManagerAdd( SignalingChannelManager_t * pManager,
+                                               const SignalingChannelArn_t * pChannelArn,
+                                               void * pUserData,
+                                               SignalingManagedChannel_t ** ppChannel )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingManagedChannel_t * pChannel = NULL, * pFreeSlot = NULL;
+    SignalingChannelShard_t * pShard;
+    size_t shardIndex = 0;
+    uint32_t nameHash = 0;
+
+    if( ( pManager == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) ||
+        ( ppChannel == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = LocateChannel( pManager, pChannelArn, NULL, &( nameHash ), &( pChannel ), &( pFreeSlot ) );
+    }
+
+    if( result == SIGNALING_RESULT_CHANNEL_NOT_FOUND )
+    {
+        ( void ) Signaling_ChannelManagerShardOf( pManager, pChannelArn, NULL, &( shardIndex ) );
+        pShard = &( pManager->shards[ shardIndex ] );
+
+        /* Keep a quarter of the slots free, rounded up, so that probe sequences stay short
+         * and always end on a free slot, even in the smallest shards. */
+        if( ( pFreeSlot == NULL ) ||
+            ( ( pShard->channelCount + 1U ) > ( pShard->slotCount - ( ( pShard->slotCount + 3U ) / 4U ) ) ) )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            pChannel = pFreeSlot;
+            memset( pChannel, 0, sizeof( SignalingManagedChannel_t ) );
+            pChannel->nameHash = nameHash;
+            pChannel->slotState = SLOT_STATE_USED;
+            pChannel->channelArn = *pChannelArn;
+            ( void ) GetChannelName( pChannelArn, &( pChannel->channelName ) );
+            pChannel->pUserData = pUserData;
+            pShard->channelCount++;
+            result = SIGNALING_RESULT_OK;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *ppChannel = pChannel;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ChannelManagerRemove( SignalingChannelManager_t * pManager,
+                                                  const SignalingChannelArn_t * pChannelArn )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingManagedChannel_t * pChannel = NULL, * pFreeSlot = NULL;
+    SignalingChannelShard_t * pShard;
+    size_t shardIndex = 0, slotIndex, nextSlotIndex, mask, i;
+    uint32_t nameHash = 0;
+
+    if( ( pManager == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = LocateChannel( pManager, pChannelArn, NULL, &( nameHash ), &( pChannel ), &( pFreeSlot ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        ( void ) Signaling_ChannelManagerShardOf( pManager, pChannelArn, NULL, &( shardIndex ) );
+        pShard = &( pManager->shards[ shardIndex ] );
+        mask = pShard->slotCount - 1U;
+        slotIndex = ( size_t ) ( pChannel - pShard->pSlots );
+        nextSlotIndex = ( slotIndex + 1U ) & mask;
+        pShard->channelCount--;
+
+        /* Shift back the channels that follow in the probe sequence into the hole, unless
+         * their home slot is after it, so that no tombstone is left behind. The load limit
+         * keeps a free slot to end the sequence, the slot count bounds it regardless. */
+        for( i = 1U; ( i < pShard->slotCount ) && ( pShard->pSlots[ nextSlotIndex ].slotState == SLOT_STATE_USED ); i++ )
+        {
+            if( ( ( nextSlotIndex - ( pShard->pSlots[ nextSlotIndex ].nameHash & mask ) ) & mask ) >=
+                ( ( nextSlotIndex - slotIndex ) & mask ) )
+            {
+                pShard->pSlots[ slotIndex ] = pShard->pSlots[ nextSlotIndex ];
+                slotIndex = nextSlotIndex;
+            }
+
+            nextSlotIndex = ( nextSlotIndex + 1U ) & mask;
+        }
+
+        memset( &( pShard->pSlots[ slotIndex ] ), 0, sizeof( SignalingManagedChannel_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ChannelManagerFind( const SignalingChannelManager_t * pManager,
+                                                const SignalingChannelArn_t * pChannelArn,
+                                                const SignalingChannelName_t * pChannelName,
+                                                SignalingManagedChannel_t ** ppChannel )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingManagedChannel_t * pChannel = NULL, * pFreeSlot = NULL;
+    uint32_t nameHash = 0;
+
+    if( ( pManager == NULL ) ||
+        ( ppChannel == NULL ) ||
+        ( ( pChannelArn != NULL ) && ( pChannelArn->pChannelArn == NULL ) ) ||
+        ( ( pChannelArn == NULL ) && ( ( pChannelName == NULL ) || ( pChannelName->pChannelName == NULL ) ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = LocateChannel( pManager, pChannelArn, pChannelName, &( nameHash ), &( pChannel ), &( pFreeSlot ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *ppChannel = pChannel;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ChannelManagerRouteMessage( SignalingChannelManager_t * pManager,
+                                                        const SignalingChannelArn_t * pChannelArn,
+                                                        const WssRecvMessage_t * pWssRecvMessage,
+                                                        SignalingManagedChannel_t ** ppChannel )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingManagedChannel_t * pChannel = NULL;
+
+    if( ( pManager == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pWssRecvMessage == NULL ) ||
+        ( ppChannel == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = Signaling_ChannelManagerFind( pManager, pChannelArn, NULL, &( pChannel ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        if( pWssRecvMessage->messageType == SIGNALING_TYPE_MESSAGE_RECONNECT_ICE_SERVER )
+        {
+            pChannel->isIceServerConfigStale = 1U;
+        }
+
+        *ppChannel = pChannel;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,380 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_credentials.h"
+
+/* Length of YYYY-MM-DDThh:mm:ss. */
+#define ISO8601_DATE_TIME_LENGTH    ( 19U )
+
+/* Length of a +hh:mm offset. */
+#define ISO8601_OFFSET_LENGTH       ( 6U )
+
+/* Days from 0000-03-01 to 1970-01-01 in the proleptic Gregorian calendar. */
+#define DAYS_TO_UNIX_EPOCH          ( 719468U )
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseDigits( const char * pDigits,
+                                      size_t digitsLength,
+                                      uint32_t maxValue,
+                                      uint32_t * pValue );
+
+static uint64_t DaysFromCivil( uint32_t year,
+                               uint32_t month,
+                               uint32_t day );
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseDigits( const char * pDigits,
+                                      size_t digitsLength,
+                                      uint32_t maxValue,
+                                      uint32_t * pValue )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint32_t value = 0U;
+    size_t i;
+
+    for( i = 0; ( result == SIGNALING_RESULT_OK ) && ( i < digitsLength ); i++ )
+    {
+        if( ( pDigits[ i ] < '0' ) || ( pDigits[ i ] > '9' ) )
+        {
+            result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+        }
+        else
+        {
+            value = ( value * 10U ) + ( uint32_t ) ( pDigits[ i ] - '0' );
+        }
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) && ( value > maxValue ) )
+    {
+        result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *pValue = value;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Days since 1970-01-01, for years from 1970 on. The year starts in March, so that the
+ * leap day is the last day of the year. */
+static uint64_t DaysFromCivil( uint32_t year,
+                               uint32_t month,
+                               uint32_t day )
+{
+    uint32_t shiftedYear = ( month <= 2U ) ? ( year - 1U ) : year;
+    uint32_t era = shiftedYear / 400U;
+    uint32_t yearOfEra = shiftedYear - ( era * 400U );
+    uint32_t dayOfYear = ( ( ( 153U * ( ( month > 2U ) ? ( month - 3U ) : ( month + 9U ) ) ) + 2U ) / 5U ) + day - 1U;
+    uint32_t dayOfEra = ( yearOfEra * 365U ) + ( yearOfEra / 4U ) - ( yearOfEra / 100U ) + dayOfYear;
+
+    return ( ( uint64_t ) era * 146097U ) + dayOfEra - DAYS_TO_UNIX_EPOCH;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_ParseIso8601Time( const char * pTime,
+                                              size_t timeLength,
+                                              uint64_t * pEpochSeconds )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    static const uint8_t daysInMonth[ 12 ] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    uint32_t year = 0U, month = 0U, day = 0U, hour = 0U, minute = 0U, second = 0U;
+    uint32_t offsetHour = 0U, offsetMinute = 0U;
+    uint64_t epochSeconds = 0U, offsetSeconds = 0U;
+    size_t i = ISO8601_DATE_TIME_LENGTH;
+
+    if( ( pTime == NULL ) ||
+        ( pEpochSeconds == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( ( timeLength <= ISO8601_DATE_TIME_LENGTH ) ||
+             ( pTime[ 4 ] != '-' ) ||
+             ( pTime[ 7 ] != '-' ) ||
+             ( ( pTime[ 10 ] != 'T' ) && ( pTime[ 10 ] != 't' ) ) ||
+             ( pTime[ 13 ] != ':' ) ||
+             ( pTime[ 16 ] != ':' ) )
+    {
+        result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+    }
+    else
+    {
+        /* Empty on purpose. */
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ParseDigits( &( pTime[ 0 ] ), 4U, 9999U, &( year ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ParseDigits( &( pTime[ 5 ] ), 2U, 12U, &( month ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ParseDigits( &( pTime[ 8 ] ), 2U, 31U, &( day ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ParseDigits( &( pTime[ 11 ] ), 2U, 23U, &( hour ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = ParseDigits( &( pTime[ 14 ] ), 2U, 59U, &( minute ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        /* 60 is a leap second. */
+        result = ParseDigits( &( pTime[ 17 ] ), 2U, 60U, &( second ) );
+    }
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( year < 1970U ) ||
+          ( month == 0U ) ||
+          ( day == 0U ) ||
+          ( day > daysInMonth[ month - 1U ] ) ||
+          ( ( month == 2U ) && ( day == 29U ) &&
+            ( ( ( year % 4U ) != 0U ) || ( ( ( year % 100U ) == 0U ) && ( ( year % 400U ) != 0U ) ) ) ) ) )
+    {
+        result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+    }
+
+    /* Fractional seconds are ignored. */
+    if( ( result == SIGNALING_RESULT_OK ) && ( pTime[ i ] == '.' ) )
+    {
+        i++;
+
+        if( ( i == timeLength ) || ( pTime[ i ] < '0' ) || ( pTime[ i ] > '9' ) )
+        {
+            result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+        }
+
+        while( ( i < timeLength ) && ( pTime[ i ] >= '0' ) && ( pTime[ i ] <= '9' ) )
+        {
+            i++;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        if( ( i + 1U == timeLength ) && ( ( pTime[ i ] == 'Z' ) || ( pTime[ i ] == 'z' ) ) )
+        {
+            /* UTC. */
+        }
+        else if( ( i + ISO8601_OFFSET_LENGTH == timeLength ) &&
+                 ( ( pTime[ i ] == '+' ) || ( pTime[ i ] == '-' ) ) &&
+                 ( pTime[ i + 3U ] == ':' ) )
+        {
+            result = ParseDigits( &( pTime[ i + 1U ] ), 2U, 23U, &( offsetHour ) );
+
+            if( result == SIGNALING_RESULT_OK )
+            {
+                result = ParseDigits( &( pTime[ i + 4U ] ), 2U, 59U, &( offsetMinute ) );
+            }
+
+            offsetSeconds = ( ( uint64_t ) offsetHour * 3600U ) + ( ( uint64_t ) offsetMinute * 60U );
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        epochSeconds = ( DaysFromCivil( year, month, day ) * 86400U ) +
+                       ( ( uint64_t ) hour * 3600U ) +
+                       ( ( uint64_t ) minute * 60U ) +
+                       second;
+
+        /* The local time is ahead of UTC by a positive offset. */
+        if( pTime[ i ] == '-' )
+        {
+            epochSeconds += offsetSeconds;
+        }
+        else if( epochSeconds >= offsetSeconds )
+        {
+            epochSeconds -= offsetSeconds;
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *pEpochSeconds = epochSeconds;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_CredentialHolderInit( SignalingCredentialHolder_t * pHolder,
+                                                  uint32_t refreshMarginSeconds )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pHolder == NULL )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pHolder, 0, sizeof( SignalingCredentialHolder_t ) );
+        pHolder->refreshMarginSeconds = refreshMarginSeconds;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_CredentialHolderUpdate( SignalingCredentialHolder_t * pHolder,
+                                                    const SignalingCredential_t * pCredential )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint64_t expirationSeconds = 0U;
+
+    if( ( pHolder == NULL ) ||
+        ( pCredential == NULL ) ||
+        ( pCredential->pAccessKeyId == NULL ) ||
+        ( pCredential->pSecretAccessKey == NULL ) ||
+        ( ( pCredential->pSessionToken == NULL ) && ( pCredential->sessionTokenLength > 0U ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( pCredential->accessKeyIdLength > ACCESS_KEY_MAX_LEN )
+    {
+        result = SIGNALING_RESULT_ACCESS_KEY_LENGTH_TOO_LARGE;
+    }
+    else if( pCredential->secretAccessKeyLength > SECRET_ACCESS_KEY_MAX_LEN )
+    {
+        result = SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE;
+    }
+    else if( pCredential->sessionTokenLength > SESSION_TOKEN_MAX_LEN )
+    {
+        result = SIGNALING_RESULT_SESSION_TOKEN_LENGTH_TOO_LARGE;
+    }
+    else
+    {
+        /* Empty on purpose. */
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = Signaling_ParseIso8601Time( pCredential->pExpiration,
+                                             pCredential->expirationLength,
+                                             &( expirationSeconds ) );
+
+        if( result == SIGNALING_RESULT_BAD_PARAM )
+        {
+            result = SIGNALING_RESULT_INVALID_TIMESTAMP;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        /* An odd sequence tells readers that an update is in progress. */
+        pHolder->sequence++;
+        SIGNALING_MEMORY_BARRIER();
+
+        memcpy( pHolder->credential.accessKeyId, pCredential->pAccessKeyId, pCredential->accessKeyIdLength );
+        pHolder->credential.accessKeyIdLength = pCredential->accessKeyIdLength;
+        memcpy( pHolder->credential.secretAccessKey, pCredential->pSecretAccessKey, pCredential->secretAccessKeyLength );
+        pHolder->credential.secretAccessKeyLength = pCredential->secretAccessKeyLength;
+
+        if( pCredential->sessionTokenLength > 0U )
+        {
+            memcpy( pHolder->credential.sessionToken, pCredential->pSessionToken, pCredential->sessionTokenLength );
+        }
+
+        pHolder->credential.sessionTokenLength = pCredential->sessionTokenLength;
+        pHolder->credential.expirationSeconds = expirationSeconds;
+
+        SIGNALING_MEMORY_BARRIER();
+        pHolder->sequence++;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_CredentialHolderGet( const SignalingCredentialHolder_t * pHolder,
+                                                 uint64_t currentTimeSeconds,
+                                                 SignalingCredentialCopy_t * pCopy,
+                                                 SignalingCredential_t * pCredential,
+                                                 uint64_t * pSecondsToExpiry,
+                                                 uint8_t * pShouldRefresh )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint32_t sequence = 1U;
+
+    if( ( pHolder == NULL ) ||
+        ( pCopy == NULL ) ||
+        ( pCredential == NULL ) ||
+        ( pSecondsToExpiry == NULL ) ||
+        ( pShouldRefresh == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        /* Retry until no update started or completed during the copy. The lengths of a torn
+         * copy are never used, as it is discarded. */
+        do
+        {
+            sequence = pHolder->sequence;
+            SIGNALING_MEMORY_BARRIER();
+
+            if( ( sequence & 1U ) == 0U )
+            {
+                memcpy( pCopy, &( pHolder->credential ), sizeof( SignalingCredentialCopy_t ) );
+            }
+
+            SIGNALING_MEMORY_BARRIER();
+        } while( ( ( sequence & 1U ) != 0U ) || ( sequence != pHolder->sequence ) );
+
+        pCredential->pAccessKeyId = pCopy->accessKeyId;
+        pCredential->accessKeyIdLength = pCopy->accessKeyIdLength;
+        pCredential->pSecretAccessKey = pCopy->secretAccessKey;
+        pCredential->secretAccessKeyLength = pCopy->secretAccessKeyLength;
+        pCredential->pSessionToken = pCopy->sessionToken;
+        pCredential->sessionTokenLength = pCopy->sessionTokenLength;
+        pCredential->pExpiration = NULL;
+        pCredential->expirationLength = 0U;
+
+        if( currentTimeSeconds >= pCopy->expirationSeconds )
+        {
+            *pSecondsToExpiry = 0U;
+            result = SIGNALING_RESULT_CREDENTIAL_EXPIRED;
+        }
+        else
+        {
+            *pSecondsToExpiry = pCopy->expirationSeconds - currentTimeSeconds;
+        }
+
+        *pShouldRefresh = ( *pSecondsToExpiry <= pHolder->refreshMarginSeconds ) ? 1U : 0U;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
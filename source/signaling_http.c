@@ -0,0 +1,701 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_http.h"
+#include "signaling_internal.h"
+
+#define SIGNALING_HTTP_VERSION_PREFIX           "HTTP/1."
+#define SIGNALING_HTTP_CHUNKED                  "chunked"
+
+#define SIGNALING_HTTP_TO_LOWER( c )            ( ( ( ( c ) >= 'A' ) && ( ( c ) <= 'Z' ) ) ? ( char ) ( ( c ) - 'A' + 'a' ) : ( c ) )
+#define SIGNALING_HTTP_IS_DIGIT( c )            ( ( ( c ) >= '0' ) && ( ( c ) <= '9' ) )
+#define SIGNALING_HTTP_IS_SPACE( c )            ( ( ( c ) == ' ' ) || ( ( c ) == '\t' ) )
+
+/* Where the parser is in the response. The status line, the headers and the
+ * chunked framing are parsed one byte at a time, the body is moved in spans. */
+typedef enum HttpState
+{
+    HTTP_STATE_STATUS_VERSION = 0,
+    HTTP_STATE_STATUS_CODE,
+    HTTP_STATE_STATUS_REASON,
+    HTTP_STATE_HEADER_LINE_START,
+    HTTP_STATE_HEADER_NAME,
+    HTTP_STATE_HEADER_VALUE_START,
+    HTTP_STATE_HEADER_VALUE,
+    HTTP_STATE_HEADERS_END,
+    HTTP_STATE_BODY_LENGTH,
+    HTTP_STATE_BODY_UNTIL_CLOSE,
+    HTTP_STATE_CHUNK_SIZE,
+    HTTP_STATE_CHUNK_EXTENSION,
+    HTTP_STATE_CHUNK_DATA,
+    HTTP_STATE_CHUNK_DATA_END,
+    HTTP_STATE_TRAILER_LINE_START,
+    HTTP_STATE_TRAILER,
+    HTTP_STATE_TRAILERS_END,
+    HTTP_STATE_COMPLETE,
+    HTTP_STATE_INVALID,
+} HttpState_t;
+
+/* The headers the parser looks at. */
+typedef enum HttpHeader
+{
+    HTTP_HEADER_OTHER = 0,
+    HTTP_HEADER_CONTENT_LENGTH,
+    HTTP_HEADER_TRANSFER_ENCODING,
+    HTTP_HEADER_ERROR_TYPE,
+} HttpHeader_t;
+
+/*-----------------------------------------------------------*/
+
+static void ResetResponse( SignalingHttpResponse_t * pResponse );
+
+static SignalingResult_t ParseStatusByte( SignalingHttpResponse_t * pResponse,
+                                          char c );
+
+static SignalingResult_t ParseHeaderByte( SignalingHttpResponse_t * pResponse,
+                                          char c );
+
+static SignalingResult_t ParseHeaderName( SignalingHttpResponse_t * pResponse );
+
+static SignalingResult_t ParseHeaderValueByte( SignalingHttpResponse_t * pResponse,
+                                               char c );
+
+static SignalingResult_t ParseHeaderValueEnd( SignalingHttpResponse_t * pResponse );
+
+static void ParseHeadersEnd( SignalingHttpResponse_t * pResponse );
+
+static SignalingResult_t ParseChunkByte( SignalingHttpResponse_t * pResponse,
+                                         char c );
+
+/*-----------------------------------------------------------*/
+
+static void ResetResponse( SignalingHttpResponse_t * pResponse )
+{
+    memset( pResponse, 0, sizeof( SignalingHttpResponse_t ) );
+    pResponse->state = ( uint8_t ) HTTP_STATE_STATUS_VERSION;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseStatusByte( SignalingHttpResponse_t * pResponse,
+                                          char c )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pResponse->state == ( uint8_t ) HTTP_STATE_STATUS_VERSION )
+    {
+        /* "HTTP/1." followed by the minor version and a space. */
+        if( pResponse->index < SIGNALING_LITERAL_LENGTH( SIGNALING_HTTP_VERSION_PREFIX ) )
+        {
+            if( c != SIGNALING_HTTP_VERSION_PREFIX[ pResponse->index ] )
+            {
+                result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+            }
+        }
+        else if( pResponse->index == SIGNALING_LITERAL_LENGTH( SIGNALING_HTTP_VERSION_PREFIX ) )
+        {
+            if( !SIGNALING_HTTP_IS_DIGIT( c ) )
+            {
+                result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+            }
+        }
+        else if( c == ' ' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_STATUS_CODE;
+            pResponse->index = 0U;
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+
+        if( pResponse->state == ( uint8_t ) HTTP_STATE_STATUS_VERSION )
+        {
+            pResponse->index++;
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_STATUS_CODE )
+    {
+        if( pResponse->index < 3U )
+        {
+            if( SIGNALING_HTTP_IS_DIGIT( c ) )
+            {
+                pResponse->statusCode = ( uint16_t ) ( ( pResponse->statusCode * 10U ) + ( uint16_t ) ( c - '0' ) );
+                pResponse->index++;
+            }
+            else
+            {
+                result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+            }
+        }
+        else if( pResponse->statusCode < 100U )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else if( c == '\n' )
+        {
+            /* The reason phrase is optional. */
+            pResponse->state = ( uint8_t ) HTTP_STATE_HEADER_LINE_START;
+        }
+        else if( ( c == ' ' ) || ( c == '\r' ) )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_STATUS_REASON;
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+    }
+    else
+    {
+        if( c == '\n' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_HEADER_LINE_START;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseHeaderByte( SignalingHttpResponse_t * pResponse,
+                                          char c )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pResponse->state == ( uint8_t ) HTTP_STATE_HEADER_LINE_START )
+    {
+        if( c == '\r' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_HEADERS_END;
+        }
+        else if( c == '\n' )
+        {
+            ParseHeadersEnd( pResponse );
+        }
+        else if( SIGNALING_HTTP_IS_SPACE( c ) || ( c == ':' ) )
+        {
+            /* Obsolete line folding, or an empty header name. */
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_HEADER_NAME;
+            pResponse->headerName[ 0 ] = SIGNALING_HTTP_TO_LOWER( c );
+            pResponse->headerNameLength = 1U;
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_HEADER_NAME )
+    {
+        if( c == ':' )
+        {
+            result = ParseHeaderName( pResponse );
+        }
+        else if( SIGNALING_HTTP_IS_SPACE( c ) || ( c == '\r' ) || ( c == '\n' ) )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            /* Names longer than the buffer are only counted, they are not one of
+             * the names the parser looks at anyway. */
+            if( pResponse->headerNameLength < SIGNALING_HTTP_MAX_HEADER_NAME_LENGTH )
+            {
+                pResponse->headerName[ pResponse->headerNameLength ] = SIGNALING_HTTP_TO_LOWER( c );
+            }
+
+            if( pResponse->headerNameLength <= SIGNALING_HTTP_MAX_HEADER_NAME_LENGTH )
+            {
+                pResponse->headerNameLength++;
+            }
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_HEADERS_END )
+    {
+        if( c == '\n' )
+        {
+            ParseHeadersEnd( pResponse );
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+    }
+    else
+    {
+        if( c == '\n' )
+        {
+            result = ParseHeaderValueEnd( pResponse );
+            pResponse->state = ( uint8_t ) HTTP_STATE_HEADER_LINE_START;
+        }
+        else if( c == '\r' )
+        {
+            /* Nothing to do, the line ends with the line feed. */
+        }
+        else if( ( pResponse->state == ( uint8_t ) HTTP_STATE_HEADER_VALUE_START ) && SIGNALING_HTTP_IS_SPACE( c ) )
+        {
+            /* Skip the spaces before the value. */
+        }
+        else
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_HEADER_VALUE;
+            result = ParseHeaderValueByte( pResponse, c );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseHeaderName( SignalingHttpResponse_t * pResponse )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    const char * pName = pResponse->headerName;
+    size_t nameLength = pResponse->headerNameLength;
+
+    pResponse->header = ( uint8_t ) HTTP_HEADER_OTHER;
+
+    if( ( nameLength == SIGNALING_LITERAL_LENGTH( "content-length" ) ) &&
+        ( strncmp( pName, "content-length", nameLength ) == 0 ) )
+    {
+        /* Duplicate lengths could disagree. */
+        if( pResponse->hasContentLength != 0U )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            pResponse->header = ( uint8_t ) HTTP_HEADER_CONTENT_LENGTH;
+            pResponse->hasContentLength = 1U;
+            pResponse->remainingLength = 0U;
+        }
+    }
+    else if( ( nameLength == SIGNALING_LITERAL_LENGTH( "transfer-encoding" ) ) &&
+             ( strncmp( pName, "transfer-encoding", nameLength ) == 0 ) )
+    {
+        pResponse->header = ( uint8_t ) HTTP_HEADER_TRANSFER_ENCODING;
+    }
+    else if( ( nameLength == SIGNALING_LITERAL_LENGTH( "x-amzn-errortype" ) ) &&
+             ( strncmp( pName, "x-amzn-errortype", nameLength ) == 0 ) )
+    {
+        pResponse->header = ( uint8_t ) HTTP_HEADER_ERROR_TYPE;
+        pResponse->errorTypeLength = 0U;
+    }
+    else
+    {
+        /* Not a header the parser looks at. */
+    }
+
+    pResponse->state = ( uint8_t ) HTTP_STATE_HEADER_VALUE_START;
+    pResponse->index = 0U;
+    pResponse->isValueTrimmed = 0U;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseHeaderValueByte( SignalingHttpResponse_t * pResponse,
+                                               char c )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pResponse->header == ( uint8_t ) HTTP_HEADER_CONTENT_LENGTH )
+    {
+        if( SIGNALING_HTTP_IS_SPACE( c ) )
+        {
+            pResponse->isValueTrimmed = 1U;
+        }
+        else if( !SIGNALING_HTTP_IS_DIGIT( c ) || ( pResponse->isValueTrimmed != 0U ) ||
+                 ( pResponse->remainingLength > ( ( SIZE_MAX - 9U ) / 10U ) ) )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            pResponse->remainingLength = ( pResponse->remainingLength * 10U ) + ( size_t ) ( c - '0' );
+            pResponse->index++;
+        }
+    }
+    else if( pResponse->header == ( uint8_t ) HTTP_HEADER_TRANSFER_ENCODING )
+    {
+        /* Only the chunked coding is supported, the requests never ask for another one. */
+        if( SIGNALING_HTTP_IS_SPACE( c ) )
+        {
+            pResponse->isValueTrimmed = 1U;
+        }
+        else if( ( pResponse->isValueTrimmed != 0U ) ||
+                 ( pResponse->index >= SIGNALING_LITERAL_LENGTH( SIGNALING_HTTP_CHUNKED ) ) ||
+                 ( SIGNALING_HTTP_TO_LOWER( c ) != SIGNALING_HTTP_CHUNKED[ pResponse->index ] ) )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            pResponse->index++;
+        }
+    }
+    else if( pResponse->header == ( uint8_t ) HTTP_HEADER_ERROR_TYPE )
+    {
+        /* The error type can be followed by a colon and the namespace of the
+         * service, for example "ResourceNotFoundException:http://...". */
+        if( c == ':' )
+        {
+            pResponse->isValueTrimmed = 1U;
+        }
+        else if( ( pResponse->isValueTrimmed == 0U ) &&
+                 ( pResponse->errorTypeLength < SIGNALING_HTTP_MAX_ERROR_TYPE_LENGTH ) )
+        {
+            pResponse->errorType[ pResponse->errorTypeLength ] = c;
+            pResponse->errorTypeLength++;
+        }
+        else
+        {
+            /* Truncated. */
+        }
+    }
+    else
+    {
+        /* Not a header the parser looks at. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseHeaderValueEnd( SignalingHttpResponse_t * pResponse )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pResponse->header == ( uint8_t ) HTTP_HEADER_CONTENT_LENGTH )
+    {
+        if( pResponse->index == 0U )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+    }
+    else if( pResponse->header == ( uint8_t ) HTTP_HEADER_TRANSFER_ENCODING )
+    {
+        if( pResponse->index != SIGNALING_LITERAL_LENGTH( SIGNALING_HTTP_CHUNKED ) )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            pResponse->isChunked = 1U;
+        }
+    }
+    else if( pResponse->header == ( uint8_t ) HTTP_HEADER_ERROR_TYPE )
+    {
+        while( ( pResponse->errorTypeLength > 0U ) &&
+               SIGNALING_HTTP_IS_SPACE( pResponse->errorType[ pResponse->errorTypeLength - 1U ] ) )
+        {
+            pResponse->errorTypeLength--;
+        }
+    }
+    else
+    {
+        /* Not a header the parser looks at. */
+    }
+
+    pResponse->header = ( uint8_t ) HTTP_HEADER_OTHER;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void ParseHeadersEnd( SignalingHttpResponse_t * pResponse )
+{
+    pResponse->index = 0U;
+
+    if( pResponse->statusCode < 200U )
+    {
+        /* An interim response, the final one follows. */
+        ResetResponse( pResponse );
+    }
+    else if( pResponse->isChunked != 0U )
+    {
+        /* The chunked coding overrides any Content-Length. */
+        pResponse->state = ( uint8_t ) HTTP_STATE_CHUNK_SIZE;
+        pResponse->remainingLength = 0U;
+    }
+    else if( ( pResponse->statusCode == 204U ) || ( pResponse->statusCode == 304U ) ||
+             ( ( pResponse->hasContentLength != 0U ) && ( pResponse->remainingLength == 0U ) ) )
+    {
+        pResponse->state = ( uint8_t ) HTTP_STATE_COMPLETE;
+    }
+    else if( pResponse->hasContentLength != 0U )
+    {
+        pResponse->state = ( uint8_t ) HTTP_STATE_BODY_LENGTH;
+    }
+    else
+    {
+        pResponse->state = ( uint8_t ) HTTP_STATE_BODY_UNTIL_CLOSE;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ParseChunkByte( SignalingHttpResponse_t * pResponse,
+                                         char c )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    uint8_t isSizeLineEnd = 0U;
+
+    if( pResponse->state == ( uint8_t ) HTTP_STATE_CHUNK_SIZE )
+    {
+        if( SIGNALING_HTTP_IS_DIGIT( c ) ||
+            ( ( SIGNALING_HTTP_TO_LOWER( c ) >= 'a' ) && ( SIGNALING_HTTP_TO_LOWER( c ) <= 'f' ) ) )
+        {
+            if( pResponse->remainingLength > ( SIZE_MAX >> 4 ) )
+            {
+                result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+            }
+            else
+            {
+                pResponse->remainingLength = ( pResponse->remainingLength << 4 ) +
+                                             ( size_t ) ( SIGNALING_HTTP_IS_DIGIT( c ) ? ( c - '0' ) : ( SIGNALING_HTTP_TO_LOWER( c ) - 'a' + 10 ) );
+                pResponse->index++;
+            }
+        }
+        else if( pResponse->index == 0U )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else if( c == '\n' )
+        {
+            isSizeLineEnd = 1U;
+        }
+        else if( ( c == ';' ) || ( c == '\r' ) || SIGNALING_HTTP_IS_SPACE( c ) )
+        {
+            /* Chunk extensions are ignored. */
+            pResponse->state = ( uint8_t ) HTTP_STATE_CHUNK_EXTENSION;
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_CHUNK_EXTENSION )
+    {
+        if( c == '\n' )
+        {
+            isSizeLineEnd = 1U;
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_CHUNK_DATA_END )
+    {
+        if( c == '\n' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_CHUNK_SIZE;
+            pResponse->remainingLength = 0U;
+            pResponse->index = 0U;
+        }
+        else if( c != '\r' )
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+        else
+        {
+            /* Nothing to do, the line ends with the line feed. */
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_TRAILER_LINE_START )
+    {
+        if( c == '\r' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_TRAILERS_END;
+        }
+        else if( c == '\n' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_COMPLETE;
+        }
+        else
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_TRAILER;
+        }
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_TRAILER )
+    {
+        /* Trailers are ignored. */
+        if( c == '\n' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_TRAILER_LINE_START;
+        }
+    }
+    else
+    {
+        if( c == '\n' )
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_COMPLETE;
+        }
+        else
+        {
+            result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+        }
+    }
+
+    if( isSizeLineEnd != 0U )
+    {
+        if( pResponse->remainingLength == 0U )
+        {
+            /* The last chunk, followed by the trailers. */
+            pResponse->state = ( uint8_t ) HTTP_STATE_TRAILER_LINE_START;
+        }
+        else
+        {
+            pResponse->state = ( uint8_t ) HTTP_STATE_CHUNK_DATA;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_HttpResponseInit( SignalingHttpResponse_t * pResponse )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pResponse == NULL )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        ResetResponse( pResponse );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_HttpResponseParse( SignalingHttpResponse_t * pResponse,
+                                               char * pBuffer,
+                                               size_t dataLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t i = 0U, end = 0U, spanLength;
+
+    if( ( pResponse == NULL ) || ( pBuffer == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_INVALID )
+    {
+        result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+    }
+    else
+    {
+        /* The new bytes follow the body parsed so far, which is only ever
+         * moved backwards over the bytes already parsed. */
+        i = pResponse->bodyLength;
+        end = pResponse->bodyLength + dataLength;
+    }
+
+    while( ( result == SIGNALING_RESULT_OK ) && ( i < end ) &&
+           ( pResponse->state != ( uint8_t ) HTTP_STATE_COMPLETE ) )
+    {
+        if( ( pResponse->state == ( uint8_t ) HTTP_STATE_BODY_LENGTH ) ||
+            ( pResponse->state == ( uint8_t ) HTTP_STATE_CHUNK_DATA ) ||
+            ( pResponse->state == ( uint8_t ) HTTP_STATE_BODY_UNTIL_CLOSE ) )
+        {
+            spanLength = end - i;
+
+            if( ( pResponse->state != ( uint8_t ) HTTP_STATE_BODY_UNTIL_CLOSE ) &&
+                ( spanLength > pResponse->remainingLength ) )
+            {
+                spanLength = pResponse->remainingLength;
+            }
+
+            if( i != pResponse->bodyLength )
+            {
+                memmove( &( pBuffer[ pResponse->bodyLength ] ), &( pBuffer[ i ] ), spanLength );
+            }
+
+            pResponse->bodyLength += spanLength;
+            i += spanLength;
+
+            if( pResponse->state != ( uint8_t ) HTTP_STATE_BODY_UNTIL_CLOSE )
+            {
+                pResponse->remainingLength -= spanLength;
+
+                if( pResponse->remainingLength == 0U )
+                {
+                    pResponse->state = ( pResponse->state == ( uint8_t ) HTTP_STATE_BODY_LENGTH ) ?
+                                       ( uint8_t ) HTTP_STATE_COMPLETE :
+                                       ( uint8_t ) HTTP_STATE_CHUNK_DATA_END;
+                }
+            }
+        }
+        else
+        {
+            if( pResponse->state <= ( uint8_t ) HTTP_STATE_STATUS_REASON )
+            {
+                result = ParseStatusByte( pResponse, pBuffer[ i ] );
+            }
+            else if( pResponse->state <= ( uint8_t ) HTTP_STATE_HEADERS_END )
+            {
+                result = ParseHeaderByte( pResponse, pBuffer[ i ] );
+            }
+            else
+            {
+                result = ParseChunkByte( pResponse, pBuffer[ i ] );
+            }
+
+            i++;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        pResponse->isComplete = ( pResponse->state == ( uint8_t ) HTTP_STATE_COMPLETE ) ? 1U : 0U;
+    }
+    else if( result == SIGNALING_RESULT_INVALID_HTTP_RESPONSE )
+    {
+        pResponse->state = ( uint8_t ) HTTP_STATE_INVALID;
+    }
+    else
+    {
+        /* Empty else marker. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_HttpResponseFinish( SignalingHttpResponse_t * pResponse )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pResponse == NULL )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( pResponse->state == ( uint8_t ) HTTP_STATE_BODY_UNTIL_CLOSE )
+    {
+        pResponse->state = ( uint8_t ) HTTP_STATE_COMPLETE;
+        pResponse->isComplete = 1U;
+    }
+    else if( pResponse->state != ( uint8_t ) HTTP_STATE_COMPLETE )
+    {
+        pResponse->state = ( uint8_t ) HTTP_STATE_INVALID;
+        result = SIGNALING_RESULT_INVALID_HTTP_RESPONSE;
+    }
+    else
+    {
+        /* Already complete. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,513 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_ice_cache.h"
+
+/*-----------------------------------------------------------*/
+
+static SignalingIceCacheEntry_t * FindEntry( SignalingIceCache_t * pCache,
+                                             const SignalingChannelArn_t * pChannelArn );
+
+static SignalingIceCacheEntry_t * FindFreeEntry( SignalingIceCache_t * pCache,
+                                                 uint64_t currentTimeSeconds );
+
+static uint8_t ReadEntry( const SignalingIceCacheEntry_t * pEntry,
+                          const SignalingChannelArn_t * pChannelArn,
+                          SignalingIceCacheEntryInfo_t * pInfo,
+                          char * pStorage,
+                          size_t storageLength );
+
+static uint8_t IsRefreshInProgress( const SignalingIceCacheEntryInfo_t * pInfo,
+                                    uint64_t currentTimeSeconds );
+
+static void BeginWrite( SignalingIceCacheEntry_t * pEntry );
+
+static void EndWrite( SignalingIceCacheEntry_t * pEntry );
+
+static size_t CopyToStorage( SignalingIceCacheEntry_t * pEntry,
+                             const char * pData,
+                             size_t dataLength );
+
+/*-----------------------------------------------------------*/
+
+/* Only the thread that changes the cache reads entries without the sequence lock. */
+static SignalingIceCacheEntry_t * FindEntry( SignalingIceCache_t * pCache,
+                                             const SignalingChannelArn_t * pChannelArn )
+{
+    SignalingIceCacheEntry_t * pEntry = NULL;
+    size_t i;
+
+    for( i = 0; ( i < pCache->entryCount ) && ( pEntry == NULL ); i++ )
+    {
+        if( ( pCache->pEntries[ i ].info.isUsed != 0U ) &&
+            ( pCache->pEntries[ i ].info.channelArnLength == pChannelArn->channelArnLength ) &&
+            ( memcmp( pCache->pEntries[ i ].storage, pChannelArn->pChannelArn, pChannelArn->channelArnLength ) == 0 ) )
+        {
+            pEntry = &( pCache->pEntries[ i ] );
+        }
+    }
+
+    return pEntry;
+}
+
+/*-----------------------------------------------------------*/
+
+/* An unused entry, else one whose ICE servers have expired and that is not being refreshed. */
+static SignalingIceCacheEntry_t * FindFreeEntry( SignalingIceCache_t * pCache,
+                                                 uint64_t currentTimeSeconds )
+{
+    SignalingIceCacheEntry_t * pEntry = NULL;
+    const SignalingIceCacheEntryInfo_t * pInfo;
+    size_t i;
+
+    for( i = 0; i < pCache->entryCount; i++ )
+    {
+        pInfo = &( pCache->pEntries[ i ].info );
+
+        if( pInfo->isUsed == 0U )
+        {
+            pEntry = &( pCache->pEntries[ i ] );
+            break;
+        }
+        else if( ( pEntry == NULL ) &&
+                 ( ( pInfo->hasIceServers == 0U ) || ( currentTimeSeconds >= pInfo->expiryTimeSeconds ) ) &&
+                 ( IsRefreshInProgress( pInfo, currentTimeSeconds ) == 0U ) )
+        {
+            pEntry = &( pCache->pEntries[ i ] );
+        }
+        else
+        {
+            /* Empty on purpose. */
+        }
+    }
+
+    return pEntry;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Copy an entry if it holds the channel, retrying until no update started or completed
+ * during the copy. A torn copy is never used, as it is discarded. */
+static uint8_t ReadEntry( const SignalingIceCacheEntry_t * pEntry,
+                          const SignalingChannelArn_t * pChannelArn,
+                          SignalingIceCacheEntryInfo_t * pInfo,
+                          char * pStorage,
+                          size_t storageLength )
+{
+    uint32_t sequence;
+    uint8_t isMatch = 0U;
+
+    do
+    {
+        sequence = pEntry->sequence;
+        SIGNALING_MEMORY_BARRIER();
+        isMatch = 0U;
+
+        if( ( sequence & 1U ) == 0U )
+        {
+            *pInfo = pEntry->info;
+
+            if( ( pInfo->isUsed != 0U ) &&
+                ( pInfo->channelArnLength == pChannelArn->channelArnLength ) &&
+                ( pInfo->channelArnLength <= SIGNALING_ICE_CACHE_STORAGE_LENGTH ) &&
+                ( memcmp( pEntry->storage, pChannelArn->pChannelArn, pChannelArn->channelArnLength ) == 0 ) )
+            {
+                isMatch = 1U;
+
+                if( ( pInfo->storageUsed <= storageLength ) &&
+                    ( pInfo->storageUsed <= SIGNALING_ICE_CACHE_STORAGE_LENGTH ) )
+                {
+                    memcpy( pStorage, pEntry->storage, pInfo->storageUsed );
+                }
+            }
+        }
+
+        SIGNALING_MEMORY_BARRIER();
+    } while( ( ( sequence & 1U ) != 0U ) || ( sequence != pEntry->sequence ) );
+
+    return isMatch;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsRefreshInProgress( const SignalingIceCacheEntryInfo_t * pInfo,
+                                    uint64_t currentTimeSeconds )
+{
+    return ( ( pInfo->isRefreshing != 0U ) &&
+             ( currentTimeSeconds < ( pInfo->refreshStartTimeSeconds + SIGNALING_ICE_CACHE_REFRESH_TIMEOUT_SECONDS ) ) ) ? 1U : 0U;
+}
+
+/*-----------------------------------------------------------*/
+
+/* An odd sequence tells readers that an update is in progress. */
+static void BeginWrite( SignalingIceCacheEntry_t * pEntry )
+{
+    pEntry->sequence++;
+    SIGNALING_MEMORY_BARRIER();
+}
+
+/*-----------------------------------------------------------*/
+
+static void EndWrite( SignalingIceCacheEntry_t * pEntry )
+{
+    SIGNALING_MEMORY_BARRIER();
+    pEntry->sequence++;
+}
+
+/*-----------------------------------------------------------*/
+
+/* The caller checked that the data fits. */
+static size_t CopyToStorage( SignalingIceCacheEntry_t * pEntry,
+                             const char * pData,
+                             size_t dataLength )
+{
+    size_t offset = pEntry->info.storageUsed;
+
+    if( dataLength > 0U )
+    {
+        memcpy( &( pEntry->storage[ offset ] ), pData, dataLength );
+        pEntry->info.storageUsed += dataLength;
+    }
+
+    return offset;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_IceCacheInit( SignalingIceCache_t * pCache,
+                                          SignalingIceCacheEntry_t * pEntries,
+                                          size_t entryCount,
+                                          uint32_t refreshPercent )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( ( pCache == NULL ) ||
+        ( pEntries == NULL ) ||
+        ( entryCount == 0U ) ||
+        ( refreshPercent == 0U ) ||
+        ( refreshPercent > 100U ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pEntries, 0, entryCount * sizeof( SignalingIceCacheEntry_t ) );
+        pCache->refreshPercent = refreshPercent;
+        pCache->pEntries = pEntries;
+        pCache->entryCount = entryCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_IceCacheGet( const SignalingIceCache_t * pCache,
+                                         const SignalingChannelArn_t * pChannelArn,
+                                         uint64_t currentTimeSeconds,
+                                         SignalingIceServer_t * pIceServers,
+                                         size_t * pIceServerCount,
+                                         char * pStorage,
+                                         size_t storageLength,
+                                         uint8_t * pShouldRefresh )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingIceCacheEntryInfo_t info;
+    const SignalingIceCacheServer_t * pServer;
+    uint8_t isFound = 0U;
+    size_t i;
+    uint32_t j;
+
+    if( ( pCache == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) ||
+        ( pIceServers == NULL ) ||
+        ( pIceServerCount == NULL ) ||
+        ( pStorage == NULL ) ||
+        ( pShouldRefresh == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( &( info ), 0, sizeof( SignalingIceCacheEntryInfo_t ) );
+
+        for( i = 0; ( i < pCache->entryCount ) && ( isFound == 0U ); i++ )
+        {
+            isFound = ReadEntry( &( pCache->pEntries[ i ] ), pChannelArn, &( info ), pStorage, storageLength );
+        }
+
+        if( ( isFound == 0U ) ||
+            ( info.hasIceServers == 0U ) ||
+            ( currentTimeSeconds >= info.expiryTimeSeconds ) )
+        {
+            result = SIGNALING_RESULT_CACHE_MISS;
+        }
+        else if( ( *pIceServerCount < info.iceServerCount ) ||
+                 ( storageLength < info.storageUsed ) )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            for( i = 0; i < info.iceServerCount; i++ )
+            {
+                pServer = &( info.iceServers[ i ] );
+                memset( &( pIceServers[ i ] ), 0, sizeof( SignalingIceServer_t ) );
+                pIceServers[ i ].pUserName = &( pStorage[ pServer->userNameOffset ] );
+                pIceServers[ i ].userNameLength = pServer->userNameLength;
+                pIceServers[ i ].pPassword = &( pStorage[ pServer->passwordOffset ] );
+                pIceServers[ i ].passwordLength = pServer->passwordLength;
+                pIceServers[ i ].messageTtlSeconds = pServer->messageTtlSeconds;
+                pIceServers[ i ].urisNum = pServer->urisNum;
+
+                for( j = 0; j < pServer->urisNum; j++ )
+                {
+                    pIceServers[ i ].pUris[ j ] = &( pStorage[ pServer->uriOffsets[ j ] ] );
+                    pIceServers[ i ].urisLength[ j ] = pServer->urisLength[ j ];
+                }
+            }
+
+            *pIceServerCount = info.iceServerCount;
+        }
+
+        *pShouldRefresh = 0U;
+
+        if( ( ( result == SIGNALING_RESULT_CACHE_MISS ) ||
+              ( info.isStale != 0U ) ||
+              ( currentTimeSeconds >= info.refreshTimeSeconds ) ) &&
+            ( ( isFound == 0U ) || ( IsRefreshInProgress( &( info ), currentTimeSeconds ) == 0U ) ) )
+        {
+            *pShouldRefresh = 1U;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_IceCacheBeginRefresh( SignalingIceCache_t * pCache,
+                                                  const SignalingChannelArn_t * pChannelArn,
+                                                  uint64_t currentTimeSeconds,
+                                                  uint8_t * pShouldFetch )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingIceCacheEntry_t * pEntry = NULL;
+
+    if( ( pCache == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) ||
+        ( pShouldFetch == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        *pShouldFetch = 1U;
+        pEntry = FindEntry( pCache, pChannelArn );
+
+        if( pEntry == NULL )
+        {
+            /* Remember the channel, so that later misses share this refresh. If the ARN
+             * doesn't fit or no entry is free, every call fetches. */
+            pEntry = FindFreeEntry( pCache, currentTimeSeconds );
+
+            if( ( pEntry != NULL ) && ( pChannelArn->channelArnLength <= SIGNALING_ICE_CACHE_STORAGE_LENGTH ) )
+            {
+                BeginWrite( pEntry );
+                memset( &( pEntry->info ), 0, sizeof( SignalingIceCacheEntryInfo_t ) );
+                ( void ) CopyToStorage( pEntry, pChannelArn->pChannelArn, pChannelArn->channelArnLength );
+                pEntry->info.channelArnLength = pChannelArn->channelArnLength;
+                pEntry->info.isUsed = 1U;
+                pEntry->info.isRefreshing = 1U;
+                pEntry->info.refreshStartTimeSeconds = currentTimeSeconds;
+                EndWrite( pEntry );
+            }
+        }
+        else if( IsRefreshInProgress( &( pEntry->info ), currentTimeSeconds ) != 0U )
+        {
+            *pShouldFetch = 0U;
+        }
+        else
+        {
+            BeginWrite( pEntry );
+            pEntry->info.isRefreshing = 1U;
+            pEntry->info.refreshStartTimeSeconds = currentTimeSeconds;
+            EndWrite( pEntry );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_IceCacheUpdate( SignalingIceCache_t * pCache,
+                                            const SignalingChannelArn_t * pChannelArn,
+                                            const SignalingIceServer_t * pIceServers,
+                                            size_t iceServerCount,
+                                            uint64_t currentTimeSeconds )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingIceCacheEntry_t * pEntry = NULL;
+    SignalingIceCacheServer_t * pServer;
+    size_t storageLength = 0U, i;
+    uint32_t ttlSeconds = 0U, j;
+
+    if( ( pCache == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) ||
+        ( ( pIceServers == NULL ) && ( iceServerCount > 0U ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( iceServerCount > SIGNALING_ICE_CACHE_MAX_SERVERS )
+    {
+        result = SIGNALING_RESULT_OUT_OF_MEMORY;
+    }
+    else
+    {
+        /* Check that everything fits before touching the cache. Each length is bounded by
+         * the storage, so that the sum doesn't wrap around. */
+        storageLength = pChannelArn->channelArnLength;
+
+        for( i = 0; ( result == SIGNALING_RESULT_OK ) && ( i < iceServerCount ); i++ )
+        {
+            if( ( pIceServers[ i ].urisNum > SIGNALING_ICE_SERVER_MAX_URIS ) ||
+                ( pIceServers[ i ].userNameLength > SIGNALING_ICE_CACHE_STORAGE_LENGTH ) ||
+                ( pIceServers[ i ].passwordLength > SIGNALING_ICE_CACHE_STORAGE_LENGTH ) )
+            {
+                result = SIGNALING_RESULT_OUT_OF_MEMORY;
+            }
+            else
+            {
+                storageLength += pIceServers[ i ].userNameLength + pIceServers[ i ].passwordLength;
+            }
+
+            for( j = 0; ( result == SIGNALING_RESULT_OK ) && ( j < pIceServers[ i ].urisNum ); j++ )
+            {
+                if( pIceServers[ i ].urisLength[ j ] > SIGNALING_ICE_CACHE_STORAGE_LENGTH )
+                {
+                    result = SIGNALING_RESULT_OUT_OF_MEMORY;
+                }
+                else
+                {
+                    storageLength += pIceServers[ i ].urisLength[ j ];
+                }
+            }
+
+            if( storageLength > SIGNALING_ICE_CACHE_STORAGE_LENGTH )
+            {
+                result = SIGNALING_RESULT_OUT_OF_MEMORY;
+            }
+        }
+
+        if( storageLength > SIGNALING_ICE_CACHE_STORAGE_LENGTH )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        pEntry = FindEntry( pCache, pChannelArn );
+
+        if( pEntry == NULL )
+        {
+            pEntry = FindFreeEntry( pCache, currentTimeSeconds );
+        }
+
+        if( pEntry == NULL )
+        {
+            /* Replace the channel whose ICE servers expire first. */
+            pEntry = &( pCache->pEntries[ 0 ] );
+
+            for( i = 1; i < pCache->entryCount; i++ )
+            {
+                if( pCache->pEntries[ i ].info.expiryTimeSeconds < pEntry->info.expiryTimeSeconds )
+                {
+                    pEntry = &( pCache->pEntries[ i ] );
+                }
+            }
+        }
+
+        /* The servers expire with the first of them to expire. */
+        for( i = 0; i < iceServerCount; i++ )
+        {
+            if( ( i == 0U ) || ( pIceServers[ i ].messageTtlSeconds < ttlSeconds ) )
+            {
+                ttlSeconds = pIceServers[ i ].messageTtlSeconds;
+            }
+        }
+
+        BeginWrite( pEntry );
+
+        memset( &( pEntry->info ), 0, sizeof( SignalingIceCacheEntryInfo_t ) );
+        ( void ) CopyToStorage( pEntry, pChannelArn->pChannelArn, pChannelArn->channelArnLength );
+        pEntry->info.channelArnLength = pChannelArn->channelArnLength;
+
+        for( i = 0; i < iceServerCount; i++ )
+        {
+            pServer = &( pEntry->info.iceServers[ i ] );
+            pServer->userNameOffset = CopyToStorage( pEntry, pIceServers[ i ].pUserName, pIceServers[ i ].userNameLength );
+            pServer->userNameLength = pIceServers[ i ].userNameLength;
+            pServer->passwordOffset = CopyToStorage( pEntry, pIceServers[ i ].pPassword, pIceServers[ i ].passwordLength );
+            pServer->passwordLength = pIceServers[ i ].passwordLength;
+            pServer->messageTtlSeconds = pIceServers[ i ].messageTtlSeconds;
+            pServer->urisNum = pIceServers[ i ].urisNum;
+
+            for( j = 0; j < pIceServers[ i ].urisNum; j++ )
+            {
+                pServer->uriOffsets[ j ] = CopyToStorage( pEntry, pIceServers[ i ].pUris[ j ], pIceServers[ i ].urisLength[ j ] );
+                pServer->urisLength[ j ] = pIceServers[ i ].urisLength[ j ];
+            }
+        }
+
+        pEntry->info.iceServerCount = iceServerCount;
+        pEntry->info.expiryTimeSeconds = currentTimeSeconds + ttlSeconds;
+        pEntry->info.refreshTimeSeconds = currentTimeSeconds + ( ( ( uint64_t ) ttlSeconds * pCache->refreshPercent ) / 100U );
+        pEntry->info.hasIceServers = 1U;
+        pEntry->info.isUsed = 1U;
+
+        EndWrite( pEntry );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_IceCacheInvalidate( SignalingIceCache_t * pCache,
+                                                const SignalingChannelArn_t * pChannelArn )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingIceCacheEntry_t * pEntry;
+
+    if( ( pCache == NULL ) ||
+        ( pChannelArn == NULL ) ||
+        ( pChannelArn->pChannelArn == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        pEntry = FindEntry( pCache, pChannelArn );
+
+        if( pEntry != NULL )
+        {
+            BeginWrite( pEntry );
+            pEntry->info.isStale = 1U;
+            EndWrite( pEntry );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,68 @@
+/**
+ * @file signaling_internal.h
+ * @brief Helpers shared by the signaling sources. They are not part of the API.
+ */
+#ifndef SIGNALING_INTERNAL_H
+#define SIGNALING_INTERNAL_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include "signaling_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* Length of a string literal, without the null terminator. */
+#define SIGNALING_LITERAL_LENGTH( pLiteral )    ( sizeof( pLiteral ) - 1U )
+
+/* Characters RFC 3986 leaves unencoded in a URI component. */
+#define SIGNALING_IS_URI_UNRESERVED( c )        ( gSignalingUriUnreservedTable[ ( uint8_t ) ( c ) ] != 0U )
+
+/* Bytes RFC 3986 leaves unencoded in a URI component, 1 for unreserved. */
+extern const uint8_t gSignalingUriUnreservedTable[ 256 ];
+
+/* Receives the pieces of a URI encoded string, in order. */
+typedef void ( * SignalingUriEncodeSink_t )( void * pContext,
+                                             const char * pData,
+                                             size_t dataLength );
+
+/*-----------------------------------------------------------*/
+
+/*
+ * URI encode data the way SigV4 does: every byte that is not unreserved becomes
+ * %XY with uppercase hex digits, except '/' if isPath is set. Runs that need no
+ * encoding are given to sink as they are, so nothing is copied.
+ */
+void Signaling_UriEncode( const char * pData,
+                          size_t dataLength,
+                          uint8_t isPath,
+                          SignalingUriEncodeSink_t sink,
+                          void * pContext );
+
+/*
+ * Split a URL of the form scheme://host[/path][?query]. The path is empty when
+ * the URL has none. If ppQuery is NULL, the path runs to the end of the URL,
+ * query included. Returns SIGNALING_RESULT_INVALID_URL if there is no scheme
+ * or no host.
+ */
+SignalingResult_t Signaling_SplitUrl( const char * pUrl,
+                                      size_t urlLength,
+                                      const char ** ppHost,
+                                      size_t * pHostLength,
+                                      const char ** ppPath,
+                                      size_t * pPathLength,
+                                      const char ** ppQuery,
+                                      size_t * pQueryLength );
+
+/*-----------------------------------------------------------*/
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+}
+#endif
+/* *INDENT-ON* */
+
+#endif /* SIGNALING_INTERNAL_H */
@@ -0,0 +1,1062 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_sigv4.h"
+#include "signaling_internal.h"
+
+#define SIGNALING_SIGV4_ALGORITHM               "AWS4-HMAC-SHA256"
+#define SIGNALING_SIGV4_TERMINATOR              "aws4_request"
+
+#define SIGNALING_SHA256_ROTR( x, n )           ( ( ( x ) >> ( n ) ) | ( ( x ) << ( 32U - ( n ) ) ) )
+
+/* HMAC-SHA256 in progress. The outer key pad is kept so that the outer hash
+ * can be started when the inner one is finished. */
+typedef struct HmacSha256
+{
+    SignalingSha256_t inner;
+    uint8_t outerKeyPad[ SIGNALING_SHA256_BLOCK_LENGTH ];
+} HmacSha256_t;
+
+/* Bounded output, copied while it fits and always counted. */
+typedef struct SigV4Output
+{
+    char * pBuffer;
+    size_t bufferLength;
+    size_t length;
+} SigV4Output_t;
+
+/*-----------------------------------------------------------*/
+
+static void Sha256Compress( uint32_t * pState,
+                            const uint8_t * pBlock );
+
+static void HmacSha256Init( HmacSha256_t * pHmac,
+                            const uint8_t * pKey,
+                            size_t keyLength );
+
+static void HmacSha256Final( HmacSha256_t * pHmac,
+                             uint8_t * pMac );
+
+static void EncodeHex( const uint8_t * pInput,
+                       size_t inputLength,
+                       char * pOutput );
+
+static void Sha256UpdateSink( void * pContext,
+                              const char * pData,
+                              size_t dataLength );
+
+static SignalingResult_t SplitQuery( const char * pQuery,
+                                     size_t queryLength,
+                                     SignalingSigV4Header_t * pParameters,
+                                     size_t * pParameterCount );
+
+static int CompareStrings( const char * pLeft,
+                           size_t leftLength,
+                           const char * pRight,
+                           size_t rightLength );
+
+static int CompareUriEncoded( const char * pLeft,
+                              size_t leftLength,
+                              const char * pRight,
+                              size_t rightLength );
+
+static void SortQueryParameters( SignalingSigV4Header_t * pParameters,
+                                 size_t parameterCount );
+
+static void SortHeaders( const SignalingSigV4Header_t ** ppHeaders,
+                         size_t headerCount );
+
+static SignalingResult_t GetSigningKey( SignalingSigV4Signer_t * pSigner,
+                                        const SignalingCredential_t * pCredential,
+                                        const SignalingAwsRegion_t * pAwsRegion,
+                                        const char * pService,
+                                        size_t serviceLength,
+                                        const char * pDate );
+
+static SignalingResult_t ValidateSigningParameters( const SignalingSigV4Signer_t * pSigner,
+                                                    const SignalingCredential_t * pCredential,
+                                                    const SignalingAwsRegion_t * pAwsRegion,
+                                                    const char * pService,
+                                                    size_t serviceLength,
+                                                    const char * pDate );
+
+static void ComputeSignature( const SignalingSigV4Signer_t * pSigner,
+                              const SignalingAwsRegion_t * pAwsRegion,
+                              const char * pService,
+                              size_t serviceLength,
+                              const char * pDate,
+                              const uint8_t * pCanonicalRequestHash,
+                              char * pSignature );
+
+static void AppendToOutput( SigV4Output_t * pOutput,
+                            const char * pData,
+                            size_t dataLength );
+
+/*-----------------------------------------------------------*/
+
+const uint8_t gSignalingUriUnreservedTable[ 256 ] =
+{
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 1U, 1U, 0U,
+    1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U,
+    1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 0U, 0U, 0U, 0U, 1U,
+    0U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U,
+    1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 0U, 0U, 0U, 1U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,
+};
+
+static const uint32_t gSha256RoundConstants[ 64 ] =
+{
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+/*-----------------------------------------------------------*/
+
+static void Sha256Compress( uint32_t * pState,
+                            const uint8_t * pBlock )
+{
+    uint32_t w[ 64 ];
+    uint32_t a, b, c, d, e, f, g, h, t1, t2;
+    size_t i;
+
+    for( i = 0; i < 16U; i++ )
+    {
+        w[ i ] = ( ( uint32_t ) pBlock[ 4U * i ] << 24 ) |
+                 ( ( uint32_t ) pBlock[ ( 4U * i ) + 1U ] << 16 ) |
+                 ( ( uint32_t ) pBlock[ ( 4U * i ) + 2U ] << 8 ) |
+                 ( ( uint32_t ) pBlock[ ( 4U * i ) + 3U ] );
+    }
+
+    for( i = 16; i < 64U; i++ )
+    {
+        w[ i ] = ( SIGNALING_SHA256_ROTR( w[ i - 2U ], 17U ) ^ SIGNALING_SHA256_ROTR( w[ i - 2U ], 19U ) ^ ( w[ i - 2U ] >> 10 ) ) +
+                 w[ i - 7U ] +
+                 ( SIGNALING_SHA256_ROTR( w[ i - 15U ], 7U ) ^ SIGNALING_SHA256_ROTR( w[ i - 15U ], 18U ) ^ ( w[ i - 15U ] >> 3 ) ) +
+                 w[ i - 16U ];
+    }
+
+    a = pState[ 0 ];
+    b = pState[ 1 ];
+    c = pState[ 2 ];
+    d = pState[ 3 ];
+    e = pState[ 4 ];
+    f = pState[ 5 ];
+    g = pState[ 6 ];
+    h = pState[ 7 ];
+
+    for( i = 0; i < 64U; i++ )
+    {
+        t1 = h +
+             ( SIGNALING_SHA256_ROTR( e, 6U ) ^ SIGNALING_SHA256_ROTR( e, 11U ) ^ SIGNALING_SHA256_ROTR( e, 25U ) ) +
+             ( ( e & f ) ^ ( ( ~e ) & g ) ) +
+             gSha256RoundConstants[ i ] +
+             w[ i ];
+        t2 = ( SIGNALING_SHA256_ROTR( a, 2U ) ^ SIGNALING_SHA256_ROTR( a, 13U ) ^ SIGNALING_SHA256_ROTR( a, 22U ) ) +
+             ( ( a & b ) ^ ( a & c ) ^ ( b & c ) );
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    pState[ 0 ] += a;
+    pState[ 1 ] += b;
+    pState[ 2 ] += c;
+    pState[ 3 ] += d;
+    pState[ 4 ] += e;
+    pState[ 5 ] += f;
+    pState[ 6 ] += g;
+    pState[ 7 ] += h;
+}
+
+/*-----------------------------------------------------------*/
+
+void Signaling_Sha256Init( SignalingSha256_t * pSha256 )
+{
+    pSha256->state[ 0 ] = 0x6A09E667U;
+    pSha256->state[ 1 ] = 0xBB67AE85U;
+    pSha256->state[ 2 ] = 0x3C6EF372U;
+    pSha256->state[ 3 ] = 0xA54FF53AU;
+    pSha256->state[ 4 ] = 0x510E527FU;
+    pSha256->state[ 5 ] = 0x9B05688CU;
+    pSha256->state[ 6 ] = 0x1F83D9ABU;
+    pSha256->state[ 7 ] = 0x5BE0CD19U;
+    pSha256->length = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+void Signaling_Sha256Update( SignalingSha256_t * pSha256,
+                             const void * pData,
+                             size_t dataLength )
+{
+    const uint8_t * pBytes = ( const uint8_t * ) pData;
+    size_t blockIndex = ( size_t ) ( pSha256->length % SIGNALING_SHA256_BLOCK_LENGTH );
+    size_t copyLength;
+
+    pSha256->length += dataLength;
+
+    /* Complete a partial block first. */
+    if( ( blockIndex > 0U ) && ( dataLength > 0U ) )
+    {
+        copyLength = SIGNALING_SHA256_BLOCK_LENGTH - blockIndex;
+
+        if( copyLength > dataLength )
+        {
+            copyLength = dataLength;
+        }
+
+        memcpy( &( pSha256->block[ blockIndex ] ), pBytes, copyLength );
+        pBytes = &( pBytes[ copyLength ] );
+        dataLength -= copyLength;
+
+        if( ( blockIndex + copyLength ) == SIGNALING_SHA256_BLOCK_LENGTH )
+        {
+            Sha256Compress( pSha256->state, pSha256->block );
+        }
+    }
+
+    /* Whole blocks are compressed straight from the input. */
+    while( dataLength >= SIGNALING_SHA256_BLOCK_LENGTH )
+    {
+        Sha256Compress( pSha256->state, pBytes );
+        pBytes = &( pBytes[ SIGNALING_SHA256_BLOCK_LENGTH ] );
+        dataLength -= SIGNALING_SHA256_BLOCK_LENGTH;
+    }
+
+    if( dataLength > 0U )
+    {
+        memcpy( pSha256->block, pBytes, dataLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+void Signaling_Sha256Final( SignalingSha256_t * pSha256,
+                            uint8_t * pDigest )
+{
+    size_t blockIndex = ( size_t ) ( pSha256->length % SIGNALING_SHA256_BLOCK_LENGTH );
+    uint64_t bitLength = pSha256->length * 8U;
+    size_t i;
+
+    pSha256->block[ blockIndex ] = 0x80U;
+    blockIndex++;
+
+    /* The length needs the last 8 bytes of a block. */
+    if( blockIndex > ( SIGNALING_SHA256_BLOCK_LENGTH - 8U ) )
+    {
+        memset( &( pSha256->block[ blockIndex ] ), 0, SIGNALING_SHA256_BLOCK_LENGTH - blockIndex );
+        Sha256Compress( pSha256->state, pSha256->block );
+        blockIndex = 0;
+    }
+
+    memset( &( pSha256->block[ blockIndex ] ), 0, ( SIGNALING_SHA256_BLOCK_LENGTH - 8U ) - blockIndex );
+
+    for( i = 0; i < 8U; i++ )
+    {
+        pSha256->block[ ( SIGNALING_SHA256_BLOCK_LENGTH - 1U ) - i ] = ( uint8_t ) ( bitLength >> ( 8U * i ) );
+    }
+
+    Sha256Compress( pSha256->state, pSha256->block );
+
+    for( i = 0; i < 8U; i++ )
+    {
+        pDigest[ 4U * i ] = ( uint8_t ) ( pSha256->state[ i ] >> 24 );
+        pDigest[ ( 4U * i ) + 1U ] = ( uint8_t ) ( pSha256->state[ i ] >> 16 );
+        pDigest[ ( 4U * i ) + 2U ] = ( uint8_t ) ( pSha256->state[ i ] >> 8 );
+        pDigest[ ( 4U * i ) + 3U ] = ( uint8_t ) pSha256->state[ i ];
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void HmacSha256Init( HmacSha256_t * pHmac,
+                            const uint8_t * pKey,
+                            size_t keyLength )
+{
+    uint8_t keyPad[ SIGNALING_SHA256_BLOCK_LENGTH ] = { 0 };
+    size_t i;
+
+    /* Keys longer than a block are replaced by their digest. */
+    if( keyLength > SIGNALING_SHA256_BLOCK_LENGTH )
+    {
+        Signaling_Sha256Init( &( pHmac->inner ) );
+        Signaling_Sha256Update( &( pHmac->inner ), pKey, keyLength );
+        Signaling_Sha256Final( &( pHmac->inner ), keyPad );
+    }
+    else if( keyLength > 0U )
+    {
+        memcpy( keyPad, pKey, keyLength );
+    }
+    else
+    {
+        /* An empty key is all zeros. */
+    }
+
+    for( i = 0; i < SIGNALING_SHA256_BLOCK_LENGTH; i++ )
+    {
+        pHmac->outerKeyPad[ i ] = keyPad[ i ] ^ 0x5CU;
+        keyPad[ i ] ^= 0x36U;
+    }
+
+    Signaling_Sha256Init( &( pHmac->inner ) );
+    Signaling_Sha256Update( &( pHmac->inner ), keyPad, SIGNALING_SHA256_BLOCK_LENGTH );
+}
+
+/*-----------------------------------------------------------*/
+
+static void HmacSha256Final( HmacSha256_t * pHmac,
+                             uint8_t * pMac )
+{
+    uint8_t innerDigest[ SIGNALING_SHA256_DIGEST_LENGTH ];
+
+    Signaling_Sha256Final( &( pHmac->inner ), innerDigest );
+
+    Signaling_Sha256Init( &( pHmac->inner ) );
+    Signaling_Sha256Update( &( pHmac->inner ), pHmac->outerKeyPad, SIGNALING_SHA256_BLOCK_LENGTH );
+    Signaling_Sha256Update( &( pHmac->inner ), innerDigest, SIGNALING_SHA256_DIGEST_LENGTH );
+    Signaling_Sha256Final( &( pHmac->inner ), pMac );
+}
+
+/*-----------------------------------------------------------*/
+
+void Signaling_HmacSha256( const uint8_t * pKey,
+                           size_t keyLength,
+                           const void * pData,
+                           size_t dataLength,
+                           uint8_t * pMac )
+{
+    HmacSha256_t hmac;
+
+    HmacSha256Init( &( hmac ), pKey, keyLength );
+    Signaling_Sha256Update( &( hmac.inner ), pData, dataLength );
+    HmacSha256Final( &( hmac ), pMac );
+}
+
+/*-----------------------------------------------------------*/
+
+static void EncodeHex( const uint8_t * pInput,
+                       size_t inputLength,
+                       char * pOutput )
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    size_t i;
+
+    for( i = 0; i < inputLength; i++ )
+    {
+        pOutput[ 2U * i ] = hexDigits[ pInput[ i ] >> 4 ];
+        pOutput[ ( 2U * i ) + 1U ] = hexDigits[ pInput[ i ] & 0x0FU ];
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void Sha256UpdateSink( void * pContext,
+                              const char * pData,
+                              size_t dataLength )
+{
+    Signaling_Sha256Update( ( SignalingSha256_t * ) pContext, pData, dataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+void Signaling_UriEncode( const char * pData,
+                          size_t dataLength,
+                          uint8_t isPath,
+                          SignalingUriEncodeSink_t sink,
+                          void * pContext )
+{
+    static const char hexDigits[] = "0123456789ABCDEF";
+    char encoded[ 3 ] = { '%', '0', '0' };
+    size_t i = 0, runStart;
+    uint8_t c;
+
+    while( i < dataLength )
+    {
+        /* Runs that need no encoding are given as they are. */
+        runStart = i;
+
+        while( ( i < dataLength ) &&
+               ( SIGNALING_IS_URI_UNRESERVED( pData[ i ] ) ||
+                 ( ( isPath != 0U ) && ( pData[ i ] == '/' ) ) ) )
+        {
+            i++;
+        }
+
+        if( i > runStart )
+        {
+            sink( pContext, &( pData[ runStart ] ), i - runStart );
+        }
+
+        if( i < dataLength )
+        {
+            c = ( uint8_t ) pData[ i ];
+            encoded[ 1 ] = hexDigits[ c >> 4 ];
+            encoded[ 2 ] = hexDigits[ c & 0x0FU ];
+            sink( pContext, &( encoded[ 0 ] ), sizeof( encoded ) );
+            i++;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_SplitUrl( const char * pUrl,
+                                      size_t urlLength,
+                                      const char ** ppHost,
+                                      size_t * pHostLength,
+                                      const char ** ppPath,
+                                      size_t * pPathLength,
+                                      const char ** ppQuery,
+                                      size_t * pQueryLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_INVALID_URL;
+    size_t i, hostStart = 0, pathStart, queryStart;
+
+    for( i = 0; ( i + 2U ) < urlLength; i++ )
+    {
+        if( ( pUrl[ i ] == ':' ) && ( pUrl[ i + 1U ] == '/' ) && ( pUrl[ i + 2U ] == '/' ) )
+        {
+            hostStart = i + 3U;
+            break;
+        }
+    }
+
+    if( hostStart > 3U )
+    {
+        pathStart = hostStart;
+
+        while( ( pathStart < urlLength ) && ( pUrl[ pathStart ] != '/' ) && ( pUrl[ pathStart ] != '?' ) )
+        {
+            pathStart++;
+        }
+
+        queryStart = pathStart;
+
+        while( ( ppQuery != NULL ) && ( queryStart < urlLength ) && ( pUrl[ queryStart ] != '?' ) )
+        {
+            queryStart++;
+        }
+
+        if( pathStart > hostStart )
+        {
+            *ppHost = &( pUrl[ hostStart ] );
+            *pHostLength = pathStart - hostStart;
+            *ppPath = &( pUrl[ pathStart ] );
+
+            if( ppQuery == NULL )
+            {
+                *pPathLength = urlLength - pathStart;
+            }
+            else
+            {
+                *pPathLength = queryStart - pathStart;
+                *ppQuery = ( queryStart < urlLength ) ? &( pUrl[ queryStart + 1U ] ) : NULL;
+                *pQueryLength = ( queryStart < urlLength ) ? ( urlLength - queryStart - 1U ) : 0U;
+            }
+
+            result = SIGNALING_RESULT_OK;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t SplitQuery( const char * pQuery,
+                                     size_t queryLength,
+                                     SignalingSigV4Header_t * pParameters,
+                                     size_t * pParameterCount )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    size_t i = 0, start, count = 0;
+    const char * pSeparator;
+
+    while( ( result == SIGNALING_RESULT_OK ) && ( i < queryLength ) )
+    {
+        start = i;
+
+        while( ( i < queryLength ) && ( pQuery[ i ] != '&' ) )
+        {
+            i++;
+        }
+
+        /* Empty parameters, as in "a=1&&b=2", are skipped. */
+        if( i > start )
+        {
+            if( count == SIGNALING_SIGV4_MAX_QUERY_PARAMETERS )
+            {
+                result = SIGNALING_RESULT_BAD_PARAM;
+            }
+            else
+            {
+                pSeparator = memchr( &( pQuery[ start ] ), '=', i - start );
+                pParameters[ count ].pName = &( pQuery[ start ] );
+
+                if( pSeparator != NULL )
+                {
+                    pParameters[ count ].nameLength = ( size_t ) ( pSeparator - &( pQuery[ start ] ) );
+                    pParameters[ count ].pValue = &( pSeparator[ 1 ] );
+                    pParameters[ count ].valueLength = i - start - pParameters[ count ].nameLength - 1U;
+                }
+                else
+                {
+                    pParameters[ count ].nameLength = i - start;
+                    pParameters[ count ].pValue = NULL;
+                    pParameters[ count ].valueLength = 0;
+                }
+
+                count++;
+            }
+        }
+
+        i++;
+    }
+
+    *pParameterCount = count;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static int CompareStrings( const char * pLeft,
+                           size_t leftLength,
+                           const char * pRight,
+                           size_t rightLength )
+{
+    size_t commonLength = ( leftLength < rightLength ) ? leftLength : rightLength;
+    int comparison = 0;
+
+    if( commonLength > 0U )
+    {
+        comparison = memcmp( pLeft, pRight, commonLength );
+    }
+
+    if( comparison == 0 )
+    {
+        comparison = ( leftLength < rightLength ) ? -1 : ( ( leftLength > rightLength ) ? 1 : 0 );
+    }
+
+    return comparison;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Compare two strings by the order of their URI encoded forms, without
+ * encoding them. Encoded bytes start with '%', which sorts below every
+ * unreserved character, and their uppercase hex digits sort like the bytes
+ * themselves. */
+static int CompareUriEncoded( const char * pLeft,
+                              size_t leftLength,
+                              const char * pRight,
+                              size_t rightLength )
+{
+    size_t i = 0;
+    unsigned int leftRank, rightRank;
+    int comparison = 0;
+
+    while( ( comparison == 0 ) && ( i < leftLength ) && ( i < rightLength ) )
+    {
+        leftRank = ( uint8_t ) pLeft[ i ];
+        rightRank = ( uint8_t ) pRight[ i ];
+
+        if( SIGNALING_IS_URI_UNRESERVED( pLeft[ i ] ) )
+        {
+            leftRank += 256U;
+        }
+
+        if( SIGNALING_IS_URI_UNRESERVED( pRight[ i ] ) )
+        {
+            rightRank += 256U;
+        }
+
+        comparison = ( leftRank < rightRank ) ? -1 : ( ( leftRank > rightRank ) ? 1 : 0 );
+        i++;
+    }
+
+    if( comparison == 0 )
+    {
+        comparison = ( leftLength < rightLength ) ? -1 : ( ( leftLength > rightLength ) ? 1 : 0 );
+    }
+
+    return comparison;
+}
+
+/*-----------------------------------------------------------*/
+
+static void SortQueryParameters( SignalingSigV4Header_t * pParameters,
+                                 size_t parameterCount )
+{
+    SignalingSigV4Header_t parameter;
+    size_t i, j;
+    int comparison;
+
+    /* Insertion sort, there are only a few parameters. */
+    for( i = 1; i < parameterCount; i++ )
+    {
+        parameter = pParameters[ i ];
+        j = i;
+
+        while( j > 0U )
+        {
+            comparison = CompareUriEncoded( pParameters[ j - 1U ].pName, pParameters[ j - 1U ].nameLength,
+                                            parameter.pName, parameter.nameLength );
+
+            if( comparison == 0 )
+            {
+                comparison = CompareUriEncoded( pParameters[ j - 1U ].pValue, pParameters[ j - 1U ].valueLength,
+                                                parameter.pValue, parameter.valueLength );
+            }
+
+            if( comparison <= 0 )
+            {
+                break;
+            }
+
+            pParameters[ j ] = pParameters[ j - 1U ];
+            j--;
+        }
+
+        pParameters[ j ] = parameter;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void SortHeaders( const SignalingSigV4Header_t ** ppHeaders,
+                         size_t headerCount )
+{
+    const SignalingSigV4Header_t * pHeader;
+    size_t i, j;
+
+    for( i = 1; i < headerCount; i++ )
+    {
+        pHeader = ppHeaders[ i ];
+        j = i;
+
+        while( ( j > 0U ) &&
+               ( CompareStrings( ppHeaders[ j - 1U ]->pName, ppHeaders[ j - 1U ]->nameLength,
+                                 pHeader->pName, pHeader->nameLength ) > 0 ) )
+        {
+            ppHeaders[ j ] = ppHeaders[ j - 1U ];
+            j--;
+        }
+
+        ppHeaders[ j ] = pHeader;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t GetSigningKey( SignalingSigV4Signer_t * pSigner,
+                                        const SignalingCredential_t * pCredential,
+                                        const SignalingAwsRegion_t * pAwsRegion,
+                                        const char * pService,
+                                        size_t serviceLength,
+                                        const char * pDate )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingSha256_t sha256;
+    uint8_t secretAccessKeyDigest[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    uint8_t key[ 4 + SECRET_ACCESS_KEY_MAX_LEN ];
+
+    if( pCredential->secretAccessKeyLength > SECRET_ACCESS_KEY_MAX_LEN )
+    {
+        result = SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        /* The secret access key is part of the cache key, so a rotated
+         * credential derives a new signing key. Only its digest is kept. */
+        Signaling_Sha256Init( &( sha256 ) );
+        Signaling_Sha256Update( &( sha256 ), pCredential->pSecretAccessKey, pCredential->secretAccessKeyLength );
+        Signaling_Sha256Final( &( sha256 ), secretAccessKeyDigest );
+
+        if( ( pSigner->isKeyCached == 0U ) ||
+            ( memcmp( pSigner->date, pDate, sizeof( pSigner->date ) ) != 0 ) ||
+            ( CompareStrings( pSigner->region, pSigner->regionLength, pAwsRegion->pAwsRegion, pAwsRegion->awsRegionLength ) != 0 ) ||
+            ( CompareStrings( pSigner->service, pSigner->serviceLength, pService, serviceLength ) != 0 ) ||
+            ( memcmp( pSigner->secretAccessKeyDigest, secretAccessKeyDigest, sizeof( secretAccessKeyDigest ) ) != 0 ) )
+        {
+            /* kSigning = HMAC( HMAC( HMAC( HMAC( "AWS4" + secret, date ), region ), service ), "aws4_request" ). */
+            memcpy( key, "AWS4", 4 );
+            memcpy( &( key[ 4 ] ), pCredential->pSecretAccessKey, pCredential->secretAccessKeyLength );
+
+            Signaling_HmacSha256( key, 4U + pCredential->secretAccessKeyLength, pDate, sizeof( pSigner->date ), pSigner->signingKey );
+            Signaling_HmacSha256( pSigner->signingKey, SIGNALING_SHA256_DIGEST_LENGTH, pAwsRegion->pAwsRegion, pAwsRegion->awsRegionLength, pSigner->signingKey );
+            Signaling_HmacSha256( pSigner->signingKey, SIGNALING_SHA256_DIGEST_LENGTH, pService, serviceLength, pSigner->signingKey );
+            Signaling_HmacSha256( pSigner->signingKey, SIGNALING_SHA256_DIGEST_LENGTH, SIGNALING_SIGV4_TERMINATOR, SIGNALING_LITERAL_LENGTH( SIGNALING_SIGV4_TERMINATOR ), pSigner->signingKey );
+
+            memset( key, 0, sizeof( key ) );
+
+            memcpy( pSigner->date, pDate, sizeof( pSigner->date ) );
+            memcpy( pSigner->region, pAwsRegion->pAwsRegion, pAwsRegion->awsRegionLength );
+            pSigner->regionLength = pAwsRegion->awsRegionLength;
+            memcpy( pSigner->service, pService, serviceLength );
+            pSigner->serviceLength = serviceLength;
+            memcpy( pSigner->secretAccessKeyDigest, secretAccessKeyDigest, sizeof( secretAccessKeyDigest ) );
+            pSigner->isKeyCached = 1U;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t ValidateSigningParameters( const SignalingSigV4Signer_t * pSigner,
+                                                    const SignalingCredential_t * pCredential,
+                                                    const SignalingAwsRegion_t * pAwsRegion,
+                                                    const char * pService,
+                                                    size_t serviceLength,
+                                                    const char * pDate )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( ( pSigner == NULL ) ||
+        ( pCredential == NULL ) ||
+        ( pCredential->pSecretAccessKey == NULL ) ||
+        ( pAwsRegion == NULL ) ||
+        ( pAwsRegion->pAwsRegion == NULL ) ||
+        ( pService == NULL ) ||
+        ( serviceLength > SIGNALING_SIGV4_MAX_SERVICE_LENGTH ) ||
+        ( pDate == NULL ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( ( pDate[ 8 ] != 'T' ) || ( pDate[ 15 ] != 'Z' ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+    else if( pAwsRegion->awsRegionLength > SIGNALING_SIGV4_MAX_REGION_LENGTH )
+    {
+        result = SIGNALING_RESULT_REGION_LENGTH_TOO_LARGE;
+    }
+    else
+    {
+        /* All parameters are valid. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void ComputeSignature( const SignalingSigV4Signer_t * pSigner,
+                              const SignalingAwsRegion_t * pAwsRegion,
+                              const char * pService,
+                              size_t serviceLength,
+                              const char * pDate,
+                              const uint8_t * pCanonicalRequestHash,
+                              char * pSignature )
+{
+    HmacSha256_t hmac;
+    uint8_t signature[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    char hexDigest[ 2 * SIGNALING_SHA256_DIGEST_LENGTH ];
+
+    EncodeHex( pCanonicalRequestHash, SIGNALING_SHA256_DIGEST_LENGTH, hexDigest );
+
+    /* The string to sign is hashed as it is produced as well. */
+    HmacSha256Init( &( hmac ), pSigner->signingKey, SIGNALING_SHA256_DIGEST_LENGTH );
+    Signaling_Sha256Update( &( hmac.inner ), SIGNALING_SIGV4_ALGORITHM "\n", SIGNALING_LITERAL_LENGTH( SIGNALING_SIGV4_ALGORITHM "\n" ) );
+    Signaling_Sha256Update( &( hmac.inner ), pDate, SIGNALING_SIGV4_DATE_LENGTH );
+    Signaling_Sha256Update( &( hmac.inner ), "\n", 1 );
+    Signaling_Sha256Update( &( hmac.inner ), pDate, sizeof( pSigner->date ) );
+    Signaling_Sha256Update( &( hmac.inner ), "/", 1 );
+    Signaling_Sha256Update( &( hmac.inner ), pAwsRegion->pAwsRegion, pAwsRegion->awsRegionLength );
+    Signaling_Sha256Update( &( hmac.inner ), "/", 1 );
+    Signaling_Sha256Update( &( hmac.inner ), pService, serviceLength );
+    Signaling_Sha256Update( &( hmac.inner ), "/" SIGNALING_SIGV4_TERMINATOR "\n", SIGNALING_LITERAL_LENGTH( "/" SIGNALING_SIGV4_TERMINATOR "\n" ) );
+    Signaling_Sha256Update( &( hmac.inner ), hexDigest, sizeof( hexDigest ) );
+    HmacSha256Final( &( hmac ), signature );
+
+    EncodeHex( signature, SIGNALING_SHA256_DIGEST_LENGTH, pSignature );
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendToOutput( SigV4Output_t * pOutput,
+                            const char * pData,
+                            size_t dataLength )
+{
+    /* Keep room for the null terminator. */
+    if( ( pOutput->length + dataLength ) < pOutput->bufferLength )
+    {
+        memcpy( &( pOutput->pBuffer[ pOutput->length ] ), pData, dataLength );
+    }
+
+    pOutput->length += dataLength;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_SigV4Init( SignalingSigV4Signer_t * pSigner )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+
+    if( pSigner == NULL )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        memset( pSigner, 0, sizeof( SignalingSigV4Signer_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_SigV4SignRequest( SignalingSigV4Signer_t * pSigner,
+                                              const SignalingCredential_t * pCredential,
+                                              const SignalingAwsRegion_t * pAwsRegion,
+                                              const char * pService,
+                                              size_t serviceLength,
+                                              const char * pDate,
+                                              const SignalingSigV4Request_t * pRequest,
+                                              char * pAuthorization,
+                                              size_t * pAuthorizationLength )
+{
+    SignalingResult_t result = SIGNALING_RESULT_OK;
+    SignalingSha256_t sha256, payloadSha256;
+    SignalingSigV4Header_t hostHeader, dateHeader;
+    SignalingSigV4Header_t parameters[ SIGNALING_SIGV4_MAX_QUERY_PARAMETERS ];
+    const SignalingSigV4Header_t * pHeaders[ SIGNALING_SIGV4_MAX_HEADERS + 2 ];
+    const char * pPath = NULL, * pQuery = NULL;
+    size_t pathLength = 0, queryLength = 0, parameterCount = 0, headerCount = 0, i;
+    uint8_t digest[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    char hexDigest[ 2 * SIGNALING_SHA256_DIGEST_LENGTH ];
+    char signature[ SIGNALING_SIGV4_SIGNATURE_LENGTH ];
+    SigV4Output_t output;
+
+    result = ValidateSigningParameters( pSigner, pCredential, pAwsRegion, pService, serviceLength, pDate );
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( pCredential->pAccessKeyId == NULL ) ||
+          ( pRequest == NULL ) ||
+          ( pRequest->pMethod == NULL ) ||
+          ( pRequest->pUrl == NULL ) ||
+          ( ( pRequest->pPayloadHash == NULL ) && ( pRequest->pBody == NULL ) && ( pRequest->bodyLength != 0U ) ) ||
+          ( ( pRequest->pHeaders == NULL ) && ( pRequest->headerCount != 0U ) ) ||
+          ( pRequest->headerCount > SIGNALING_SIGV4_MAX_HEADERS ) ||
+          ( pAuthorization == NULL ) ||
+          ( pAuthorizationLength == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = Signaling_SplitUrl( pRequest->pUrl, pRequest->urlLength,
+                                     &( hostHeader.pValue ), &( hostHeader.valueLength ),
+                                     &( pPath ), &( pathLength ),
+                                     &( pQuery ), &( queryLength ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = SplitQuery( pQuery, queryLength, parameters, &( parameterCount ) );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = GetSigningKey( pSigner, pCredential, pAwsRegion, pService, serviceLength, pDate );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        SortQueryParameters( parameters, parameterCount );
+
+        hostHeader.pName = "host";
+        hostHeader.nameLength = SIGNALING_LITERAL_LENGTH( "host" );
+        dateHeader.pName = "x-amz-date";
+        dateHeader.nameLength = SIGNALING_LITERAL_LENGTH( "x-amz-date" );
+        dateHeader.pValue = pDate;
+        dateHeader.valueLength = SIGNALING_SIGV4_DATE_LENGTH;
+
+        pHeaders[ headerCount++ ] = &( hostHeader );
+        pHeaders[ headerCount++ ] = &( dateHeader );
+
+        for( i = 0; i < pRequest->headerCount; i++ )
+        {
+            pHeaders[ headerCount++ ] = &( pRequest->pHeaders[ i ] );
+        }
+
+        SortHeaders( pHeaders, headerCount );
+
+        /* The canonical request is hashed as it is produced, it is never
+         * stored. */
+        Signaling_Sha256Init( &( sha256 ) );
+        Signaling_Sha256Update( &( sha256 ), pRequest->pMethod, pRequest->methodLength );
+        Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+
+        if( pathLength == 0U )
+        {
+            Signaling_Sha256Update( &( sha256 ), "/", 1 );
+        }
+        else
+        {
+            Signaling_UriEncode( pPath, pathLength, 1U, Sha256UpdateSink, &( sha256 ) );
+        }
+
+        Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+
+        for( i = 0; i < parameterCount; i++ )
+        {
+            if( i > 0U )
+            {
+                Signaling_Sha256Update( &( sha256 ), "&", 1 );
+            }
+
+            Signaling_UriEncode( parameters[ i ].pName, parameters[ i ].nameLength, 0U, Sha256UpdateSink, &( sha256 ) );
+            Signaling_Sha256Update( &( sha256 ), "=", 1 );
+            Signaling_UriEncode( parameters[ i ].pValue, parameters[ i ].valueLength, 0U, Sha256UpdateSink, &( sha256 ) );
+        }
+
+        Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+
+        for( i = 0; i < headerCount; i++ )
+        {
+            Signaling_Sha256Update( &( sha256 ), pHeaders[ i ]->pName, pHeaders[ i ]->nameLength );
+            Signaling_Sha256Update( &( sha256 ), ":", 1 );
+            Signaling_Sha256Update( &( sha256 ), pHeaders[ i ]->pValue, pHeaders[ i ]->valueLength );
+            Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+        }
+
+        Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+
+        for( i = 0; i < headerCount; i++ )
+        {
+            if( i > 0U )
+            {
+                Signaling_Sha256Update( &( sha256 ), ";", 1 );
+            }
+
+            Signaling_Sha256Update( &( sha256 ), pHeaders[ i ]->pName, pHeaders[ i ]->nameLength );
+        }
+
+        Signaling_Sha256Update( &( sha256 ), "\n", 1 );
+
+        if( pRequest->pPayloadHash != NULL )
+        {
+            EncodeHex( pRequest->pPayloadHash, SIGNALING_SHA256_DIGEST_LENGTH, hexDigest );
+        }
+        else
+        {
+            /* The body goes through its own digest, the canonical request
+             * only holds its hex form. */
+            Signaling_Sha256Init( &( payloadSha256 ) );
+            Signaling_Sha256Update( &( payloadSha256 ), pRequest->pBody, pRequest->bodyLength );
+            Signaling_Sha256Final( &( payloadSha256 ), digest );
+            EncodeHex( digest, SIGNALING_SHA256_DIGEST_LENGTH, hexDigest );
+        }
+
+        Signaling_Sha256Update( &( sha256 ), hexDigest, sizeof( hexDigest ) );
+        Signaling_Sha256Final( &( sha256 ), digest );
+
+        ComputeSignature( pSigner, pAwsRegion, pService, serviceLength, pDate, digest, signature );
+
+        /* Authorization header value. */
+        output.pBuffer = pAuthorization;
+        output.bufferLength = *pAuthorizationLength;
+        output.length = 0;
+
+        AppendToOutput( &( output ), SIGNALING_SIGV4_ALGORITHM " Credential=", SIGNALING_LITERAL_LENGTH( SIGNALING_SIGV4_ALGORITHM " Credential=" ) );
+        AppendToOutput( &( output ), pCredential->pAccessKeyId, pCredential->accessKeyIdLength );
+        AppendToOutput( &( output ), "/", 1 );
+        AppendToOutput( &( output ), pDate, sizeof( pSigner->date ) );
+        AppendToOutput( &( output ), "/", 1 );
+        AppendToOutput( &( output ), pAwsRegion->pAwsRegion, pAwsRegion->awsRegionLength );
+        AppendToOutput( &( output ), "/", 1 );
+        AppendToOutput( &( output ), pService, serviceLength );
+        AppendToOutput( &( output ), "/" SIGNALING_SIGV4_TERMINATOR ", SignedHeaders=", SIGNALING_LITERAL_LENGTH( "/" SIGNALING_SIGV4_TERMINATOR ", SignedHeaders=" ) );
+
+        for( i = 0; i < headerCount; i++ )
+        {
+            if( i > 0U )
+            {
+                AppendToOutput( &( output ), ";", 1 );
+            }
+
+            AppendToOutput( &( output ), pHeaders[ i ]->pName, pHeaders[ i ]->nameLength );
+        }
+
+        AppendToOutput( &( output ), ", Signature=", SIGNALING_LITERAL_LENGTH( ", Signature=" ) );
+        AppendToOutput( &( output ), signature, sizeof( signature ) );
+
+        if( output.length >= output.bufferLength )
+        {
+            result = SIGNALING_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            pAuthorization[ output.length ] = '\0';
+            *pAuthorizationLength = output.length;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+SignalingResult_t Signaling_SigV4Sign( SignalingSigV4Signer_t * pSigner,
+                                       const SignalingCredential_t * pCredential,
+                                       const SignalingAwsRegion_t * pAwsRegion,
+                                       const char * pService,
+                                       size_t serviceLength,
+                                       const char * pDate,
+                                       const uint8_t * pCanonicalRequestHash,
+                                       char * pSignature )
+{
+    SignalingResult_t result;
+
+    result = ValidateSigningParameters( pSigner, pCredential, pAwsRegion, pService, serviceLength, pDate );
+
+    if( ( result == SIGNALING_RESULT_OK ) &&
+        ( ( pCanonicalRequestHash == NULL ) ||
+          ( pSignature == NULL ) ) )
+    {
+        result = SIGNALING_RESULT_BAD_PARAM;
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        result = GetSigningKey( pSigner, pCredential, pAwsRegion, pService, serviceLength, pDate );
+    }
+
+    if( result == SIGNALING_RESULT_OK )
+    {
+        ComputeSignature( pSigner, pAwsRegion, pService, serviceLength, pDate, pCanonicalRequestHash, pSignature );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
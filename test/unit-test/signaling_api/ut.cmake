@@ -30,6 +30,7 @@ list(APPEND mock_define_list
 # List the files you would like to test here.
 list(APPEND real_source_files
             ${MODULE_ROOT_DIR}/source/signaling_api.c
+            ${MODULE_ROOT_DIR}/source/signaling_sigv4.c
             ${JSON_SOURCES}
         )
 # List the directories the module under test includes.
@@ -85,3 +86,28 @@ create_test(${utest_name}
             "${utest_dep_list}"
             "${test_include_directories}"
         )
+
+# Run the same tests against a build that trusts the control plane responses.
+set(trusted_real_name "${project_name}_trusted_real")
+set(trusted_utest_name "${project_name}_trusted_utest")
+
+create_real_library(${trusted_real_name}
+                    "${real_source_files}"
+                    "${real_include_directories}"
+                    "${mock_name}"
+        )
+
+target_compile_definitions(${trusted_real_name} PRIVATE
+                           SIGNALING_TRUST_CONTROL_PLANE_RESPONSES
+        )
+
+create_test(${trusted_utest_name}
+            ${utest_source}
+            "lib${trusted_real_name}.a"
+            "${trusted_real_name}"
+            "${test_include_directories}"
+        )
+
+target_compile_definitions(${trusted_utest_name} PRIVATE
+                           SIGNALING_TRUST_CONTROL_PLANE_RESPONSES
+        )
@@ -0,0 +1,826 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* API includes. */
+#include "signaling_bootstrap.h"
+
+/* ===========================  EXTERN VARIABLES    =========================== */
+
+#define TEST_REGION             "us-west-2"
+#define TEST_CHANNEL_NAME       "test-channel"
+#define TEST_CHANNEL_ARN        "arn:aws:kinesisvideo:us-west-2:123456789012:channel/test-channel/1234567890123"
+#define TEST_CLIENT_ID          "ProducerMaster"
+#define TEST_WSS_ENDPOINT       "wss://m-1234abcd.kinesisvideo.us-west-2.amazonaws.com"
+#define TEST_HTTPS_ENDPOINT     "https://r-1234abcd.kinesisvideo.us-west-2.amazonaws.com"
+
+#define TEST_BUFFER_LENGTH      ( 1024 )
+
+/* The strings of the ICE server the server responds with, copied by the bootstrap. */
+#define TEST_ICE_SERVER_STRINGS_LENGTH \
+    ( strlen( "password123" ) + strlen( "turn:example.com:3478" ) + strlen( "username123" ) )
+
+/* The scripted stand-in for the control plane. Each call takes the latency of
+ * its step, in simulated milliseconds, and gets a recorded response. A created
+ * channel exists from then on, and the next notActiveLeft descriptions give
+ * pNotActiveStatus. */
+typedef struct TestServer
+{
+    uint32_t latencyMs[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+    uint8_t channelExists;
+    uint32_t notActiveLeft;
+    const char * pNotActiveStatus;
+    SignalingResult_t expectedResult;
+    uint32_t failuresLeft[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+    uint32_t requestCount[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+    uint32_t doneAtMs[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+} TestServer_t;
+
+/* ===========================  EXTERN FUNCTIONS   =========================== */
+
+static void InitBootstrapInfo( SignalingBootstrapInfo_t * pInfo )
+{
+    memset( pInfo, 0, sizeof( SignalingBootstrapInfo_t ) );
+    pInfo->awsRegion.pAwsRegion = TEST_REGION;
+    pInfo->awsRegion.awsRegionLength = strlen( TEST_REGION );
+    pInfo->channelName.pChannelName = TEST_CHANNEL_NAME;
+    pInfo->channelName.channelNameLength = strlen( TEST_CHANNEL_NAME );
+    pInfo->role = SIGNALING_ROLE_MASTER;
+    pInfo->pClientId = TEST_CLIENT_ID;
+    pInfo->clientIdLength = strlen( TEST_CLIENT_ID );
+    pInfo->createChannel = 1;
+    pInfo->messageTtlSeconds = 60;
+    pInfo->getIceServerConfig = 1;
+}
+
+/*-----------------------------------------------------------*/
+
+static void InitServer( TestServer_t * pServer )
+{
+    memset( pServer, 0, sizeof( TestServer_t ) );
+    pServer->latencyMs[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] = 80;
+    pServer->latencyMs[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] = 120;
+    pServer->latencyMs[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] = 60;
+    pServer->latencyMs[ SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS ] = 150;
+    pServer->latencyMs[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] = 70;
+    pServer->channelExists = 1;
+    pServer->pNotActiveStatus = "CREATING";
+}
+
+/*-----------------------------------------------------------*/
+
+/* Check the request of a step, and give the recorded response to it. */
+static void Respond( TestServer_t * pServer,
+                     SignalingBootstrapStep_t step,
+                     const SignalingRequest_t * pRequest,
+                     uint16_t * pStatusCode,
+                     const char ** ppBody )
+{
+    static const char * pExpectedUrls[ SIGNALING_BOOTSTRAP_STEP_MAX ] =
+    {
+        "https://kinesisvideo.us-west-2.amazonaws.com/describeSignalingChannel",
+        "https://kinesisvideo.us-west-2.amazonaws.com/createSignalingChannel",
+        "https://kinesisvideo.us-west-2.amazonaws.com/getSignalingChannelEndpoint",
+        TEST_WSS_ENDPOINT "?X-Amz-ChannelARN=",
+        TEST_HTTPS_ENDPOINT "/v1/get-ice-server-config",
+    };
+    static char describeBody[ TEST_BUFFER_LENGTH ];
+    const char * pChannelStatus = "ACTIVE";
+
+    TEST_ASSERT_EQUAL_STRING_LEN( pExpectedUrls[ step ],
+                                  pRequest->pUrl,
+                                  strlen( pExpectedUrls[ step ] ) );
+
+    pServer->requestCount[ step ]++;
+    *pStatusCode = 200;
+    *ppBody = "";
+    pServer->expectedResult = SIGNALING_RESULT_OK;
+
+    if( pServer->failuresLeft[ step ] > 0 )
+    {
+        pServer->failuresLeft[ step ]--;
+        *pStatusCode = 500;
+        *ppBody = "{\"Message\":\"Internal error.\"}";
+        pServer->expectedResult = SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS;
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL )
+    {
+        if( pServer->channelExists != 0 )
+        {
+            if( pServer->notActiveLeft > 0 )
+            {
+                pServer->notActiveLeft--;
+                pChannelStatus = pServer->pNotActiveStatus;
+                pServer->expectedResult = SIGNALING_RESULT_CHANNEL_NOT_ACTIVE;
+            }
+
+            snprintf( describeBody,
+                      sizeof( describeBody ),
+                      "{\"ChannelInfo\":{\"ChannelARN\":\"" TEST_CHANNEL_ARN "\",\"ChannelName\":\"" TEST_CHANNEL_NAME "\","
+                      "\"ChannelStatus\":\"%s\",\"ChannelType\":\"SINGLE_MASTER\",\"CreationTime\":\"2023-05-01T12:00:00Z\","
+                      "\"SingleMasterConfiguration\":{\"MessageTtlSeconds\":60},\"Version\":\"1\"}}",
+                      pChannelStatus );
+            *ppBody = describeBody;
+        }
+        else
+        {
+            *pStatusCode = 404;
+            *ppBody = "{\"Message\":\"The requested channel is not found or not active.\"}";
+        }
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL )
+    {
+        pServer->channelExists = 1;
+        *ppBody = "{\"ChannelARN\":\"" TEST_CHANNEL_ARN "\"}";
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT )
+    {
+        TEST_ASSERT_NOT_NULL( strstr( pRequest->pBody, TEST_CHANNEL_ARN ) );
+        *ppBody = "{\"ResourceEndpointList\":["
+                  "{\"Protocol\":\"WSS\",\"ResourceEndpoint\":\"" TEST_WSS_ENDPOINT "\"},"
+                  "{\"Protocol\":\"HTTPS\",\"ResourceEndpoint\":\"" TEST_HTTPS_ENDPOINT "\"}]}";
+    }
+    else if( step == SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS )
+    {
+        *pStatusCode = 101;
+    }
+    else
+    {
+        *ppBody = "{\"IceServerList\":[{\"Password\":\"password123\",\"Ttl\":300,"
+                  "\"Uris\":[\"turn:example.com:3478\"],\"Username\":\"username123\"}]}";
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Run a bootstrap against the server on a simulated clock: every ready call is
+ * sent at once, and the clock jumps to the next response. Returns the time the
+ * bootstrap completes. */
+static uint32_t RunBootstrap( SignalingBootstrap_t * pBootstrap,
+                              TestServer_t * pServer )
+{
+    char urlBuffers[ SIGNALING_BOOTSTRAP_STEP_MAX ][ TEST_BUFFER_LENGTH ];
+    char bodyBuffers[ SIGNALING_BOOTSTRAP_STEP_MAX ][ TEST_BUFFER_LENGTH ];
+    char url[ TEST_BUFFER_LENGTH ], body[ TEST_BUFFER_LENGTH ];
+    char responseBody[ TEST_BUFFER_LENGTH ];
+    SignalingRequest_t requests[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+    uint32_t responseAtMs[ SIGNALING_BOOTSTRAP_STEP_MAX ];
+    uint8_t isInFlight[ SIGNALING_BOOTSTRAP_STEP_MAX ] = { 0 };
+    SignalingBootstrapStep_t step;
+    SignalingResult_t result;
+    uint32_t nowMs = 0;
+    uint16_t statusCode;
+    const char * pBody;
+    size_t i;
+
+    while( pBootstrap->isComplete == 0U )
+    {
+        do
+        {
+            SignalingRequest_t request;
+
+            request.pUrl = url;
+            request.urlLength = TEST_BUFFER_LENGTH;
+            request.pBody = body;
+            request.bodyLength = TEST_BUFFER_LENGTH;
+
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_BootstrapNextRequest( pBootstrap,
+                                                               &( step ),
+                                                               &( request ) ) );
+
+            if( step != SIGNALING_BOOTSTRAP_STEP_NONE )
+            {
+                TEST_ASSERT_EQUAL( 0, isInFlight[ step ] );
+                memcpy( urlBuffers[ step ], url, TEST_BUFFER_LENGTH );
+                memcpy( bodyBuffers[ step ], body, TEST_BUFFER_LENGTH );
+                requests[ step ] = request;
+                requests[ step ].pUrl = urlBuffers[ step ];
+                requests[ step ].pBody = bodyBuffers[ step ];
+                isInFlight[ step ] = 1;
+                responseAtMs[ step ] = nowMs + pServer->latencyMs[ step ];
+            }
+        } while( step != SIGNALING_BOOTSTRAP_STEP_NONE );
+
+        /* The next response to arrive. */
+        for( i = 0; i < SIGNALING_BOOTSTRAP_STEP_MAX; i++ )
+        {
+            if( ( isInFlight[ i ] != 0 ) &&
+                ( ( step == SIGNALING_BOOTSTRAP_STEP_NONE ) || ( responseAtMs[ i ] < responseAtMs[ step ] ) ) )
+            {
+                step = ( SignalingBootstrapStep_t ) i;
+            }
+        }
+
+        TEST_ASSERT_TRUE( step != SIGNALING_BOOTSTRAP_STEP_NONE );
+        nowMs = responseAtMs[ step ];
+        isInFlight[ step ] = 0;
+
+        /* Every response is received into the same buffer, overwritten once fed. */
+        Respond( pServer, step, &( requests[ step ] ), &( statusCode ), &( pBody ) );
+        TEST_ASSERT_TRUE( strlen( pBody ) < sizeof( responseBody ) );
+        memcpy( responseBody, pBody, strlen( pBody ) );
+        result = Signaling_BootstrapFeedResponse( pBootstrap,
+                                                  step,
+                                                  statusCode,
+                                                  responseBody,
+                                                  strlen( pBody ) );
+        memset( responseBody, '#', sizeof( responseBody ) );
+
+        TEST_ASSERT_EQUAL( pServer->expectedResult,
+                           result );
+
+        if( result == SIGNALING_RESULT_OK )
+        {
+            pServer->doneAtMs[ step ] = nowMs;
+        }
+    }
+
+    return nowMs;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate bootstrap behavior with bad parameters.
+ */
+void test_signaling_Bootstrap_BadParams( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    SignalingBootstrapStep_t step;
+    SignalingRequest_t request = { 0 };
+    char buffer[ TEST_BUFFER_LENGTH ];
+
+    InitBootstrapInfo( &( info ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapInit( NULL, &( info ), buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapInit( &( bootstrap ), NULL, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), NULL, sizeof( buffer ) ) );
+
+    info.role = SIGNALING_ROLE_NONE;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    InitBootstrapInfo( &( info ) );
+    info.channelName.pChannelName = NULL;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    InitBootstrapInfo( &( info ) );
+    info.pClientId = NULL;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    InitBootstrapInfo( &( info ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapNextRequest( NULL, &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), NULL, &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), NULL ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapFeedResponse( NULL, SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL, 200, "{}", 2 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), SIGNALING_BOOTSTRAP_STEP_NONE, 200, "{}", 2 ) );
+
+    /* Not in flight. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL, 200, "{}", 2 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS, 101, NULL, 0 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that ConnectWssEndpoint and GetIceServerConfig are sent together once
+ *        the endpoints are known, and the time each phase completes on a cold start.
+ */
+void test_signaling_Bootstrap_PipelinedColdStart( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    TestServer_t server;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    uint32_t sequentialMs = 0;
+    size_t i;
+
+    InitBootstrapInfo( &( info ) );
+    InitServer( &( server ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    /* Describe 80, endpoints 60, then the websocket 150 while the ICE servers take 70. */
+    TEST_ASSERT_EQUAL( 290,
+                       RunBootstrap( &( bootstrap ), &( server ) ) );
+    TEST_ASSERT_EQUAL( 80, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( 140, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+    TEST_ASSERT_EQUAL( 210, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] );
+    TEST_ASSERT_EQUAL( 290, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS ] );
+
+    /* One after another, it would have taken every latency but the skipped create. */
+    for( i = 0; i < SIGNALING_BOOTSTRAP_STEP_MAX; i++ )
+    {
+        sequentialMs += ( i == SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ) ? 0 : server.latencyMs[ i ];
+    }
+
+    TEST_ASSERT_EQUAL( 360, sequentialMs );
+    TEST_ASSERT_EQUAL( 0, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_SKIPPED,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+
+    /* The results were copied out of the response bodies. */
+    TEST_ASSERT_TRUE( ( bootstrap.channelArn.pChannelArn >= buffer ) &&
+                      ( bootstrap.channelArn.pChannelArn < &( buffer[ sizeof( buffer ) ] ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( TEST_CHANNEL_ARN,
+                                  bootstrap.channelArn.pChannelArn,
+                                  bootstrap.channelArn.channelArnLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( TEST_WSS_ENDPOINT,
+                                  bootstrap.endpoints.wssEndpoint.pEndpoint,
+                                  bootstrap.endpoints.wssEndpoint.endpointLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( TEST_HTTPS_ENDPOINT,
+                                  bootstrap.endpoints.httpsEndpoint.pEndpoint,
+                                  bootstrap.endpoints.httpsEndpoint.endpointLength );
+    TEST_ASSERT_EQUAL( 1, bootstrap.iceServerCount );
+    TEST_ASSERT_EQUAL( 300, bootstrap.iceServers[ 0 ].messageTtlSeconds );
+    TEST_ASSERT_EQUAL_STRING_LEN( "username123",
+                                  bootstrap.iceServers[ 0 ].pUserName,
+                                  bootstrap.iceServers[ 0 ].userNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "password123",
+                                  bootstrap.iceServers[ 0 ].pPassword,
+                                  bootstrap.iceServers[ 0 ].passwordLength );
+    TEST_ASSERT_EQUAL( 1, bootstrap.iceServers[ 0 ].urisNum );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turn:example.com:3478",
+                                  bootstrap.iceServers[ 0 ].pUris[ 0 ],
+                                  bootstrap.iceServers[ 0 ].urisLength[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a channel that does not exist is created, and described again
+ *        until it is ACTIVE before its endpoints are asked for.
+ */
+void test_signaling_Bootstrap_CreateChannel( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    TestServer_t server;
+    char buffer[ TEST_BUFFER_LENGTH ];
+
+    InitBootstrapInfo( &( info ) );
+    InitServer( &( server ) );
+    server.channelExists = 0;
+    server.notActiveLeft = 2;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    /* Describe 80, create 120, describe twice CREATING and once ACTIVE, then the
+     * endpoints 60 and the websocket 150. */
+    TEST_ASSERT_EQUAL( 650,
+                       RunBootstrap( &( bootstrap ), &( server ) ) );
+    TEST_ASSERT_EQUAL( 200, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( 440, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( 500, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+    TEST_ASSERT_EQUAL( 1, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( 4, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_DONE,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+    TEST_ASSERT_EQUAL_STRING_LEN( TEST_CHANNEL_ARN,
+                                  bootstrap.channelArn.pChannelArn,
+                                  bootstrap.channelArn.channelArnLength );
+
+    /* The ARN was copied once, from the create response. */
+    TEST_ASSERT_EQUAL( bootstrap.channelArn.channelArnLength + strlen( TEST_WSS_ENDPOINT ) + strlen( TEST_HTTPS_ENDPOINT ) +
+                       TEST_ICE_SERVER_STRINGS_LENGTH,
+                       bootstrap.bufferUsed );
+
+    /* Without createChannel, a missing channel is an error. */
+    info.createChannel = 0;
+    InitServer( &( server ) );
+    server.channelExists = 0;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+    {
+        SignalingBootstrapStep_t step;
+        SignalingRequest_t request;
+        char url[ TEST_BUFFER_LENGTH ], body[ TEST_BUFFER_LENGTH ];
+
+        request.pUrl = url;
+        request.urlLength = sizeof( url );
+        request.pBody = body;
+        request.bodyLength = sizeof( body );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+        TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL, step );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS,
+                           Signaling_BootstrapFeedResponse( &( bootstrap ), step, 404, "{}", 2 ) );
+        TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_WAITING,
+                           bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the endpoints of a channel are not asked for while it is not ACTIVE,
+ *        and that a channel just created and not found yet is not created again.
+ */
+void test_signaling_Bootstrap_ChannelNotActive( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    SignalingBootstrapStep_t step;
+    SignalingRequest_t request;
+    TestServer_t server;
+    char buffer[ TEST_BUFFER_LENGTH ], url[ TEST_BUFFER_LENGTH ], body[ TEST_BUFFER_LENGTH ];
+    const char * pCreated = "{\"ChannelARN\":\"" TEST_CHANNEL_ARN "\"}";
+    const char * pNoStatus = "{\"ChannelInfo\":{\"ChannelARN\":\"" TEST_CHANNEL_ARN "\"}}";
+
+    InitBootstrapInfo( &( info ) );
+    InitServer( &( server ) );
+    server.notActiveLeft = 2;
+    server.pNotActiveStatus = "DELETING";
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    /* An existing channel that is not ACTIVE is not created either. */
+    TEST_ASSERT_EQUAL( 450,
+                       RunBootstrap( &( bootstrap ), &( server ) ) );
+    TEST_ASSERT_EQUAL( 3, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( 300, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+    TEST_ASSERT_EQUAL( 0, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+
+    /* Only the ARN of the ACTIVE channel was kept. */
+    TEST_ASSERT_EQUAL( bootstrap.channelArn.channelArnLength + strlen( TEST_WSS_ENDPOINT ) + strlen( TEST_HTTPS_ENDPOINT ) +
+                       TEST_ICE_SERVER_STRINGS_LENGTH,
+                       bootstrap.bufferUsed );
+
+    InitServer( &( server ) );
+    server.notActiveLeft = 1;
+    server.pNotActiveStatus = "UPDATING";
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 370,
+                       RunBootstrap( &( bootstrap ), &( server ) ) );
+    TEST_ASSERT_EQUAL( 2, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+
+    /* A missing status is not ACTIVE. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+    request.pUrl = url;
+    request.urlLength = sizeof( url );
+    request.pBody = body;
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_ACTIVE,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, pNoStatus, strlen( pNoStatus ) ) );
+    TEST_ASSERT_EQUAL( 0, bootstrap.bufferUsed );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_WAITING,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+
+    /* Created, then not found yet: described again, not created again. */
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 404, "{}", 2 ) );
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, pCreated, strlen( pCreated ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_WAITING,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_ACTIVE,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 404, "{}", 2 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_DONE,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_CREATE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_READY,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a known channel ARN skips the channel calls, and that the ICE
+ *        server configuration can be left out.
+ */
+void test_signaling_Bootstrap_KnownChannelArn( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    TestServer_t server;
+    char buffer[ TEST_BUFFER_LENGTH ];
+
+    InitBootstrapInfo( &( info ) );
+    info.channelName.pChannelName = NULL;
+    info.channelArn.pChannelArn = TEST_CHANNEL_ARN;
+    info.channelArn.channelArnLength = strlen( TEST_CHANNEL_ARN );
+    info.getIceServerConfig = 0;
+    InitServer( &( server ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    TEST_ASSERT_EQUAL( 210,
+                       RunBootstrap( &( bootstrap ), &( server ) ) );
+    TEST_ASSERT_EQUAL( 0, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_DESCRIBE_CHANNEL ] );
+    TEST_ASSERT_EQUAL( 0, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] );
+    TEST_ASSERT_EQUAL( 0, bootstrap.iceServerCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a failed call is ready again to be retried, while the other
+ *        calls go on.
+ */
+void test_signaling_Bootstrap_Retry( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    TestServer_t server;
+    char buffer[ TEST_BUFFER_LENGTH ];
+
+    InitBootstrapInfo( &( info ) );
+    InitServer( &( server ) );
+    server.failuresLeft[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] = 2;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    /* The ICE servers are only known at 140 + 3 * 70. */
+    TEST_ASSERT_EQUAL( 350,
+                       RunBootstrap( &( bootstrap ), &( server ) ) );
+    TEST_ASSERT_EQUAL( 3, server.requestCount[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] );
+    TEST_ASSERT_EQUAL( 290, server.doneAtMs[ SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a size query leaves the call ready, and that the connect URL is
+ *        presigned when asked to.
+ */
+void test_signaling_Bootstrap_SizeQueryAndPresign( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    SignalingBootstrapStep_t step;
+    SignalingRequest_t request;
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4PresignInfo_t presignInfo;
+    char buffer[ TEST_BUFFER_LENGTH ], url[ TEST_BUFFER_LENGTH ], body[ TEST_BUFFER_LENGTH ];
+    const char * pEndpoints = "{\"ResourceEndpointList\":[{\"Protocol\":\"WSS\",\"ResourceEndpoint\":\"" TEST_WSS_ENDPOINT "\"}]}";
+
+    memset( &( credential ), 0, sizeof( credential ) );
+    credential.pAccessKeyId = "AKIDEXAMPLE";
+    credential.accessKeyIdLength = strlen( "AKIDEXAMPLE" );
+    credential.pSecretAccessKey = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+    credential.secretAccessKeyLength = strlen( "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY" );
+    awsRegion.pAwsRegion = TEST_REGION;
+    awsRegion.awsRegionLength = strlen( TEST_REGION );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    presignInfo.pSigner = &( signer );
+    presignInfo.pCredential = &( credential );
+    presignInfo.pAwsRegion = &( awsRegion );
+    presignInfo.pDate = "20150830T123600Z";
+    presignInfo.expiresSeconds = 300;
+
+    InitBootstrapInfo( &( info ) );
+    info.channelArn.pChannelArn = TEST_CHANNEL_ARN;
+    info.channelArn.channelArnLength = strlen( TEST_CHANNEL_ARN );
+    info.getIceServerConfig = 0;
+    info.pPresignInfo = &( presignInfo );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    memset( &( request ), 0, sizeof( request ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT, step );
+    TEST_ASSERT_TRUE( request.urlLength > 0 );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_READY,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+
+    /* Too small a buffer leaves the call ready too. */
+    request.pUrl = url;
+    request.urlLength = 4;
+    request.pBody = body;
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_READY,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+
+    request.urlLength = sizeof( url );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT, step );
+
+    /* Nothing else is ready until the endpoints are known. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_NONE, step );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ),
+                                                        SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT,
+                                                        200,
+                                                        pEndpoints,
+                                                        strlen( pEndpoints ) ) );
+
+    request.pUrl = url;
+    request.urlLength = sizeof( url );
+    request.pBody = body;
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS, step );
+    TEST_ASSERT_NOT_NULL( strstr( url, "&X-Amz-Signature=" ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_UNEXPECTED_HTTP_STATUS,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 403, NULL, 0 ) );
+    TEST_ASSERT_EQUAL( 0, bootstrap.isComplete );
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 101, NULL, 0 ) );
+    TEST_ASSERT_EQUAL( 1, bootstrap.isComplete );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate bootstrap behavior with unusable responses.
+ */
+void test_signaling_Bootstrap_BadResponses( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    SignalingBootstrapStep_t step;
+    SignalingRequest_t request;
+    char buffer[ 100 ], url[ TEST_BUFFER_LENGTH ], body[ TEST_BUFFER_LENGTH ];
+    const char * pWssOnly = "{\"ResourceEndpointList\":[{\"Protocol\":\"WSS\",\"ResourceEndpoint\":\"" TEST_WSS_ENDPOINT "\"}]}";
+    const char * pEndpoints = "{\"ResourceEndpointList\":["
+                              "{\"Protocol\":\"WSS\",\"ResourceEndpoint\":\"" TEST_WSS_ENDPOINT "\"},"
+                              "{\"Protocol\":\"HTTPS\",\"ResourceEndpoint\":\"" TEST_HTTPS_ENDPOINT "\"}]}";
+
+    InitBootstrapInfo( &( info ) );
+    info.channelArn.pChannelArn = TEST_CHANNEL_ARN;
+    info.channelArn.channelArnLength = strlen( TEST_CHANNEL_ARN );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, sizeof( buffer ) ) );
+
+    request.pUrl = url;
+    request.urlLength = sizeof( url );
+    request.pBody = body;
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT, step );
+
+    /* Not JSON. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_JSON,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, "{", 1 ) );
+
+    /* GetIceServerConfig needs the HTTPS endpoint. */
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_ENDPOINT,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, pWssOnly, strlen( pWssOnly ) ) );
+
+    /* Both endpoints don't fit in the buffer, nothing is kept. */
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, pEndpoints, strlen( pEndpoints ) ) );
+    TEST_ASSERT_EQUAL( 0, bootstrap.bufferUsed );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_READY,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT ] );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_WAITING,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the ICE servers are copied out of the response body, and that
+ *        nothing is kept when they don't fit in the buffer.
+ */
+void test_signaling_Bootstrap_IceServersCopied( void )
+{
+    SignalingBootstrap_t bootstrap;
+    SignalingBootstrapInfo_t info;
+    SignalingBootstrapStep_t step;
+    SignalingRequest_t request;
+    char buffer[ 256 ], url[ TEST_BUFFER_LENGTH ], body[ TEST_BUFFER_LENGTH ], response[ TEST_BUFFER_LENGTH ];
+    const char * pEndpoints = "{\"ResourceEndpointList\":["
+                              "{\"Protocol\":\"WSS\",\"ResourceEndpoint\":\"" TEST_WSS_ENDPOINT "\"},"
+                              "{\"Protocol\":\"HTTPS\",\"ResourceEndpoint\":\"" TEST_HTTPS_ENDPOINT "\"}]}";
+    const char * pIceServers = "{\"IceServerList\":[{\"Password\":\"password123\",\"Ttl\":300,"
+                               "\"Uris\":[\"turn:example.com:3478\",\"turns:example.com:443\"],\"Username\":\"username123\"},"
+                               "{\"Password\":\"password456\",\"Ttl\":200,"
+                               "\"Uris\":[\"turn:example.net:3478\"],\"Username\":\"username456\"}]}";
+    size_t endpointsUsed, iceServersLength;
+
+    InitBootstrapInfo( &( info ) );
+    info.channelArn.pChannelArn = TEST_CHANNEL_ARN;
+    info.channelArn.channelArnLength = strlen( TEST_CHANNEL_ARN );
+    iceServersLength = strlen( "password123" ) + strlen( "turn:example.com:3478" ) + strlen( "turns:example.com:443" ) +
+                       strlen( "username123" ) + strlen( "password456" ) + strlen( "turn:example.net:3478" ) +
+                       strlen( "username456" );
+    endpointsUsed = strlen( TEST_WSS_ENDPOINT ) + strlen( TEST_HTTPS_ENDPOINT );
+    TEST_ASSERT_TRUE( endpointsUsed + iceServersLength <= sizeof( buffer ) );
+
+    /* Room for the endpoints and all but the last byte of the ICE servers. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapInit( &( bootstrap ), &( info ), buffer, endpointsUsed + iceServersLength - 1U ) );
+
+    request.pUrl = url;
+    request.urlLength = sizeof( url );
+    request.pBody = body;
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_GET_ENDPOINT, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, pEndpoints, strlen( pEndpoints ) ) );
+    TEST_ASSERT_EQUAL( endpointsUsed, bootstrap.bufferUsed );
+
+    do
+    {
+        request.urlLength = sizeof( url );
+        request.bodyLength = sizeof( body );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    } while( step == SIGNALING_BOOTSTRAP_STEP_CONNECT_WSS );
+
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG, step );
+    memcpy( response, pIceServers, strlen( pIceServers ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, response, strlen( pIceServers ) ) );
+    TEST_ASSERT_EQUAL( endpointsUsed, bootstrap.bufferUsed );
+    TEST_ASSERT_EQUAL( 0, bootstrap.iceServerCount );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_STATE_READY,
+                       bootstrap.stepStates[ SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG ] );
+
+    /* With one more byte, they fit, and outlive the response. */
+    bootstrap.bufferLength++;
+    request.urlLength = sizeof( url );
+    request.bodyLength = sizeof( body );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapNextRequest( &( bootstrap ), &( step ), &( request ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_BOOTSTRAP_STEP_GET_ICE_SERVER_CONFIG, step );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_BootstrapFeedResponse( &( bootstrap ), step, 200, response, strlen( pIceServers ) ) );
+    memset( response, '#', sizeof( response ) );
+
+    TEST_ASSERT_EQUAL( endpointsUsed + iceServersLength, bootstrap.bufferUsed );
+    TEST_ASSERT_EQUAL( 2, bootstrap.iceServerCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "username123", bootstrap.iceServers[ 0 ].pUserName, bootstrap.iceServers[ 0 ].userNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "password123", bootstrap.iceServers[ 0 ].pPassword, bootstrap.iceServers[ 0 ].passwordLength );
+    TEST_ASSERT_EQUAL( 2, bootstrap.iceServers[ 0 ].urisNum );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turn:example.com:3478", bootstrap.iceServers[ 0 ].pUris[ 0 ], bootstrap.iceServers[ 0 ].urisLength[ 0 ] );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turns:example.com:443", bootstrap.iceServers[ 0 ].pUris[ 1 ], bootstrap.iceServers[ 0 ].urisLength[ 1 ] );
+    TEST_ASSERT_EQUAL( 300, bootstrap.iceServers[ 0 ].messageTtlSeconds );
+    TEST_ASSERT_EQUAL_STRING_LEN( "username456", bootstrap.iceServers[ 1 ].pUserName, bootstrap.iceServers[ 1 ].userNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "password456", bootstrap.iceServers[ 1 ].pPassword, bootstrap.iceServers[ 1 ].passwordLength );
+    TEST_ASSERT_EQUAL( 1, bootstrap.iceServers[ 1 ].urisNum );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turn:example.net:3478", bootstrap.iceServers[ 1 ].pUris[ 0 ], bootstrap.iceServers[ 1 ].urisLength[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
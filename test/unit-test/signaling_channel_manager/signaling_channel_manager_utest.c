@@ -0,0 +1,554 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* API includes. */
+#include "signaling_channel_manager.h"
+
+/* ===========================  EXTERN VARIABLES    =========================== */
+
+#define TEST_ARN_PREFIX              "arn:aws:kinesisvideo:us-west-2:123456789012:channel/"
+#define TEST_ARN_MAX_LENGTH          ( 96 )
+#define TEST_SHARD_COUNT             ( 8 )
+#define TEST_MAX_CHANNELS            ( 100000 )
+
+/* Enough for TEST_MAX_CHANNELS with uneven shards: 32768 slots per shard. */
+#define TEST_MAX_SLOTS               ( 262144 )
+
+#define TEST_CHURN_ARN_COUNT         ( 2000 )
+#define TEST_CHURN_OPERATION_COUNT   ( 400000 )
+
+static SignalingManagedChannel_t slots[ TEST_MAX_SLOTS ];
+static char arns[ TEST_MAX_CHANNELS ][ TEST_ARN_MAX_LENGTH ];
+static SignalingChannelArn_t channelArns[ TEST_MAX_CHANNELS ];
+
+/* ===========================  EXTERN FUNCTIONS   =========================== */
+
+static void InitChannelArns( size_t channelCount )
+{
+    size_t i;
+
+    for( i = 0; i < channelCount; i++ )
+    {
+        channelArns[ i ].pChannelArn = arns[ i ];
+        channelArns[ i ].channelArnLength = ( size_t ) snprintf( arns[ i ],
+                                                                 TEST_ARN_MAX_LENGTH,
+                                                                 TEST_ARN_PREFIX "channel-%u/1234567890123",
+                                                                 ( unsigned ) i );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void InitChannelName( SignalingChannelName_t * pChannelName,
+                             const char * pName )
+{
+    pChannelName->pChannelName = pName;
+    pChannelName->channelNameLength = strlen( pName );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate channel manager behavior with bad parameters.
+ */
+void test_signaling_ChannelManager_BadParams( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel;
+    SignalingChannelName_t channelName, nullName = { 0 };
+    SignalingChannelArn_t nullArn = { 0 };
+    WssRecvMessage_t message;
+    size_t shardIndex;
+
+    InitChannelArns( 1 );
+    InitChannelName( &( channelName ), "channel-0" );
+    memset( &( message ), 0, sizeof( message ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerInit( NULL, slots, 8, 1 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerInit( &( manager ), NULL, 8, 1 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 8, 0 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 1024, SIGNALING_CHANNEL_MANAGER_MAX_SHARDS + 1 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 3, 4 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 8, 1 ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerShardOf( NULL, &( channelArns[ 0 ] ), NULL, &( shardIndex ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerShardOf( &( manager ), &( channelArns[ 0 ] ), NULL, NULL ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerShardOf( &( manager ), &( nullArn ), NULL, &( shardIndex ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerShardOf( &( manager ), NULL, NULL, &( shardIndex ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerShardOf( &( manager ), NULL, &( nullName ), &( shardIndex ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerAdd( NULL, &( channelArns[ 0 ] ), NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerAdd( &( manager ), NULL, NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerAdd( &( manager ), &( nullArn ), NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ 0 ] ), NULL, NULL ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRemove( NULL, &( channelArns[ 0 ] ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRemove( &( manager ), NULL ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRemove( &( manager ), &( nullArn ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerFind( NULL, NULL, &( channelName ), &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerFind( &( manager ), NULL, &( channelName ), NULL ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerFind( &( manager ), &( nullArn ), NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerFind( &( manager ), NULL, NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerFind( &( manager ), NULL, &( nullName ), &( pChannel ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRouteMessage( NULL, &( channelArns[ 0 ] ), &( message ), &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRouteMessage( &( manager ), NULL, &( message ), &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRouteMessage( &( manager ), &( channelArns[ 0 ] ), NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ChannelManagerRouteMessage( &( manager ), &( channelArns[ 0 ] ), &( message ), NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that ARNs without a channel name are rejected.
+ */
+void test_signaling_ChannelManager_InvalidArn( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel;
+    SignalingChannelArn_t channelArn;
+    const char * invalidArns[] =
+    {
+        "",
+        "arn:aws:kinesisvideo:us-west-2:123456789012",
+        "arn:aws:kinesisvideo:us-west-2:123456789012:",
+        "arn:aws:kinesisvideo:us-west-2:123456789012:chan",
+        "arn:aws:kinesisvideo:us-west-2:123456789012:stream/test/1234567890123",
+        "arn:aws:kinesisvideo:us-west-2:123456789012:channel/",
+        "arn:aws:kinesisvideo:us-west-2:123456789012:channel//1234567890123",
+    };
+    size_t i;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 8, 1 ) );
+
+    for( i = 0; i < sizeof( invalidArns ) / sizeof( invalidArns[ 0 ] ); i++ )
+    {
+        channelArn.pChannelArn = invalidArns[ i ];
+        channelArn.channelArnLength = strlen( invalidArns[ i ] );
+
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_CHANNEL_NAME,
+                           Signaling_ChannelManagerAdd( &( manager ), &( channelArn ), NULL, &( pChannel ) ) );
+    }
+
+    /* The name is everything up to the end if there is no creation time. */
+    channelArn.pChannelArn = TEST_ARN_PREFIX "test";
+    channelArn.channelArnLength = strlen( TEST_ARN_PREFIX "test" );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerAdd( &( manager ), &( channelArn ), NULL, &( pChannel ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "test", pChannel->channelName.pChannelName, pChannel->channelName.channelNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate adding, looking up and removing channels by ARN and by name.
+ */
+void test_signaling_ChannelManager_AddFindRemove( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel, * pFound;
+    SignalingChannelName_t channelName;
+    SignalingChannelArn_t otherAccountArn;
+    size_t shardIndex, nameShardIndex;
+    int userData;
+
+    InitChannelArns( 2 );
+    InitChannelName( &( channelName ), "channel-1" );
+    otherAccountArn.pChannelArn = "arn:aws:kinesisvideo:us-west-2:999999999999:channel/channel-1/1234567890123";
+    otherAccountArn.channelArnLength = strlen( otherAccountArn.pChannelArn );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 64, 4 ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                       Signaling_ChannelManagerFind( &( manager ), &( channelArns[ 1 ] ), NULL, &( pFound ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ 1 ] ), &( userData ), &( pChannel ) ) );
+    TEST_ASSERT_EQUAL_PTR( &( userData ), pChannel->pUserData );
+    TEST_ASSERT_EQUAL_PTR( arns[ 1 ], pChannel->channelArn.pChannelArn );
+    TEST_ASSERT_EQUAL_STRING_LEN( "channel-1", pChannel->channelName.pChannelName, pChannel->channelName.channelNameLength );
+    TEST_ASSERT_EQUAL( 0, pChannel->isIceServerConfigStale );
+
+    /* Adding again returns the same channel. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ 1 ] ), NULL, &( pFound ) ) );
+    TEST_ASSERT_EQUAL_PTR( pChannel, pFound );
+    TEST_ASSERT_EQUAL_PTR( &( userData ), pFound->pUserData );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerFind( &( manager ), &( channelArns[ 1 ] ), NULL, &( pFound ) ) );
+    TEST_ASSERT_EQUAL_PTR( pChannel, pFound );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerFind( &( manager ), NULL, &( channelName ), &( pFound ) ) );
+    TEST_ASSERT_EQUAL_PTR( pChannel, pFound );
+
+    /* The ARN and the name pick the same shard, which holds the channel. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerShardOf( &( manager ), &( channelArns[ 1 ] ), NULL, &( shardIndex ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerShardOf( &( manager ), NULL, &( channelName ), &( nameShardIndex ) ) );
+    TEST_ASSERT_EQUAL( shardIndex, nameShardIndex );
+    TEST_ASSERT_TRUE( ( pChannel >= manager.shards[ shardIndex ].pSlots ) &&
+                      ( pChannel < &( manager.shards[ shardIndex ].pSlots[ manager.shards[ shardIndex ].slotCount ] ) ) );
+    TEST_ASSERT_EQUAL( 1, manager.shards[ shardIndex ].channelCount );
+
+    /* Same name in another account, found by ARN. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                       Signaling_ChannelManagerFind( &( manager ), &( otherAccountArn ), NULL, &( pFound ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerAdd( &( manager ), &( otherAccountArn ), NULL, &( pFound ) ) );
+    TEST_ASSERT_TRUE( pFound != pChannel );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerFind( &( manager ), &( channelArns[ 1 ] ), NULL, &( pFound ) ) );
+    TEST_ASSERT_EQUAL_PTR( pChannel, pFound );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ 1 ] ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                       Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ 1 ] ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                       Signaling_ChannelManagerFind( &( manager ), &( channelArns[ 1 ] ), NULL, &( pFound ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerFind( &( manager ), NULL, &( channelName ), &( pFound ) ) );
+    TEST_ASSERT_EQUAL_PTR( otherAccountArn.pChannelArn, pFound->channelArn.pChannelArn );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerRemove( &( manager ), &( otherAccountArn ) ) );
+    TEST_ASSERT_EQUAL( 0, manager.shards[ shardIndex ].channelCount );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                       Signaling_ChannelManagerFind( &( manager ), NULL, &( channelName ), &( pFound ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that messages are routed to the state of their channel.
+ */
+void test_signaling_ChannelManager_RouteMessage( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel, * pRouted;
+    WssRecvMessage_t message;
+
+    InitChannelArns( 2 );
+    memset( &( message ), 0, sizeof( message ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 64, 4 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ 0 ] ), NULL, &( pChannel ) ) );
+
+    message.messageType = SIGNALING_TYPE_MESSAGE_SDP_OFFER;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerRouteMessage( &( manager ), &( channelArns[ 0 ] ), &( message ), &( pRouted ) ) );
+    TEST_ASSERT_EQUAL_PTR( pChannel, pRouted );
+    TEST_ASSERT_EQUAL( 0, pChannel->isIceServerConfigStale );
+
+    message.messageType = SIGNALING_TYPE_MESSAGE_RECONNECT_ICE_SERVER;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerRouteMessage( &( manager ), &( channelArns[ 0 ] ), &( message ), &( pRouted ) ) );
+    TEST_ASSERT_EQUAL_PTR( pChannel, pRouted );
+    TEST_ASSERT_EQUAL( 1, pChannel->isIceServerConfigStale );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                       Signaling_ChannelManagerRouteMessage( &( manager ), &( channelArns[ 1 ] ), &( message ), &( pRouted ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a shard keeps a quarter of its slots free, and that removed slots
+ *        are reused without breaking lookups.
+ */
+void test_signaling_ChannelManager_FullAndChurn( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel;
+    size_t i, j;
+
+    InitChannelArns( 1000 );
+
+    /* 11 slots give one shard of 8 slots, which holds 6 channels. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 11, 1 ) );
+    TEST_ASSERT_EQUAL( 8, manager.shards[ 0 ].slotCount );
+
+    for( i = 0; i < 6; i++ )
+    {
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ i ] ), NULL, &( pChannel ) ) );
+    }
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ 6 ] ), NULL, &( pChannel ) ) );
+
+    /* Replace the oldest channel, over and over. */
+    for( i = 6; i < 1000; i++ )
+    {
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ i - 6 ] ) ) );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ i ] ), NULL, &( pChannel ) ) );
+
+        for( j = i - 5; j <= i; j++ )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerFind( &( manager ), &( channelArns[ j ] ), NULL, &( pChannel ) ) );
+            TEST_ASSERT_EQUAL_PTR( arns[ j ], pChannel->channelArn.pChannelArn );
+        }
+
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                           Signaling_ChannelManagerFind( &( manager ), &( channelArns[ i - 6 ] ), NULL, &( pChannel ) ) );
+    }
+
+    TEST_ASSERT_EQUAL( 6, manager.shards[ 0 ].channelCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the smallest shards keep a free slot, so that adds and removes
+ *        terminate on them too.
+ */
+void test_signaling_ChannelManager_SmallShards( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel;
+    static const size_t slotCounts[] = { 1, 2, 4 };
+    static const size_t capacities[] = { 0, 1, 3 };
+    size_t i, j, k, capacity;
+
+    InitChannelArns( 200 );
+
+    for( k = 0; k < sizeof( slotCounts ) / sizeof( slotCounts[ 0 ] ); k++ )
+    {
+        capacity = capacities[ k ];
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_ChannelManagerInit( &( manager ), slots, slotCounts[ k ], 1 ) );
+        TEST_ASSERT_EQUAL( slotCounts[ k ], manager.shards[ 0 ].slotCount );
+
+        for( i = 0; i < capacity; i++ )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ i ] ), NULL, &( pChannel ) ) );
+        }
+
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                           Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ capacity ] ), NULL, &( pChannel ) ) );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                           Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ capacity ] ) ) );
+
+        /* Replace the oldest channel, over and over. */
+        for( i = capacity; ( capacity > 0U ) && ( i < 200 ); i++ )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ i - capacity ] ) ) );
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ i ] ), NULL, &( pChannel ) ) );
+
+            for( j = i + 1U - capacity; j <= i; j++ )
+            {
+                TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                                   Signaling_ChannelManagerFind( &( manager ), &( channelArns[ j ] ), NULL, &( pChannel ) ) );
+                TEST_ASSERT_EQUAL_PTR( arns[ j ], pChannel->channelArn.pChannelArn );
+            }
+        }
+
+        for( i = 0; i < 200; i++ )
+        {
+            ( void ) Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ i ] ) );
+        }
+
+        TEST_ASSERT_EQUAL( 0, manager.shards[ 0 ].channelCount );
+    }
+
+    /* Two shards of 2 slots. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 4, 2 ) );
+    TEST_ASSERT_EQUAL( 2, manager.shards[ 0 ].slotCount );
+
+    for( i = 0; i < 200; i++ )
+    {
+        if( Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ i ] ), NULL, &( pChannel ) ) == SIGNALING_RESULT_OK )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ i ] ) ) );
+        }
+    }
+
+    TEST_ASSERT_EQUAL( 0, manager.shards[ 0 ].channelCount + manager.shards[ 1 ].channelCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that random adds and removes on a busy shard leave no slot behind, so
+ *        that free slots keep ending probe sequences early.
+ */
+void test_signaling_ChannelManager_RandomChurn( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel;
+    const SignalingChannelShard_t * pShard = &( manager.shards[ 0 ] );
+    static uint8_t isAdded[ TEST_CHURN_ARN_COUNT ];
+    uint32_t random = 1U;
+    size_t i, j, channelCount = 0, occupiedCount, probeLength, maxProbeLength = 0;
+
+    InitChannelArns( TEST_CHURN_ARN_COUNT );
+    memset( isAdded, 0, sizeof( isAdded ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ChannelManagerInit( &( manager ), slots, 1024, 1 ) );
+    TEST_ASSERT_EQUAL( 1024, pShard->slotCount );
+
+    for( i = 0; i < TEST_CHURN_OPERATION_COUNT; i++ )
+    {
+        /* Pick any channel, and add or remove it to stay around 700 channels. */
+        random = ( random * 1103515245U ) + 12345U;
+        j = ( random >> 8 ) % TEST_CHURN_ARN_COUNT;
+
+        if( ( isAdded[ j ] == 0U ) && ( channelCount < 700U ) )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ j ] ), NULL, &( pChannel ) ) );
+            isAdded[ j ] = 1U;
+            channelCount++;
+        }
+        else if( isAdded[ j ] != 0U )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerRemove( &( manager ), &( channelArns[ j ] ) ) );
+            isAdded[ j ] = 0U;
+            channelCount--;
+        }
+        else
+        {
+            /* Empty on purpose. */
+        }
+    }
+
+    TEST_ASSERT_EQUAL( channelCount, pShard->channelCount );
+
+    /* Every slot that is not a managed channel is free again. */
+    occupiedCount = 0;
+
+    for( i = 0; i < pShard->slotCount; i++ )
+    {
+        if( pShard->pSlots[ i ].channelArn.pChannelArn != NULL )
+        {
+            occupiedCount++;
+            probeLength = ( i - ( pShard->pSlots[ i ].nameHash & ( pShard->slotCount - 1U ) ) ) & ( pShard->slotCount - 1U );
+            maxProbeLength = ( probeLength > maxProbeLength ) ? probeLength : maxProbeLength;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( channelCount, occupiedCount );
+    TEST_ASSERT_TRUE( maxProbeLength < 64U );
+
+    for( j = 0; j < TEST_CHURN_ARN_COUNT; j++ )
+    {
+        TEST_ASSERT_EQUAL( ( isAdded[ j ] != 0U ) ? SIGNALING_RESULT_OK : SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                           Signaling_ChannelManagerFind( &( manager ), &( channelArns[ j ] ), NULL, &( pChannel ) ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate lookups from 10 to 100k channels, and that the shards stay balanced.
+ */
+void test_signaling_ChannelManager_Scaling( void )
+{
+    SignalingChannelManager_t manager;
+    SignalingManagedChannel_t * pChannel;
+    SignalingChannelName_t channelName;
+    size_t channelCounts[] = { 10, 100, 1000, 10000, TEST_MAX_CHANNELS };
+    size_t i, j, shardIndex, channelCount, minShardCount, maxShardCount;
+
+    InitChannelArns( TEST_MAX_CHANNELS );
+
+    for( i = 0; i < sizeof( channelCounts ) / sizeof( channelCounts[ 0 ] ); i++ )
+    {
+        channelCount = channelCounts[ i ];
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_ChannelManagerInit( &( manager ), slots, TEST_MAX_SLOTS, TEST_SHARD_COUNT ) );
+
+        /* Only the channels that exist are added, the others must not be found. */
+        for( j = 0; j < channelCount; j++ )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerAdd( &( manager ), &( channelArns[ j ] ), &( arns[ j ] ), &( pChannel ) ) );
+        }
+
+        for( j = 0; j < channelCount; j++ )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerFind( &( manager ), &( channelArns[ j ] ), NULL, &( pChannel ) ) );
+            TEST_ASSERT_EQUAL_PTR( &( arns[ j ] ), pChannel->pUserData );
+
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_ChannelManagerFind( &( manager ), NULL, &( pChannel->channelName ), &( pChannel ) ) );
+            TEST_ASSERT_EQUAL_PTR( &( arns[ j ] ), pChannel->pUserData );
+        }
+
+        if( channelCount < TEST_MAX_CHANNELS )
+        {
+            InitChannelName( &( channelName ), "channel-99999" );
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_CHANNEL_NOT_FOUND,
+                               Signaling_ChannelManagerFind( &( manager ), NULL, &( channelName ), &( pChannel ) ) );
+        }
+
+        minShardCount = channelCount;
+        maxShardCount = 0;
+
+        for( shardIndex = 0; shardIndex < TEST_SHARD_COUNT; shardIndex++ )
+        {
+            minShardCount = ( manager.shards[ shardIndex ].channelCount < minShardCount ) ? manager.shards[ shardIndex ].channelCount : minShardCount;
+            maxShardCount = ( manager.shards[ shardIndex ].channelCount > maxShardCount ) ? manager.shards[ shardIndex ].channelCount : maxShardCount;
+        }
+
+        /* Within 10% of an even split once there are enough channels. */
+        if( channelCount >= 10000 )
+        {
+            TEST_ASSERT_TRUE( minShardCount * 10 >= ( channelCount / TEST_SHARD_COUNT ) * 9 );
+            TEST_ASSERT_TRUE( maxShardCount * 10 <= ( channelCount / TEST_SHARD_COUNT ) * 11 );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
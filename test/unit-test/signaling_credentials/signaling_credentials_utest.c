@@ -0,0 +1,327 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "signaling_api.h"
+#include "signaling_credentials.h"
+
+/* ===========================  EXTERN VARIABLES    =========================== */
+
+/* 2024-12-23T18:26:52Z. */
+#define TEST_EXPIRATION_SECONDS    ( 1734978412U )
+#define TEST_REFRESH_MARGIN        ( 300U )
+
+/* ===========================  EXTERN FUNCTIONS   =========================== */
+
+static SignalingResult_t ParseTime( const char * pTime,
+                                    uint64_t * pEpochSeconds )
+{
+    return Signaling_ParseIso8601Time( pTime,
+                                       strlen( pTime ),
+                                       pEpochSeconds );
+}
+
+/*-----------------------------------------------------------*/
+
+static void InitCredential( SignalingCredential_t * pCredential,
+                            const char * pAccessKeyId,
+                            const char * pExpiration )
+{
+    pCredential->pAccessKeyId = pAccessKeyId;
+    pCredential->accessKeyIdLength = strlen( pAccessKeyId );
+    pCredential->pSecretAccessKey = "test-secret";
+    pCredential->secretAccessKeyLength = strlen( "test-secret" );
+    pCredential->pSessionToken = "test-token";
+    pCredential->sessionTokenLength = strlen( "test-token" );
+    pCredential->pExpiration = pExpiration;
+    pCredential->expirationLength = strlen( pExpiration );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate ISO-8601 parsing with bad parameters.
+ */
+void test_signaling_ParseIso8601Time_BadParams( void )
+{
+    uint64_t epochSeconds;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ParseIso8601Time( NULL, 20, &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_ParseIso8601Time( "2024-12-23T18:26:52Z", 20, NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate ISO-8601 parsing of valid times.
+ */
+void test_signaling_ParseIso8601Time( void )
+{
+    uint64_t epochSeconds = 0;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2024-12-23T18:26:52Z", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( TEST_EXPIRATION_SECONDS, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2024-12-23t18:26:52.123456z", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( TEST_EXPIRATION_SECONDS, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2024-12-24T00:56:52+06:30", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( TEST_EXPIRATION_SECONDS, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2024-12-23T10:26:52.5-08:00", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( TEST_EXPIRATION_SECONDS, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "1970-01-01T00:00:00Z", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( 0, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2000-02-29T00:00:00Z", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( 951782400U, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2100-03-01T00:00:00Z", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( 4107542400ULL, epochSeconds );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK, ParseTime( "2016-12-31T23:59:60Z", &( epochSeconds ) ) );
+    TEST_ASSERT_EQUAL( 1483228800U, epochSeconds );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate ISO-8601 parsing of malformed or out of range times.
+ */
+void test_signaling_ParseIso8601Time_Invalid( void )
+{
+    const char * invalidTimes[] =
+    {
+        "",
+        "2024-12-23T18:26:52",
+        "2024-12-23 18:26:52Z",
+        "2024/12/23T18:26:52Z",
+        "2024-12-23T18-26-52Z",
+        "2024-12-23T18:26:5xZ",
+        "2024-13-23T18:26:52Z",
+        "2024-00-23T18:26:52Z",
+        "2024-12-00T18:26:52Z",
+        "2024-04-31T18:26:52Z",
+        "2023-02-29T18:26:52Z",
+        "2100-02-29T18:26:52Z",
+        "2024-12-23T24:00:00Z",
+        "2024-12-23T18:60:52Z",
+        "2024-12-23T18:26:61Z",
+        "1969-12-31T23:59:59Z",
+        "1970-01-01T00:00:00+01:00",
+        "2024-12-23T18:26:52.Z",
+        "2024-12-23T18:26:52ZZ",
+        "2024-12-23T18:26:52+0100",
+        "2024-12-23T18:26:52+24:00",
+        "2024-12-23T18:26:52+01:60",
+    };
+    uint64_t epochSeconds = 1;
+    size_t i;
+
+    for( i = 0; i < sizeof( invalidTimes ) / sizeof( invalidTimes[ 0 ] ); i++ )
+    {
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_TIMESTAMP,
+                           ParseTime( invalidTimes[ i ], &( epochSeconds ) ) );
+    }
+
+    TEST_ASSERT_EQUAL( 1, epochSeconds );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate credential holder behavior with bad parameters.
+ */
+void test_signaling_CredentialHolder_BadParams( void )
+{
+    SignalingCredentialHolder_t holder;
+    SignalingCredential_t credential, readCredential;
+    SignalingCredentialCopy_t copy;
+    uint64_t secondsToExpiry;
+    uint8_t shouldRefresh;
+
+    InitCredential( &( credential ), "test-access-key", "2024-12-23T18:26:52Z" );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderInit( NULL, TEST_REFRESH_MARGIN ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderInit( &( holder ), TEST_REFRESH_MARGIN ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderUpdate( NULL, &( credential ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderUpdate( &( holder ), NULL ) );
+    credential.pAccessKeyId = NULL;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+    InitCredential( &( credential ), "test-access-key", "2024-12-23T18:26:52Z" );
+    credential.pSecretAccessKey = NULL;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+    InitCredential( &( credential ), "test-access-key", "2024-12-23T18:26:52Z" );
+    credential.pSessionToken = NULL;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderGet( NULL, 0, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderGet( &( holder ), 0, NULL, &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderGet( &( holder ), 0, &( copy ), NULL, &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderGet( &( holder ), 0, &( copy ), &( readCredential ), NULL, &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_CredentialHolderGet( &( holder ), 0, &( copy ), &( readCredential ), &( secondsToExpiry ), NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that credentials parsed from AWS IoT are copied, and that a refresh is
+ *        asked for within the margin before they expire.
+ */
+void test_signaling_CredentialHolder_UpdateAndGet( void )
+{
+    SignalingCredentialHolder_t holder;
+    SignalingCredential_t credential, readCredential;
+    SignalingCredentialCopy_t copy;
+    uint64_t secondsToExpiry = 1;
+    uint8_t shouldRefresh = 0;
+    char message[] =
+    "{"
+        "\"credentials\":"
+        "{"
+            "\"accessKeyId\": \"ASIASWNFWKDLG25\","
+            "\"secretAccessKey\": \"test-e/I5Zjd72kMzF/Ys20Le9wyxH3\","
+            "\"sessionToken\": \"IQoJb3JpZ2luX3TT5KsgDCNv//////////wEQABoM4L2LJKaRl/zI1I+48vpNn40TZ5wXfyWtqmqLWVNYHbxLdCOelXF9OnyCzvG6X5CPLQsgU/wT3QQ=\","
+            "\"expiration\": \"2024-12-23T18:26:52Z\""
+        "}"
+    "}";
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderInit( &( holder ), TEST_REFRESH_MARGIN ) );
+
+    /* No credentials yet. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CREDENTIAL_EXPIRED,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS - 3600U, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 0, secondsToExpiry );
+    TEST_ASSERT_EQUAL( 1, shouldRefresh );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ParseFetchTempCredsResponseFromAwsIot( message, strlen( message ), &( credential ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+    memset( message, 'x', sizeof( message ) - 1U );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS - 3600U, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 3600U, secondsToExpiry );
+    TEST_ASSERT_EQUAL( 0, shouldRefresh );
+    TEST_ASSERT_EQUAL( TEST_EXPIRATION_SECONDS, copy.expirationSeconds );
+    TEST_ASSERT_EQUAL_STRING_LEN( "ASIASWNFWKDLG25", readCredential.pAccessKeyId, readCredential.accessKeyIdLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "test-e/I5Zjd72kMzF/Ys20Le9wyxH3", readCredential.pSecretAccessKey, readCredential.secretAccessKeyLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "IQoJb3JpZ2luX3TT5KsgDCNv//////////wEQABoM4L2LJKaRl/zI1I+48vpNn40TZ5wXfyWtqmqLWVNYHbxLdCOelXF9OnyCzvG6X5CPLQsgU/wT3QQ=",
+                                  readCredential.pSessionToken,
+                                  readCredential.sessionTokenLength );
+    TEST_ASSERT_EQUAL_PTR( copy.accessKeyId, readCredential.pAccessKeyId );
+    TEST_ASSERT_EQUAL_PTR( NULL, readCredential.pExpiration );
+
+    /* Within the refresh margin, still usable. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS - TEST_REFRESH_MARGIN - 1U, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 0, shouldRefresh );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS - TEST_REFRESH_MARGIN, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( TEST_REFRESH_MARGIN, secondsToExpiry );
+    TEST_ASSERT_EQUAL( 1, shouldRefresh );
+
+    /* Expired. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CREDENTIAL_EXPIRED,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 0, secondsToExpiry );
+    TEST_ASSERT_EQUAL( 1, shouldRefresh );
+
+    /* Refreshed. */
+    InitCredential( &( credential ), "test-access-key", "2024-12-23T19:26:52Z" );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 3600U, secondsToExpiry );
+    TEST_ASSERT_EQUAL( 0, shouldRefresh );
+    TEST_ASSERT_EQUAL_STRING_LEN( "test-access-key", readCredential.pAccessKeyId, readCredential.accessKeyIdLength );
+    TEST_ASSERT_EQUAL( 0, holder.sequence & 1U );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that credentials that can't be stored leave the previous ones in place.
+ */
+void test_signaling_CredentialHolder_UpdateInvalid( void )
+{
+    SignalingCredentialHolder_t holder;
+    SignalingCredential_t credential, readCredential;
+    SignalingCredentialCopy_t copy;
+    uint64_t secondsToExpiry;
+    uint8_t shouldRefresh;
+    static char longValue[ SESSION_TOKEN_MAX_LEN + 1 ];
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderInit( &( holder ), TEST_REFRESH_MARGIN ) );
+    InitCredential( &( credential ), "test-access-key", "2024-12-23T18:26:52Z" );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    InitCredential( &( credential ), "other-access-key", "2024-12-23T18:26:52" );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_TIMESTAMP,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    credential.pExpiration = NULL;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_TIMESTAMP,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    InitCredential( &( credential ), "other-access-key", "2024-12-23T19:26:52Z" );
+    credential.pAccessKeyId = longValue;
+    credential.accessKeyIdLength = ACCESS_KEY_MAX_LEN + 1U;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_ACCESS_KEY_LENGTH_TOO_LARGE,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    InitCredential( &( credential ), "other-access-key", "2024-12-23T19:26:52Z" );
+    credential.pSecretAccessKey = longValue;
+    credential.secretAccessKeyLength = SECRET_ACCESS_KEY_MAX_LEN + 1U;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    InitCredential( &( credential ), "other-access-key", "2024-12-23T19:26:52Z" );
+    credential.pSessionToken = longValue;
+    credential.sessionTokenLength = SESSION_TOKEN_MAX_LEN + 1U;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_SESSION_TOKEN_LENGTH_TOO_LARGE,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS - 3600U, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 3600U, secondsToExpiry );
+    TEST_ASSERT_EQUAL_STRING_LEN( "test-access-key", readCredential.pAccessKeyId, readCredential.accessKeyIdLength );
+
+    /* Credentials without a session token. */
+    InitCredential( &( credential ), "other-access-key", "2024-12-23T19:26:52Z" );
+    credential.pSessionToken = NULL;
+    credential.sessionTokenLength = 0;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderUpdate( &( holder ), &( credential ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_CredentialHolderGet( &( holder ), TEST_EXPIRATION_SECONDS, &( copy ), &( readCredential ), &( secondsToExpiry ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 0, readCredential.sessionTokenLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "other-access-key", readCredential.pAccessKeyId, readCredential.accessKeyIdLength );
+}
+
+/*-----------------------------------------------------------*/
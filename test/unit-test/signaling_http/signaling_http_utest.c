@@ -0,0 +1,502 @@
+/* The loopback test needs the POSIX socket and process APIs. */
+#ifndef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE    200809L
+#endif
+
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+/* API includes. */
+#include "signaling_http.h"
+#include "signaling_api.h"
+
+/* ===========================  EXTERN VARIABLES    =========================== */
+
+#define TEST_BUFFER_LENGTH    ( 1024 )
+
+#define TEST_DESCRIBE_BODY                                                                                     \
+    "{\"ChannelInfo\":{\"ChannelARN\":\"arn:aws:kinesisvideo:us-west-2:123456789012:channel/test-channel/1234567890123\"," \
+    "\"ChannelName\":\"test-channel\",\"ChannelStatus\":\"ACTIVE\",\"ChannelType\":\"SINGLE_MASTER\","        \
+    "\"CreationTime\":\"2023-05-01T12:00:00Z\",\"SingleMasterConfiguration\":{\"MessageTtlSeconds\":60},"     \
+    "\"Version\":\"1\"}}"
+
+#define TEST_ENDPOINT_BODY_1    "{\"ResourceEndpointList\":[{\"Protocol\":\"WS"
+#define TEST_ENDPOINT_BODY_2                                                                \
+    "S\",\"ResourceEndpoint\":\"wss://m-1234abcd.kinesisvideo.us-west-2.amazonaws.com\"}," \
+    "{\"Protocol\":\"HTTPS\",\"ResourceEn"
+#define TEST_ENDPOINT_BODY_3    "dpoint\":\"https://r-1234abcd.kinesisvideo.us-west-2.amazonaws.com\"}]}"
+
+#define TEST_ERROR_BODY         "{\"Message\":\"The requested channel is not found or not active.\"}"
+
+/* A recorded response, and what parsing it must give. */
+typedef struct TestResponse
+{
+    const char * pRaw;
+    uint16_t statusCode;
+    const char * pErrorType;
+    const char * pBody;
+    uint8_t needsFinish;
+} TestResponse_t;
+
+/* Responses of the control plane, recorded with their framing. */
+static const TestResponse_t testResponses[] =
+{
+    {
+        "HTTP/1.1 200 OK\r\n"
+        "x-amzn-RequestId: 0c4c4c3a-7d3c-4f5e-9c1a-2b1f0e6d5a4b\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 300\r\n"
+        "Date: Sat, 17 Oct 2026 10:00:00 GMT\r\n"
+        "\r\n"
+        TEST_DESCRIBE_BODY,
+        200, "", TEST_DESCRIBE_BODY, 0
+    },
+    {
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n"
+        "transfer-encoding: Chunked\r\n"
+        "\r\n"
+        "28\r\n" TEST_ENDPOINT_BODY_1 "\r\n"
+        "6E;name=value\r\n" TEST_ENDPOINT_BODY_2 "\r\n"
+        "44\r\n" TEST_ENDPOINT_BODY_3 "\r\n"
+        "0\r\n"
+        "x-amzn-Trailer: ignored\r\n"
+        "\r\n",
+        200, "", TEST_ENDPOINT_BODY_1 TEST_ENDPOINT_BODY_2 TEST_ENDPOINT_BODY_3, 0
+    },
+    {
+        "HTTP/1.1 404 Not Found\r\n"
+        "x-amzn-RequestId: 5d1e2f3a-4b5c-6d7e-8f90-a1b2c3d4e5f6\r\n"
+        "x-amzn-ErrorType: ResourceNotFoundException:http://internal.amazon.com/coral/com.amazon.kinesisvideo.v20170930/\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 63\r\n"
+        "\r\n"
+        TEST_ERROR_BODY,
+        404, "ResourceNotFoundException", TEST_ERROR_BODY, 0
+    },
+    {
+        "HTTP/1.1 403 Forbidden\r\n"
+        "X-AMZN-ERRORTYPE:   AccessDeniedException  \r\n"
+        "Content-Length: 0\r\n"
+        "\r\n",
+        403, "AccessDeniedException", "", 0
+    },
+    {
+        "HTTP/1.1 100 Continue\r\n"
+        "\r\n"
+        "HTTP/1.1 200 OK\n"
+        "Content-Length: 2\n"
+        "\n"
+        "{}",
+        200, "", "{}", 0
+    },
+    {
+        "HTTP/1.0 200\r\n"
+        "Content-Type: application/json\r\n"
+        "\r\n"
+        "{\"IceServerList\":[]}",
+        200, "", "{\"IceServerList\":[]}", 1
+    },
+    {
+        "HTTP/1.1 204 No Content\r\n"
+        "Content-Length: 10\r\n"
+        "\r\n",
+        204, "", "", 0
+    },
+};
+
+/* ===========================  EXTERN FUNCTIONS   =========================== */
+
+/* Receive pRaw in pieces of pieceLength bytes the way a socket would, each
+ * piece landing right after the body parsed so far. */
+static SignalingResult_t ParseInPieces( SignalingHttpResponse_t * pResponse,
+                                        char * pBuffer,
+                                        const char * pRaw,
+                                        size_t pieceLength )
+{
+    SignalingResult_t result = Signaling_HttpResponseInit( pResponse );
+    size_t rawLength = strlen( pRaw ), offset = 0, length;
+
+    while( ( result == SIGNALING_RESULT_OK ) && ( offset < rawLength ) && ( pResponse->isComplete == 0U ) )
+    {
+        length = rawLength - offset;
+
+        if( length > pieceLength )
+        {
+            length = pieceLength;
+        }
+
+        TEST_ASSERT_TRUE( pResponse->bodyLength + length <= TEST_BUFFER_LENGTH );
+        memcpy( &( pBuffer[ pResponse->bodyLength ] ), &( pRaw[ offset ] ), length );
+        offset += length;
+
+        result = Signaling_HttpResponseParse( pResponse, pBuffer, length );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void AssertResponse( const TestResponse_t * pExpected,
+                            SignalingHttpResponse_t * pResponse,
+                            const char * pBuffer )
+{
+    TEST_ASSERT_EQUAL( pExpected->statusCode,
+                       pResponse->statusCode );
+    TEST_ASSERT_EQUAL( strlen( pExpected->pErrorType ),
+                       pResponse->errorTypeLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( pExpected->pErrorType,
+                                  pResponse->errorType,
+                                  pResponse->errorTypeLength );
+    TEST_ASSERT_EQUAL( strlen( pExpected->pBody ),
+                       pResponse->bodyLength );
+    TEST_ASSERT_EQUAL_MEMORY( pExpected->pBody,
+                              pBuffer,
+                              pResponse->bodyLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate HTTP response parsing behavior with NULL parameters.
+ */
+void test_signaling_HttpResponse_BadParams( void )
+{
+    SignalingHttpResponse_t response;
+    char buffer[ 4 ];
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_HttpResponseInit( NULL ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_HttpResponseInit( &( response ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_HttpResponseParse( NULL,
+                                                    buffer,
+                                                    sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_HttpResponseParse( &( response ),
+                                                    NULL,
+                                                    sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_HttpResponseFinish( NULL ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the recorded responses give the same status, error type and
+ *        body whichever way they are split while being received.
+ */
+void test_signaling_HttpResponse_RecordedResponses( void )
+{
+    static const size_t pieceLengths[] = { TEST_BUFFER_LENGTH, 1, 2, 3, 7, 64 };
+    SignalingHttpResponse_t response;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    size_t i, j;
+
+    for( i = 0; i < sizeof( testResponses ) / sizeof( testResponses[ 0 ] ); i++ )
+    {
+        for( j = 0; j < sizeof( pieceLengths ) / sizeof( pieceLengths[ 0 ] ); j++ )
+        {
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               ParseInPieces( &( response ),
+                                              buffer,
+                                              testResponses[ i ].pRaw,
+                                              pieceLengths[ j ] ) );
+            TEST_ASSERT_EQUAL( testResponses[ i ].needsFinish == 0U,
+                               response.isComplete );
+            TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                               Signaling_HttpResponseFinish( &( response ) ) );
+            TEST_ASSERT_EQUAL( 1,
+                               response.isComplete );
+            AssertResponse( &( testResponses[ i ] ),
+                            &( response ),
+                            buffer );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a parsed body is passed as is to the Signaling_Parse* APIs, and
+ *        that bytes after the end of the response are ignored.
+ */
+void test_signaling_HttpResponse_ParseBody( void )
+{
+    SignalingHttpResponse_t response;
+    SignalingChannelInfo_t channelInfo;
+    SignalingChannelEndpoints_t endpoints;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    size_t rawLength;
+
+    rawLength = strlen( testResponses[ 0 ].pRaw );
+    memcpy( buffer, testResponses[ 0 ].pRaw, rawLength );
+    memcpy( &( buffer[ rawLength ] ), "HTTP/1.1", strlen( "HTTP/1.1" ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_HttpResponseInit( &( response ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_HttpResponseParse( &( response ),
+                                                    buffer,
+                                                    rawLength + strlen( "HTTP/1.1" ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       response.isComplete );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ParseDescribeSignalingChannelResponse( buffer,
+                                                                        response.bodyLength,
+                                                                        &( channelInfo ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "test-channel",
+                                  channelInfo.channelName.pChannelName,
+                                  channelInfo.channelName.channelNameLength );
+    TEST_ASSERT_EQUAL( 60,
+                       channelInfo.messageTtlSeconds );
+
+    /* Parsing again once complete changes nothing. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_HttpResponseParse( &( response ),
+                                                    buffer,
+                                                    1 ) );
+    TEST_ASSERT_EQUAL( strlen( TEST_DESCRIBE_BODY ),
+                       response.bodyLength );
+
+    /* <--------------------------------------------------------------------> */
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       ParseInPieces( &( response ),
+                                      buffer,
+                                      testResponses[ 1 ].pRaw,
+                                      5 ) );
+    TEST_ASSERT_EQUAL( 1,
+                       response.isComplete );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_ParseGetSignalingChannelEndpointResponse( buffer,
+                                                                           response.bodyLength,
+                                                                           &( endpoints ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "wss://m-1234abcd.kinesisvideo.us-west-2.amazonaws.com",
+                                  endpoints.wssEndpoint.pEndpoint,
+                                  endpoints.wssEndpoint.endpointLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "https://r-1234abcd.kinesisvideo.us-west-2.amazonaws.com",
+                                  endpoints.httpsEndpoint.pEndpoint,
+                                  endpoints.httpsEndpoint.endpointLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that an error type longer than the buffer is truncated.
+ */
+void test_signaling_HttpResponse_LongErrorType( void )
+{
+    SignalingHttpResponse_t response;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    char raw[ 256 ];
+    size_t length;
+
+    length = ( size_t ) snprintf( raw, sizeof( raw ), "HTTP/1.1 400 Bad Request\r\nx-amzn-ErrorType: " );
+    memset( &( raw[ length ] ), 'E', SIGNALING_HTTP_MAX_ERROR_TYPE_LENGTH + 10 );
+    length += SIGNALING_HTTP_MAX_ERROR_TYPE_LENGTH + 10;
+    snprintf( &( raw[ length ] ), sizeof( raw ) - length, "\r\nContent-Length: 0\r\n\r\n" );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       ParseInPieces( &( response ),
+                                      buffer,
+                                      raw,
+                                      TEST_BUFFER_LENGTH ) );
+    TEST_ASSERT_EQUAL( 1,
+                       response.isComplete );
+    TEST_ASSERT_EQUAL( 400,
+                       response.statusCode );
+    TEST_ASSERT_EQUAL( SIGNALING_HTTP_MAX_ERROR_TYPE_LENGTH,
+                       response.errorTypeLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate HTTP response parsing behavior for malformed responses.
+ */
+void test_signaling_HttpResponse_Malformed( void )
+{
+    static const char * malformedResponses[] =
+    {
+        "HTTP/2 200 OK\r\n\r\n",
+        "HTTP/1.x 200 OK\r\n\r\n",
+        "HTTP/1.1200 OK\r\n\r\n",
+        "HTTP/1.1 20 OK\r\n\r\n",
+        "HTTP/1.1 2000 OK\r\n\r\n",
+        "HTTP/1.1 099 OK\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nNoColon\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nBad Name: value\r\n\r\n",
+        "HTTP/1.1 200 OK\r\n: value\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nA: b\r\n  folded\r\n\r\n",
+        "HTTP/1.1 200 OK\r\n\rX",
+        "HTTP/1.1 200 OK\r\nContent-Length: 1x\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nContent-Length: 1 2\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nContent-Length:\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nContent-Length: 99999999999999999999999\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nContent-Length: 1\r\nContent-Length: 1\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: gzip\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunkedx\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunk\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nz\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n1g\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n11111111111111111111\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n1\r\nab\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\rX",
+    };
+    SignalingHttpResponse_t response;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    size_t i;
+
+    for( i = 0; i < sizeof( malformedResponses ) / sizeof( malformedResponses[ 0 ] ); i++ )
+    {
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_HTTP_RESPONSE,
+                           ParseInPieces( &( response ),
+                                          buffer,
+                                          malformedResponses[ i ],
+                                          TEST_BUFFER_LENGTH ) );
+
+        /* The parser stays failed. */
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_HTTP_RESPONSE,
+                           Signaling_HttpResponseParse( &( response ),
+                                                        buffer,
+                                                        0 ) );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_HTTP_RESPONSE,
+                           Signaling_HttpResponseFinish( &( response ) ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a response truncated by the connection closing is rejected.
+ */
+void test_signaling_HttpResponse_Truncated( void )
+{
+    static const char * truncatedResponses[] =
+    {
+        "HTTP/1.1 200",
+        "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n",
+        "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\n{",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n2\r\n{}\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n",
+    };
+    SignalingHttpResponse_t response;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    size_t i;
+
+    for( i = 0; i < sizeof( truncatedResponses ) / sizeof( truncatedResponses[ 0 ] ); i++ )
+    {
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           ParseInPieces( &( response ),
+                                          buffer,
+                                          truncatedResponses[ i ],
+                                          TEST_BUFFER_LENGTH ) );
+        TEST_ASSERT_EQUAL( 0,
+                           response.isComplete );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_HTTP_RESPONSE,
+                           Signaling_HttpResponseFinish( &( response ) ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate parsing the recorded responses as received from a loopback server
+ *        sending them in small writes.
+ */
+void test_signaling_HttpResponse_Loopback( void )
+{
+    SignalingHttpResponse_t response;
+    char buffer[ TEST_BUFFER_LENGTH ];
+    struct sockaddr_in address;
+    socklen_t addressLength = sizeof( address );
+    int listenSocket, clientSocket, serverSocket, status;
+    ssize_t received;
+    size_t i, offset, length;
+    pid_t pid;
+
+    for( i = 0; i < sizeof( testResponses ) / sizeof( testResponses[ 0 ] ); i++ )
+    {
+        memset( &( address ), 0, sizeof( address ) );
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+        address.sin_port = 0;
+
+        listenSocket = socket( AF_INET, SOCK_STREAM, 0 );
+        TEST_ASSERT_TRUE( listenSocket >= 0 );
+        TEST_ASSERT_EQUAL( 0, bind( listenSocket, ( struct sockaddr * ) &( address ), sizeof( address ) ) );
+        TEST_ASSERT_EQUAL( 0, listen( listenSocket, 1 ) );
+        TEST_ASSERT_EQUAL( 0, getsockname( listenSocket, ( struct sockaddr * ) &( address ), &( addressLength ) ) );
+
+        pid = fork();
+        TEST_ASSERT_TRUE( pid >= 0 );
+
+        if( pid == 0 )
+        {
+            /* The server writes the response 13 bytes at a time, then closes. */
+            serverSocket = accept( listenSocket, NULL, NULL );
+            length = strlen( testResponses[ i ].pRaw );
+
+            for( offset = 0; ( serverSocket >= 0 ) && ( offset < length ); offset += 13 )
+            {
+                if( write( serverSocket, &( testResponses[ i ].pRaw[ offset ] ), ( length - offset < 13 ) ? length - offset : 13 ) < 0 )
+                {
+                    break;
+                }
+            }
+
+            close( serverSocket );
+            close( listenSocket );
+            _exit( 0 );
+        }
+
+        close( listenSocket );
+        clientSocket = socket( AF_INET, SOCK_STREAM, 0 );
+        TEST_ASSERT_TRUE( clientSocket >= 0 );
+        TEST_ASSERT_EQUAL( 0, connect( clientSocket, ( struct sockaddr * ) &( address ), sizeof( address ) ) );
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_HttpResponseInit( &( response ) ) );
+
+        do
+        {
+            received = recv( clientSocket,
+                             &( buffer[ response.bodyLength ] ),
+                             sizeof( buffer ) - response.bodyLength,
+                             0 );
+
+            if( received > 0 )
+            {
+                TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                                   Signaling_HttpResponseParse( &( response ),
+                                                                buffer,
+                                                                ( size_t ) received ) );
+            }
+        } while( ( received > 0 ) && ( response.isComplete == 0U ) );
+
+        close( clientSocket );
+        TEST_ASSERT_EQUAL( pid, waitpid( pid, &( status ), 0 ) );
+
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_HttpResponseFinish( &( response ) ) );
+        AssertResponse( &( testResponses[ i ] ),
+                        &( response ),
+                        buffer );
+    }
+}
+
+/*-----------------------------------------------------------*/
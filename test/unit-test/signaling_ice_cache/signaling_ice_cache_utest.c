@@ -0,0 +1,634 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* API includes. */
+#include "signaling_ice_cache.h"
+
+/* ===========================  EXTERN VARIABLES    =========================== */
+
+#define TEST_CHANNEL_ARN        "arn:aws:kinesisvideo:us-west-2:123456789012:channel/test-channel/1234567890123"
+#define TEST_REFRESH_PERCENT    ( 80 )
+#define TEST_START_TIME         ( 1000 )
+#define TEST_ENTRY_COUNT        ( 4 )
+
+/* Strings of the ICE servers, as in a response buffer that is reused afterwards. */
+static char responseBuffer[ 256 ];
+
+static SignalingIceCacheEntry_t cacheEntries[ TEST_ENTRY_COUNT ];
+
+/* ===========================  EXTERN FUNCTIONS   =========================== */
+
+static void InitChannelArn( SignalingChannelArn_t * pChannelArn,
+                            const char * pArn )
+{
+    pChannelArn->pChannelArn = pArn;
+    pChannelArn->channelArnLength = strlen( pArn );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Two ICE servers pointing into responseBuffer, with TTLs of 300 and 200 seconds. */
+static void InitIceServers( SignalingIceServer_t * pIceServers )
+{
+    memset( pIceServers, 0, 2 * sizeof( SignalingIceServer_t ) );
+    memcpy( responseBuffer,
+            "user1pass1turn:a.example.com:443turns:a.example.com:443user2pass2turn:b.example.com:443",
+            strlen( "user1pass1turn:a.example.com:443turns:a.example.com:443user2pass2turn:b.example.com:443" ) );
+
+    pIceServers[ 0 ].pUserName = &( responseBuffer[ 0 ] );
+    pIceServers[ 0 ].userNameLength = 5;
+    pIceServers[ 0 ].pPassword = &( responseBuffer[ 5 ] );
+    pIceServers[ 0 ].passwordLength = 5;
+    pIceServers[ 0 ].pUris[ 0 ] = &( responseBuffer[ 10 ] );
+    pIceServers[ 0 ].urisLength[ 0 ] = 22;
+    pIceServers[ 0 ].pUris[ 1 ] = &( responseBuffer[ 32 ] );
+    pIceServers[ 0 ].urisLength[ 1 ] = 23;
+    pIceServers[ 0 ].urisNum = 2;
+    pIceServers[ 0 ].messageTtlSeconds = 300;
+
+    pIceServers[ 1 ].pUserName = &( responseBuffer[ 55 ] );
+    pIceServers[ 1 ].userNameLength = 5;
+    pIceServers[ 1 ].pPassword = &( responseBuffer[ 60 ] );
+    pIceServers[ 1 ].passwordLength = 5;
+    pIceServers[ 1 ].pUris[ 0 ] = &( responseBuffer[ 65 ] );
+    pIceServers[ 1 ].urisLength[ 0 ] = 22;
+    pIceServers[ 1 ].urisNum = 1;
+    pIceServers[ 1 ].messageTtlSeconds = 200;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Look up TEST_CHANNEL_ARN, check the result and whether a refresh is asked for. */
+static void AssertGet( SignalingIceCache_t * pCache,
+                       uint64_t currentTimeSeconds,
+                       SignalingResult_t expectedResult,
+                       uint8_t expectedShouldRefresh )
+{
+    SignalingChannelArn_t channelArn;
+    SignalingIceServer_t iceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS ];
+    size_t iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+    char storage[ SIGNALING_ICE_CACHE_STORAGE_LENGTH ];
+    uint8_t shouldRefresh = 2;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+
+    TEST_ASSERT_EQUAL( expectedResult,
+                       Signaling_IceCacheGet( pCache,
+                                              &( channelArn ),
+                                              currentTimeSeconds,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( expectedShouldRefresh,
+                       shouldRefresh );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Claim the refresh of a channel and check whether a fetch is handed out. */
+static void AssertBeginRefresh( SignalingIceCache_t * pCache,
+                                const SignalingChannelArn_t * pChannelArn,
+                                uint64_t currentTimeSeconds,
+                                uint8_t expectedShouldFetch )
+{
+    uint8_t shouldFetch = 2;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheBeginRefresh( pCache,
+                                                       pChannelArn,
+                                                       currentTimeSeconds,
+                                                       &( shouldFetch ) ) );
+    TEST_ASSERT_EQUAL( expectedShouldFetch,
+                       shouldFetch );
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateCache( SignalingIceCache_t * pCache,
+                         uint64_t currentTimeSeconds )
+{
+    SignalingChannelArn_t channelArn;
+    SignalingIceServer_t iceServers[ 2 ];
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+    InitIceServers( iceServers );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheUpdate( pCache,
+                                                 &( channelArn ),
+                                                 iceServers,
+                                                 2,
+                                                 currentTimeSeconds ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static void InitCache( SignalingIceCache_t * pCache )
+{
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheInit( pCache,
+                                               cacheEntries,
+                                               TEST_ENTRY_COUNT,
+                                               TEST_REFRESH_PERCENT ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate ICE cache behavior with bad parameters.
+ */
+void test_signaling_IceCache_BadParams( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn, nullArn = { 0 };
+    SignalingIceServer_t iceServers[ 1 ];
+    size_t iceServerCount = 1;
+    char storage[ 16 ];
+    uint8_t shouldRefresh;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInit( NULL, cacheEntries, TEST_ENTRY_COUNT, TEST_REFRESH_PERCENT ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInit( &( cache ), NULL, TEST_ENTRY_COUNT, TEST_REFRESH_PERCENT ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInit( &( cache ), cacheEntries, 0, TEST_REFRESH_PERCENT ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInit( &( cache ), cacheEntries, TEST_ENTRY_COUNT, 0 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInit( &( cache ), cacheEntries, TEST_ENTRY_COUNT, 101 ) );
+    InitCache( &( cache ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( NULL, &( channelArn ), 0, iceServers, &( iceServerCount ), storage, sizeof( storage ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( &( cache ), NULL, 0, iceServers, &( iceServerCount ), storage, sizeof( storage ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( &( cache ), &( nullArn ), 0, iceServers, &( iceServerCount ), storage, sizeof( storage ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( &( cache ), &( channelArn ), 0, NULL, &( iceServerCount ), storage, sizeof( storage ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( &( cache ), &( channelArn ), 0, iceServers, NULL, storage, sizeof( storage ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( &( cache ), &( channelArn ), 0, iceServers, &( iceServerCount ), NULL, sizeof( storage ), &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheGet( &( cache ), &( channelArn ), 0, iceServers, &( iceServerCount ), storage, sizeof( storage ), NULL ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheBeginRefresh( NULL, &( channelArn ), 0, &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheBeginRefresh( &( cache ), NULL, 0, &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheBeginRefresh( &( cache ), &( nullArn ), 0, &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheBeginRefresh( &( cache ), &( channelArn ), 0, NULL ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheUpdate( NULL, &( channelArn ), iceServers, 1, 0 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheUpdate( &( cache ), NULL, iceServers, 1, 0 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheUpdate( &( cache ), &( nullArn ), iceServers, 1, 0 ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheUpdate( &( cache ), &( channelArn ), NULL, 1, 0 ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInvalidate( NULL, &( channelArn ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInvalidate( &( cache ), NULL ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_IceCacheInvalidate( &( cache ), &( nullArn ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that concurrent misses share one refresh, and that lookups get their own
+ *        copy of the strings.
+ */
+void test_signaling_IceCache_MissThenHit( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn;
+    SignalingIceServer_t iceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS ];
+    size_t iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+    char storage[ SIGNALING_ICE_CACHE_STORAGE_LENGTH ];
+    uint8_t shouldRefresh;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+    InitCache( &( cache ) );
+
+    AssertGet( &( cache ), TEST_START_TIME, SIGNALING_RESULT_CACHE_MISS, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME, 1 );
+    AssertGet( &( cache ), TEST_START_TIME, SIGNALING_RESULT_CACHE_MISS, 0 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME, 0 );
+    AssertGet( &( cache ), TEST_START_TIME + 1, SIGNALING_RESULT_CACHE_MISS, 0 );
+
+    UpdateCache( &( cache ), TEST_START_TIME + 1 );
+    memset( responseBuffer, 'x', sizeof( responseBuffer ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArn ),
+                                              TEST_START_TIME + 2,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 0, shouldRefresh );
+    TEST_ASSERT_EQUAL( 2, iceServerCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "user1", iceServers[ 0 ].pUserName, iceServers[ 0 ].userNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "pass1", iceServers[ 0 ].pPassword, iceServers[ 0 ].passwordLength );
+    TEST_ASSERT_EQUAL( 2, iceServers[ 0 ].urisNum );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turn:a.example.com:443", iceServers[ 0 ].pUris[ 0 ], iceServers[ 0 ].urisLength[ 0 ] );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turns:a.example.com:443", iceServers[ 0 ].pUris[ 1 ], iceServers[ 0 ].urisLength[ 1 ] );
+    TEST_ASSERT_EQUAL( 300, iceServers[ 0 ].messageTtlSeconds );
+    TEST_ASSERT_EQUAL_STRING_LEN( "user2", iceServers[ 1 ].pUserName, iceServers[ 1 ].userNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turn:b.example.com:443", iceServers[ 1 ].pUris[ 0 ], iceServers[ 1 ].urisLength[ 0 ] );
+    TEST_ASSERT_TRUE( ( iceServers[ 0 ].pUserName >= storage ) &&
+                      ( iceServers[ 0 ].pUserName < &( storage[ sizeof( storage ) ] ) ) );
+
+    /* Not enough room for both servers, or for their strings. */
+    iceServerCount = 1;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArn ),
+                                              TEST_START_TIME + 2,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+    iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArn ),
+                                              TEST_START_TIME + 2,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              channelArn.channelArnLength,
+                                              &( shouldRefresh ) ) );
+
+    /* Another channel is a miss. */
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN "0" );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CACHE_MISS,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArn ),
+                                              TEST_START_TIME + 2,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 1, shouldRefresh );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a copy returned by a lookup is not changed by a later update.
+ */
+void test_signaling_IceCache_CopyOutlivesUpdate( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn;
+    SignalingIceServer_t iceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS ], newIceServer;
+    size_t iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+    char storage[ SIGNALING_ICE_CACHE_STORAGE_LENGTH ];
+    uint8_t shouldRefresh;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+    InitCache( &( cache ) );
+    UpdateCache( &( cache ), TEST_START_TIME );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArn ),
+                                              TEST_START_TIME,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+
+    memset( &( newIceServer ), 0, sizeof( newIceServer ) );
+    newIceServer.pUserName = "other-user";
+    newIceServer.userNameLength = strlen( "other-user" );
+    newIceServer.pPassword = "other-pass";
+    newIceServer.passwordLength = strlen( "other-pass" );
+    newIceServer.messageTtlSeconds = 300;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheUpdate( &( cache ),
+                                                 &( channelArn ),
+                                                 &( newIceServer ),
+                                                 1,
+                                                 TEST_START_TIME + 1 ) );
+
+    TEST_ASSERT_EQUAL( 2, iceServerCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "user1", iceServers[ 0 ].pUserName, iceServers[ 0 ].userNameLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "pass1", iceServers[ 0 ].pPassword, iceServers[ 0 ].passwordLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "turn:b.example.com:443", iceServers[ 1 ].pUris[ 0 ], iceServers[ 1 ].urisLength[ 0 ] );
+
+    iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArn ),
+                                              TEST_START_TIME + 1,
+                                              iceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 1, iceServerCount );
+    TEST_ASSERT_EQUAL_STRING_LEN( "other-user", iceServers[ 0 ].pUserName, iceServers[ 0 ].userNameLength );
+    TEST_ASSERT_EQUAL( 0, iceServers[ 0 ].urisNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the ICE servers are refreshed at the configured fraction of the
+ *        shortest TTL, while still being served until they expire.
+ */
+void test_signaling_IceCache_ProactiveRefresh( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+    InitCache( &( cache ) );
+    UpdateCache( &( cache ), TEST_START_TIME );
+
+    /* The shortest TTL is 200 seconds, refreshed after 160. */
+    AssertGet( &( cache ), TEST_START_TIME + 159, SIGNALING_RESULT_OK, 0 );
+    AssertGet( &( cache ), TEST_START_TIME + 160, SIGNALING_RESULT_OK, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME + 160, 1 );
+    AssertGet( &( cache ), TEST_START_TIME + 161, SIGNALING_RESULT_OK, 0 );
+    AssertGet( &( cache ), TEST_START_TIME + 169, SIGNALING_RESULT_OK, 0 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME + 169, 0 );
+
+    /* The refresh was never completed, it is handed out again. */
+    AssertGet( &( cache ), TEST_START_TIME + 170, SIGNALING_RESULT_OK, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME + 170, 1 );
+    AssertGet( &( cache ), TEST_START_TIME + 179, SIGNALING_RESULT_OK, 0 );
+
+    /* Expired servers are not served, the refresh handed out at 170 has timed out. */
+    AssertGet( &( cache ), TEST_START_TIME + 200, SIGNALING_RESULT_CACHE_MISS, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME + 200, 1 );
+    AssertGet( &( cache ), TEST_START_TIME + 205, SIGNALING_RESULT_CACHE_MISS, 0 );
+
+    UpdateCache( &( cache ), TEST_START_TIME + 211 );
+    AssertGet( &( cache ), TEST_START_TIME + 211, SIGNALING_RESULT_OK, 0 );
+    AssertGet( &( cache ), TEST_START_TIME + 371, SIGNALING_RESULT_OK, 1 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that invalidations, for example on reconnect ICE server messages, are
+ *        coalesced into one refresh.
+ */
+void test_signaling_IceCache_Invalidate( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn, otherChannelArn;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+    InitChannelArn( &( otherChannelArn ), TEST_CHANNEL_ARN "0" );
+    InitCache( &( cache ) );
+
+    /* Not cached. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheInvalidate( &( cache ), &( otherChannelArn ) ) );
+
+    UpdateCache( &( cache ), TEST_START_TIME );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheInvalidate( &( cache ), &( channelArn ) ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheInvalidate( &( cache ), &( channelArn ) ) );
+
+    AssertGet( &( cache ), TEST_START_TIME + 1, SIGNALING_RESULT_OK, 1 );
+    AssertGet( &( cache ), TEST_START_TIME + 1, SIGNALING_RESULT_OK, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME + 1, 1 );
+    AssertGet( &( cache ), TEST_START_TIME + 1, SIGNALING_RESULT_OK, 0 );
+
+    /* More invalidations while the refresh is in progress don't hand out another. */
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheInvalidate( &( cache ), &( channelArn ) ) );
+    AssertGet( &( cache ), TEST_START_TIME + 2, SIGNALING_RESULT_OK, 0 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME + 2, 0 );
+
+    UpdateCache( &( cache ), TEST_START_TIME + 3 );
+    AssertGet( &( cache ), TEST_START_TIME + 4, SIGNALING_RESULT_OK, 0 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a full cache replaces the channel whose ICE servers expire first
+ *        when new ICE servers are stored.
+ */
+void test_signaling_IceCache_Eviction( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArns[ TEST_ENTRY_COUNT + 1 ];
+    char arns[ TEST_ENTRY_COUNT + 1 ][ 128 ];
+    SignalingIceServer_t iceServers[ 2 ], cachedIceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS ];
+    char storage[ SIGNALING_ICE_CACHE_STORAGE_LENGTH ];
+    size_t i, iceServerCount;
+    uint8_t shouldRefresh;
+
+    InitCache( &( cache ) );
+    InitIceServers( iceServers );
+
+    for( i = 0; i <= TEST_ENTRY_COUNT; i++ )
+    {
+        snprintf( arns[ i ], sizeof( arns[ i ] ), TEST_CHANNEL_ARN "%u", ( unsigned ) i );
+        InitChannelArn( &( channelArns[ i ] ), arns[ i ] );
+
+        /* Channel 1 was cached first. */
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_IceCacheUpdate( &( cache ),
+                                                     &( channelArns[ i ] ),
+                                                     iceServers,
+                                                     2,
+                                                     ( i == 1 ) ? TEST_START_TIME : TEST_START_TIME + 10 ) );
+    }
+
+    for( i = 0; i <= TEST_ENTRY_COUNT; i++ )
+    {
+        iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+        TEST_ASSERT_EQUAL( ( i == 1 ) ? SIGNALING_RESULT_CACHE_MISS : SIGNALING_RESULT_OK,
+                           Signaling_IceCacheGet( &( cache ),
+                                                  &( channelArns[ i ] ),
+                                                  TEST_START_TIME + 10,
+                                                  cachedIceServers,
+                                                  &( iceServerCount ),
+                                                  storage,
+                                                  sizeof( storage ),
+                                                  &( shouldRefresh ) ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that looking up or refreshing an unknown channel on a full cache does not
+ *        evict a channel whose ICE servers are still valid.
+ */
+void test_signaling_IceCache_NoEvictionOnMiss( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArns[ TEST_ENTRY_COUNT + 1 ];
+    char arns[ TEST_ENTRY_COUNT + 1 ][ 128 ];
+    SignalingIceServer_t iceServers[ 2 ], cachedIceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS ];
+    char storage[ SIGNALING_ICE_CACHE_STORAGE_LENGTH ];
+    size_t i, iceServerCount;
+    uint8_t shouldRefresh;
+
+    InitCache( &( cache ) );
+    InitIceServers( iceServers );
+
+    for( i = 0; i <= TEST_ENTRY_COUNT; i++ )
+    {
+        snprintf( arns[ i ], sizeof( arns[ i ] ), TEST_CHANNEL_ARN "%u", ( unsigned ) i );
+        InitChannelArn( &( channelArns[ i ] ), arns[ i ] );
+    }
+
+    for( i = 0; i < TEST_ENTRY_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_IceCacheUpdate( &( cache ),
+                                                     &( channelArns[ i ] ),
+                                                     iceServers,
+                                                     2,
+                                                     TEST_START_TIME ) );
+    }
+
+    /* The unknown channel can't be remembered, so every claim fetches. */
+    iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_CACHE_MISS,
+                       Signaling_IceCacheGet( &( cache ),
+                                              &( channelArns[ TEST_ENTRY_COUNT ] ),
+                                              TEST_START_TIME + 10,
+                                              cachedIceServers,
+                                              &( iceServerCount ),
+                                              storage,
+                                              sizeof( storage ),
+                                              &( shouldRefresh ) ) );
+    TEST_ASSERT_EQUAL( 1, shouldRefresh );
+    AssertBeginRefresh( &( cache ), &( channelArns[ TEST_ENTRY_COUNT ] ), TEST_START_TIME + 10, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArns[ TEST_ENTRY_COUNT ] ), TEST_START_TIME + 10, 1 );
+
+    for( i = 0; i < TEST_ENTRY_COUNT; i++ )
+    {
+        iceServerCount = SIGNALING_ICE_CACHE_MAX_SERVERS;
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                           Signaling_IceCacheGet( &( cache ),
+                                                  &( channelArns[ i ] ),
+                                                  TEST_START_TIME + 10,
+                                                  cachedIceServers,
+                                                  &( iceServerCount ),
+                                                  storage,
+                                                  sizeof( storage ),
+                                                  &( shouldRefresh ) ) );
+    }
+
+    /* Once the ICE servers have expired, their entry is reused. */
+    AssertBeginRefresh( &( cache ), &( channelArns[ TEST_ENTRY_COUNT ] ), TEST_START_TIME + 200, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArns[ TEST_ENTRY_COUNT ] ), TEST_START_TIME + 200, 0 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the capacity is the number of entries given to the cache.
+ */
+void test_signaling_IceCache_OneEntry( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn;
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN "0" );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_IceCacheInit( &( cache ),
+                                               cacheEntries,
+                                               1,
+                                               TEST_REFRESH_PERCENT ) );
+    UpdateCache( &( cache ), TEST_START_TIME );
+
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME, 1 );
+    AssertGet( &( cache ), TEST_START_TIME, SIGNALING_RESULT_OK, 0 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that ICE servers that don't fit are not cached, and leave the cache
+ *        unchanged.
+ */
+void test_signaling_IceCache_OutOfMemory( void )
+{
+    SignalingIceCache_t cache;
+    SignalingChannelArn_t channelArn;
+    SignalingIceServer_t iceServers[ SIGNALING_ICE_CACHE_MAX_SERVERS + 1 ];
+    static char longPassword[ SIGNALING_ICE_CACHE_STORAGE_LENGTH + 1 ];
+
+    InitChannelArn( &( channelArn ), TEST_CHANNEL_ARN );
+    InitCache( &( cache ) );
+    UpdateCache( &( cache ), TEST_START_TIME );
+
+    memset( iceServers, 0, sizeof( iceServers ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_IceCacheUpdate( &( cache ),
+                                                 &( channelArn ),
+                                                 iceServers,
+                                                 SIGNALING_ICE_CACHE_MAX_SERVERS + 1,
+                                                 TEST_START_TIME ) );
+    AssertGet( &( cache ), TEST_START_TIME, SIGNALING_RESULT_OK, 0 );
+
+    iceServers[ 0 ].urisNum = SIGNALING_ICE_SERVER_MAX_URIS + 1;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_IceCacheUpdate( &( cache ),
+                                                 &( channelArn ),
+                                                 iceServers,
+                                                 1,
+                                                 TEST_START_TIME ) );
+
+    /* The password and the ARN don't fit together. */
+    iceServers[ 0 ].urisNum = 0;
+    iceServers[ 0 ].pPassword = longPassword;
+    iceServers[ 0 ].passwordLength = SIGNALING_ICE_CACHE_STORAGE_LENGTH;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_IceCacheUpdate( &( cache ),
+                                                 &( channelArn ),
+                                                 iceServers,
+                                                 1,
+                                                 TEST_START_TIME ) );
+    AssertGet( &( cache ), TEST_START_TIME, SIGNALING_RESULT_OK, 0 );
+
+    /* An ARN that doesn't fit can't be cached, every claim fetches. */
+    channelArn.pChannelArn = longPassword;
+    channelArn.channelArnLength = sizeof( longPassword );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       Signaling_IceCacheUpdate( &( cache ),
+                                                 &( channelArn ),
+                                                 iceServers,
+                                                 0,
+                                                 TEST_START_TIME ) );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME, 1 );
+    AssertBeginRefresh( &( cache ), &( channelArn ), TEST_START_TIME, 1 );
+}
+
+/*-----------------------------------------------------------*/
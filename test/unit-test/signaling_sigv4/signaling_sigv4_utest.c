@@ -0,0 +1,612 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* API includes. */
+#include "signaling_sigv4.h"
+
+/* ===========================  EXTERN VARIABLES    =========================== */
+
+/* Credentials, region, service and date of the AWS SigV4 test suite. */
+#define TEST_ACCESS_KEY_ID        "AKIDEXAMPLE"
+#define TEST_SECRET_ACCESS_KEY    "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"
+#define TEST_REGION               "us-east-1"
+#define TEST_SERVICE              "service"
+#define TEST_DATE                 "20150830T123600Z"
+
+/* ===========================  EXTERN FUNCTIONS   =========================== */
+
+static void AssertDigest( const char * pExpectedHex,
+                          const uint8_t * pDigest )
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    char hexDigest[ 2 * SIGNALING_SHA256_DIGEST_LENGTH ];
+    size_t i;
+
+    for( i = 0; i < SIGNALING_SHA256_DIGEST_LENGTH; i++ )
+    {
+        hexDigest[ 2 * i ] = hexDigits[ pDigest[ i ] >> 4 ];
+        hexDigest[ ( 2 * i ) + 1 ] = hexDigits[ pDigest[ i ] & 0x0F ];
+    }
+
+    TEST_ASSERT_EQUAL_STRING_LEN( pExpectedHex,
+                                  hexDigest,
+                                  sizeof( hexDigest ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static void InitTestInputs( SignalingCredential_t * pCredential,
+                            SignalingAwsRegion_t * pAwsRegion,
+                            SignalingSigV4Request_t * pRequest )
+{
+    memset( pCredential, 0, sizeof( SignalingCredential_t ) );
+    pCredential->pAccessKeyId = TEST_ACCESS_KEY_ID;
+    pCredential->accessKeyIdLength = strlen( TEST_ACCESS_KEY_ID );
+    pCredential->pSecretAccessKey = TEST_SECRET_ACCESS_KEY;
+    pCredential->secretAccessKeyLength = strlen( TEST_SECRET_ACCESS_KEY );
+
+    pAwsRegion->pAwsRegion = TEST_REGION;
+    pAwsRegion->awsRegionLength = strlen( TEST_REGION );
+
+    memset( pRequest, 0, sizeof( SignalingSigV4Request_t ) );
+    pRequest->pMethod = "GET";
+    pRequest->methodLength = strlen( "GET" );
+    pRequest->pUrl = "https://example.amazonaws.com/";
+    pRequest->urlLength = strlen( "https://example.amazonaws.com/" );
+}
+
+/*-----------------------------------------------------------*/
+
+static SignalingResult_t SignTestRequest( SignalingSigV4Signer_t * pSigner,
+                                          const SignalingCredential_t * pCredential,
+                                          const SignalingAwsRegion_t * pAwsRegion,
+                                          const char * pDate,
+                                          const SignalingSigV4Request_t * pRequest,
+                                          char * pAuthorization,
+                                          size_t * pAuthorizationLength )
+{
+    return Signaling_SigV4SignRequest( pSigner,
+                                       pCredential,
+                                       pAwsRegion,
+                                       TEST_SERVICE,
+                                       strlen( TEST_SERVICE ),
+                                       pDate,
+                                       pRequest,
+                                       pAuthorization,
+                                       pAuthorizationLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static const char * GetSignature( const char * pAuthorization )
+{
+    const char * pSignature = strstr( pAuthorization, "Signature=" );
+
+    TEST_ASSERT_NOT_NULL( pSignature );
+
+    return &( pSignature[ strlen( "Signature=" ) ] );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate SHA-256 with the FIPS 180-2 example messages.
+ */
+void test_signaling_Sha256_KnownAnswers( void )
+{
+    SignalingSha256_t sha256;
+    uint8_t digest[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    const char * pMessage = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+    Signaling_Sha256Init( &( sha256 ) );
+    Signaling_Sha256Final( &( sha256 ), digest );
+    AssertDigest( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                  digest );
+
+    Signaling_Sha256Init( &( sha256 ) );
+    Signaling_Sha256Update( &( sha256 ), "abc", 3 );
+    Signaling_Sha256Final( &( sha256 ), digest );
+    AssertDigest( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+                  digest );
+
+    /* 56 bytes, the padding takes an extra block. */
+    Signaling_Sha256Init( &( sha256 ) );
+    Signaling_Sha256Update( &( sha256 ), pMessage, strlen( pMessage ) );
+    Signaling_Sha256Final( &( sha256 ), digest );
+    AssertDigest( "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+                  digest );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate SHA-256 when a long message is given in uneven pieces.
+ */
+void test_signaling_Sha256_Incremental( void )
+{
+    SignalingSha256_t sha256;
+    uint8_t digest[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    char piece[ 1000 ];
+    size_t remaining = 1000000, pieceLength, i = 0;
+
+    memset( piece, 'a', sizeof( piece ) );
+    Signaling_Sha256Init( &( sha256 ) );
+
+    while( remaining > 0 )
+    {
+        /* Lengths that do not line up with the 64 byte blocks. */
+        pieceLength = ( i % 7 ) * 97 + 1;
+        pieceLength = ( pieceLength < remaining ) ? pieceLength : remaining;
+        Signaling_Sha256Update( &( sha256 ), piece, pieceLength );
+        remaining -= pieceLength;
+        i++;
+    }
+
+    Signaling_Sha256Final( &( sha256 ), digest );
+    AssertDigest( "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0",
+                  digest );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate HMAC-SHA256 with the RFC 4231 test cases 1, 2 and 6.
+ */
+void test_signaling_HmacSha256_KnownAnswers( void )
+{
+    uint8_t key[ 131 ];
+    uint8_t mac[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    const char * pData;
+
+    memset( key, 0x0B, 20 );
+    Signaling_HmacSha256( key, 20, "Hi There", strlen( "Hi There" ), mac );
+    AssertDigest( "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7",
+                  mac );
+
+    pData = "what do ya want for nothing?";
+    Signaling_HmacSha256( ( const uint8_t * ) "Jefe", 4, pData, strlen( pData ), mac );
+    AssertDigest( "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843",
+                  mac );
+
+    /* A key longer than the block is hashed first. */
+    memset( key, 0xAA, sizeof( key ) );
+    pData = "Test Using Larger Than Block-Size Key - Hash Key First";
+    Signaling_HmacSha256( key, sizeof( key ), pData, strlen( pData ), mac );
+    AssertDigest( "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54",
+                  mac );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Init fail functionality for Bad Parameters.
+ */
+void test_signaling_SigV4Init_BadParams( void )
+{
+    SignalingResult_t result;
+
+    result = Signaling_SigV4Init( NULL );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request fail functionality for Bad Parameters.
+ */
+void test_signaling_SigV4SignRequest_BadParams( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    SignalingSigV4Header_t headers[ SIGNALING_SIGV4_MAX_HEADERS + 1 ] = { 0 };
+    char authorization[ 256 ];
+    size_t authorizationLength = sizeof( authorization );
+    SignalingResult_t result;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+
+    result = SignTestRequest( NULL, &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    result = SignTestRequest( &( signer ), NULL, &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    result = SignTestRequest( &( signer ), &( credential ), NULL, TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), NULL, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, NULL, authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), NULL, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, NULL );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    /* Malformed date. */
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), "2015-08-30T12:36", &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    /* Body without a payload hash. */
+    request.bodyLength = 10;
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+    request.bodyLength = 0;
+
+    /* Too many headers. */
+    request.pHeaders = headers;
+    request.headerCount = SIGNALING_SIGV4_MAX_HEADERS + 1;
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+    request.headerCount = 0;
+
+    /* Too many query parameters. */
+    request.pUrl = "https://example.amazonaws.com/?a=1&b=2&c=3&d=4&e=5&f=6&g=7&h=8&i=9&j=10&k=11&l=12&m=13&n=14&o=15&p=16&q=17";
+    request.urlLength = strlen( request.pUrl );
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       result );
+
+    /* Region too long. */
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+    awsRegion.awsRegionLength = SIGNALING_SIGV4_MAX_REGION_LENGTH + 1;
+    awsRegion.pAwsRegion = "an-aws-region-far-too-long-to-be-real";
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_REGION_LENGTH_TOO_LARGE,
+                       result );
+
+    /* Secret access key too long. */
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+    credential.secretAccessKeyLength = SECRET_ACCESS_KEY_MAX_LEN + 1;
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_SECRET_ACCESS_KEY_LENGTH_TOO_LARGE,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request fail functionality for URLs without scheme or host.
+ */
+void test_signaling_SigV4SignRequest_InvalidUrl( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    char authorization[ 256 ];
+    size_t authorizationLength = sizeof( authorization );
+    const char * pUrls[] = { "example.amazonaws.com/", "https:///path", "https://", "://example.amazonaws.com/" };
+    size_t i;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+
+    for( i = 0; i < sizeof( pUrls ) / sizeof( pUrls[ 0 ] ); i++ )
+    {
+        request.pUrl = pUrls[ i ];
+        request.urlLength = strlen( pUrls[ i ] );
+
+        TEST_ASSERT_EQUAL( SIGNALING_RESULT_INVALID_URL,
+                           SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request fail functionality for a small output buffer.
+ */
+void test_signaling_SigV4SignRequest_SmallBuffer( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    char authorization[ 256 ];
+    size_t authorizationLength;
+    size_t expectedLength;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    expectedLength = authorizationLength;
+
+    /* No room for the null terminator. */
+    authorizationLength = expectedLength;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OUT_OF_MEMORY,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+
+    authorizationLength = expectedLength + 1;
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL( expectedLength,
+                       authorizationLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request with the get-vanilla case of the AWS SigV4 test suite.
+ */
+void test_signaling_SigV4SignRequest_GetVanilla( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    char authorization[ 256 ];
+    size_t authorizationLength = sizeof( authorization );
+    const char * pExpected = "AWS4-HMAC-SHA256 Credential=AKIDEXAMPLE/20150830/us-east-1/service/aws4_request, "
+                             "SignedHeaders=host;x-amz-date, "
+                             "Signature=5fa00fa31553b73ebf1942676e86291e8372ff2a2260956d9b8aae1d763fbf31";
+    SignalingResult_t result;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( strlen( pExpected ),
+                       authorizationLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( pExpected,
+                                  authorization,
+                                  authorizationLength );
+    TEST_ASSERT_EQUAL( '\0',
+                       authorization[ authorizationLength ] );
+
+    /* No path signs the same as "/". */
+    request.pUrl = "https://example.amazonaws.com";
+    request.urlLength = strlen( request.pUrl );
+    authorizationLength = sizeof( authorization );
+    result = SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_STRING_LEN( pExpected,
+                                  authorization,
+                                  authorizationLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request with the post-vanilla and
+ *        post-x-www-form-urlencoded cases of the AWS SigV4 test suite.
+ */
+void test_signaling_SigV4SignRequest_Post( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    SignalingSigV4Header_t contentType;
+    SignalingSha256_t sha256;
+    uint8_t payloadHash[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    char authorization[ 256 ];
+    size_t authorizationLength = sizeof( authorization );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+    request.pMethod = "POST";
+    request.methodLength = strlen( "POST" );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "5da7c1a2acd57cee7505fc6676e4e544621c30862966e37dddb68e92efbe5d6b",
+                                  GetSignature( authorization ),
+                                  2 * SIGNALING_SHA256_DIGEST_LENGTH );
+
+    contentType.pName = "content-type";
+    contentType.nameLength = strlen( "content-type" );
+    contentType.pValue = "application/x-www-form-urlencoded";
+    contentType.valueLength = strlen( "application/x-www-form-urlencoded" );
+    request.pHeaders = &( contentType );
+    request.headerCount = 1;
+    request.pBody = "Param1=value1";
+    request.bodyLength = strlen( "Param1=value1" );
+
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_NOT_NULL( strstr( authorization, "SignedHeaders=content-type;host;x-amz-date," ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "ff11897932ad3f4e8b18135d722051e5ac45fc38421b1da7b9d196a0fe09473a",
+                                  GetSignature( authorization ),
+                                  2 * SIGNALING_SHA256_DIGEST_LENGTH );
+
+    /* A precomputed payload hash signs the same as the body. */
+    Signaling_Sha256Init( &( sha256 ) );
+    Signaling_Sha256Update( &( sha256 ), request.pBody, request.bodyLength );
+    Signaling_Sha256Final( &( sha256 ), payloadHash );
+    request.pBody = NULL;
+    request.pPayloadHash = payloadHash;
+
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "ff11897932ad3f4e8b18135d722051e5ac45fc38421b1da7b9d196a0fe09473a",
+                                  GetSignature( authorization ),
+                                  2 * SIGNALING_SHA256_DIGEST_LENGTH );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request sorts the query parameters, with the
+ *        get-vanilla-query-order-key-case case of the AWS SigV4 test suite.
+ */
+void test_signaling_SigV4SignRequest_QueryOrder( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    char authorization[ 256 ];
+    size_t authorizationLength = sizeof( authorization );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+    request.pUrl = "https://example.amazonaws.com/?Param2=value2&Param1=value1";
+    request.urlLength = strlen( request.pUrl );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "b97d918cfa904a5beff61c982a1b6f458b799221646efd99d3219ec94cdf2500",
+                                  GetSignature( authorization ),
+                                  2 * SIGNALING_SHA256_DIGEST_LENGTH );
+
+    /* Already sorted parameters sign the same. */
+    request.pUrl = "https://example.amazonaws.com/?Param1=value1&Param2=value2";
+    request.urlLength = strlen( request.pUrl );
+    authorizationLength = sizeof( authorization );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "b97d918cfa904a5beff61c982a1b6f458b799221646efd99d3219ec94cdf2500",
+                                  GetSignature( authorization ),
+                                  2 * SIGNALING_SHA256_DIGEST_LENGTH );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign Request keeps the signing key while the date, region,
+ *        service and secret access key stay the same, and derives it again otherwise.
+ */
+void test_signaling_SigV4SignRequest_SigningKeyCache( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    char authorization[ 256 ];
+    char firstAuthorization[ 256 ];
+    size_t authorizationLength = sizeof( authorization );
+    uint8_t signingKey[ SIGNALING_SHA256_DIGEST_LENGTH ];
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), firstAuthorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL( 1,
+                       signer.isKeyCached );
+    memcpy( signingKey, signer.signingKey, sizeof( signingKey ) );
+
+    /* Same day, another time: the cached key is used. */
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), "20150830T235959Z", &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL_MEMORY( signingKey,
+                              signer.signingKey,
+                              sizeof( signingKey ) );
+
+    /* Another day: the key changes. */
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), "20150831T000000Z", &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_TRUE( memcmp( signingKey, signer.signingKey, sizeof( signingKey ) ) != 0 );
+
+    /* Back to the first day with a rotated secret: the key changes too. */
+    credential.pSecretAccessKey = "aRotatedSecretAccessKeyEXAMPLEKEY";
+    credential.secretAccessKeyLength = strlen( credential.pSecretAccessKey );
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_TRUE( memcmp( signingKey, signer.signingKey, sizeof( signingKey ) ) != 0 );
+    TEST_ASSERT_TRUE( strcmp( firstAuthorization, authorization ) != 0 );
+
+    /* And back to the first secret: the first signature again. */
+    credential.pSecretAccessKey = TEST_SECRET_ACCESS_KEY;
+    credential.secretAccessKeyLength = strlen( TEST_SECRET_ACCESS_KEY );
+    authorizationLength = sizeof( authorization );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       SignTestRequest( &( signer ), &( credential ), &( awsRegion ), TEST_DATE, &( request ), authorization, &( authorizationLength ) ) );
+    TEST_ASSERT_EQUAL_MEMORY( signingKey,
+                              signer.signingKey,
+                              sizeof( signingKey ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( firstAuthorization,
+                                  authorization,
+                                  authorizationLength + 1 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Signaling SigV4 Sign with the canonical request hash of the get-vanilla case
+ *        of the AWS SigV4 test suite.
+ */
+void test_signaling_SigV4Sign_CanonicalRequestHash( void )
+{
+    SignalingSigV4Signer_t signer;
+    SignalingCredential_t credential;
+    SignalingAwsRegion_t awsRegion;
+    SignalingSigV4Request_t request;
+    uint8_t canonicalRequestHash[ SIGNALING_SHA256_DIGEST_LENGTH ];
+    char signature[ SIGNALING_SIGV4_SIGNATURE_LENGTH ];
+    const char * pCanonicalRequestHash = "bb579772317eb040ac9ed261061d46c1f17a8133879d6129b6e1c25292927e63";
+    size_t i;
+    unsigned int byte;
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Init( &( signer ) ) );
+    InitTestInputs( &( credential ), &( awsRegion ), &( request ) );
+
+    for( i = 0; i < SIGNALING_SHA256_DIGEST_LENGTH; i++ )
+    {
+        TEST_ASSERT_EQUAL( 1,
+                           sscanf( &( pCanonicalRequestHash[ 2 * i ] ), "%2x", &( byte ) ) );
+        canonicalRequestHash[ i ] = ( uint8_t ) byte;
+    }
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_SigV4Sign( &( signer ), &( credential ), &( awsRegion ), TEST_SERVICE, strlen( TEST_SERVICE ), TEST_DATE, NULL, signature ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_SigV4Sign( &( signer ), &( credential ), &( awsRegion ), TEST_SERVICE, strlen( TEST_SERVICE ), TEST_DATE, canonicalRequestHash, NULL ) );
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_BAD_PARAM,
+                       Signaling_SigV4Sign( NULL, &( credential ), &( awsRegion ), TEST_SERVICE, strlen( TEST_SERVICE ), TEST_DATE, canonicalRequestHash, signature ) );
+
+    TEST_ASSERT_EQUAL( SIGNALING_RESULT_OK,
+                       Signaling_SigV4Sign( &( signer ), &( credential ), &( awsRegion ), TEST_SERVICE, strlen( TEST_SERVICE ), TEST_DATE, canonicalRequestHash, signature ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "5fa00fa31553b73ebf1942676e86291e8372ff2a2260956d9b8aae1d763fbf31",
+                                  signature,
+                                  SIGNALING_SIGV4_SIGNATURE_LENGTH );
+}
+
+/*-----------------------------------------------------------*/